@@ -68,6 +68,7 @@ void Aux_Error( const char *File, const int Line, const char *Func, const char *
 // Method      :  AMR_t    : Constructor
 //               ~AMR_t    : Destructor
 //                pnew     : Allocate one patch
+//                pnew_PID : Allocate one patch with a given patch ID (thread-safe)
 //                pdelete  : Deallocate one patch
 //                Lvdelete : Deallocate all patches in the given level
 //-------------------------------------------------------------------------------------------------------
@@ -248,6 +249,37 @@ struct AMR_t
       if ( NewPID > MAX_PATCH-1 )
          Aux_Error( ERROR_INFO, "exceed MAX_PATCH (%d) => please reset it in the Makefile !!\n", MAX_PATCH );
 
+      pnew_PID( lv, NewPID, scale_x, scale_y, scale_z, FaPID, FluData, MagData, PotData );
+
+      num[lv] ++;
+
+   } // METHOD : pnew
+
+
+
+   //===================================================================================
+   // Method      :  pnew_PID
+   // Description :  Allocate a single patch with the given patch ID
+   //
+   // Note        :  1. Same as pnew() except that
+   //                   (1) the new patch ID is given by NewPID instead of num[lv]
+   //                   (2) num[lv] is NOT updated
+   //                   --> Different threads can allocate patches with different NewPID simultaneously
+   //                   --> Caller must update num[lv] after allocating all new patches
+   //                2. NewPID must be within the range [0 ... MAX_PATCH-1]
+   //
+   // Parameter   :  lv          : Target refinement level
+   //                NewPID      : Patch ID of the new patch
+   //                scale_x/y/z : Grid scale indices (not physical coordinates) of the patch corner
+   //                FaPID       : Patch ID of the parent patch at level "lv-1"
+   //                FluData     : true --> Allocate fluid[]
+   //                MagData     : true --> Allocate magnetic[]
+   //                PotData     : true --> Allocate pot[]
+   //===================================================================================
+   void pnew_PID( const int lv, const int NewPID, const int scale_x, const int scale_y, const int scale_z,
+                  const int FaPID, const bool FluData, const bool MagData, const bool PotData )
+   {
+
 //    allocate new patches if there are no inactive patches
       if ( patch[0][lv][NewPID] == NULL )
       {
@@ -286,9 +318,7 @@ struct AMR_t
                                          BoxScale, BoxEdgeL, dh[TOP_LEVEL], InitPtrAsNull_No );
       } // if ( patch[0][lv][NewPID] == NULL ) ... else ...
 
-      num[lv] ++;
-
-   } // METHOD : pnew
+   } // METHOD : pnew_PID
 
 
 
@@ -32,6 +32,8 @@ SET_GLOBAL( __constant__ real c_Mm[3] );
 #if ( MODEL == HYDRO )
 SET_GLOBAL( __constant__ double c_Src_Dlep_AuxArray_Flt[SRC_NAUX_DLEP] );
 SET_GLOBAL( __constant__ int    c_Src_Dlep_AuxArray_Int[SRC_NAUX_DLEP] );
+SET_GLOBAL( __constant__ double c_Src_Cool_AuxArray_Flt[SRC_NAUX_COOL] );
+SET_GLOBAL( __constant__ int    c_Src_Cool_AuxArray_Int[SRC_NAUX_COOL] );
 #endif
 SET_GLOBAL( __constant__ double c_Src_User_AuxArray_Flt[SRC_NAUX_USER] );
 SET_GLOBAL( __constant__ int    c_Src_User_AuxArray_Int[SRC_NAUX_USER] );
@@ -118,6 +118,13 @@
 #   define N_EC_ELE              0
 #  endif
 
+// range of the z planes [SLAB_PLANE_S, SLAB_PLANE_E) in an array of NPlane planes required for updating
+// the output z slab [kSlab_s, kSlab_e) of a patch group (for OPT__FLU_SLAB)
+// --> slabs must be processed in ascending order since planes already computed for the previous slab are skipped
+// --> kSlab_s=0 and kSlab_e=PS2 cover the entire array
+#  define SLAB_PLANE_S( kSlab_s, NPlane )   (  ( (kSlab_s) == 0   ) ? 0          : (kSlab_s)+(NPlane)-PS2  )
+#  define SLAB_PLANE_E( kSlab_e, NPlane )   (  ( (kSlab_e) == PS2 ) ? (NPlane)   : (kSlab_e)+(NPlane)-PS2  )
+
 #endif // #if ( FLU_SCHEME == MHM  ||  FLU_SCHEME == MHM_RP  ||  FLU_SCHEME == CTU )
 
 
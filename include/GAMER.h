@@ -61,6 +61,7 @@ extern "C" {
 #include "Typedef.h"
 #include "AMR.h"
 #include "Timer.h"
+#include "Trace.h"
 #include "RandomNumber.h"
 #include "Profile.h"
 #include "SrcTerms.h"
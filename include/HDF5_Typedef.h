@@ -20,6 +20,13 @@ datatypes in the HDF5 format
 #  define H5T_GAMER_REAL H5T_NATIVE_FLOAT
 #endif
 
+// memory datatype of the grid data stored in patches (see real_store in Typedef.h)
+#ifdef MIXED_PRECISION
+#  define H5T_GAMER_REAL_STORE H5T_NATIVE_FLOAT
+#else
+#  define H5T_GAMER_REAL_STORE H5T_GAMER_REAL
+#endif
+
 #ifdef GAMER_DEBUG
 #  define DEBUG_HDF5
 #endif
@@ -103,6 +110,7 @@ struct Makefile_t
    int Timing;
    int TimingSolver;
    int Float8;
+   int MixedPrecision;
    int Serial;
    int LoadBalance;
    int OverlapMPI;
@@ -285,6 +293,7 @@ struct SymConst_t
    int    Src_NAuxDlep;
    int    Src_DlepProfNVar;
    int    Src_DlepProfNBinMax;
+   int    Src_NAuxCool;
    int    Src_NAuxUser;
 
 }; // struct SymConst_t
@@ -380,6 +389,7 @@ struct InputPara_t
    int    AutoReduceDt;
    double AutoReduceDtFactor;
    double AutoReduceDtFactorMin;
+   int    AutoReduceDtLocal;
 
 // domain refinement
    int    RegridCount;
@@ -422,6 +432,7 @@ struct InputPara_t
 #  endif
    int    Opt__ReuseMemory;
    int    Opt__MemoryPool;
+   int    Opt__SingleSandglass;
 
 // load balance
 #  ifdef LOAD_BALANCE
@@ -430,6 +441,10 @@ struct InputPara_t
    double LB_Par_Weight;
 #  endif
    int    Opt__RecordLoadBalance;
+   int    Opt__LB_AllLevel;
+   int    Opt__LB_Incremental;
+   double Opt__LB_IncMaxShift;
+   int    Opt__LB_SparseComm;
 #  endif
    int    Opt__MinimizeMPIBarrier;
 
@@ -438,10 +453,23 @@ struct InputPara_t
    double Gamma;
    double MolecularWeight;
    double IsoTemp;
+   char  *EoSTab_Name;
+   int    EoSTab_NDens;
+   int    EoSTab_NSEint;
+   int    EoSTab_NYe;
+   int    EoSTab_NPres;
+   double EoSTab_LogDens_Min;
+   double EoSTab_LogDens_Max;
+   double EoSTab_LogSEint_Min;
+   double EoSTab_LogSEint_Max;
+   double EoSTab_Ye_Min;
+   double EoSTab_Ye_Max;
    double MinMod_Coeff;
    int    Opt__LR_Limiter;
    int    Opt__1stFluxCorr;
    int    Opt__1stFluxCorrScheme;
+   int    Opt__FluSuperBlock;
+   int    Opt__FluSlab;
 #  endif
 
 // ELBDM solvers
@@ -516,7 +544,14 @@ struct InputPara_t
 
 // source terms
    int    Src_Deleptonization;
+#  if ( MODEL == HYDRO )
+   int    Src_Cooling;
+   char  *Src_Cooling_Table;
+   double Src_Cooling_Redshift;
+   double Src_Cooling_Metal;
+#  endif
    int    Src_User;
+   int    Src_FuseFluid;
    int    Src_GPU_NPGroup;
 
 // Grackle
@@ -618,6 +653,10 @@ struct InputPara_t
    int    Opt__TimingBarrier;
    int    Opt__TimingBalance;
    int    Opt__TimingMPI;
+   int    Opt__TimingTrace;
+   int    Opt__TimingTrace_NEvent;
+   int    Opt__TimingPerf;
+   long   Opt__TimingPerf_Raw;
    int    Opt__RecordNote;
    int    Opt__RecordUnphy;
    int    Opt__RecordMemory;
@@ -645,6 +645,21 @@
 #  define SRC_NXT_P1    ( SRC_NXT + 1 )
 
 
+// super-blocks of 2x2x2 patch groups for the CPU fluid solver (OPT__FLU_SUPER_BLOCK)
+// --> only supported by the CPU MHM/MHM_RP/CTU hydro schemes without MHD for now
+#if ( MODEL == HYDRO  &&  ( FLU_SCHEME == MHM || FLU_SCHEME == MHM_RP || FLU_SCHEME == CTU )  &&  !defined MHD  &&  !defined GPU )
+#  define SUPPORT_FLU_SUPER_BLOCK
+#endif
+
+#  define FLU_SB_PS2    ( 4*PATCH_SIZE )                          // use 2x2x2 patch groups as the unit
+#  define FLU_SB_NXT    ( FLU_SB_PS2 + 2*FLU_GHOST_SIZE )
+#if ( defined GRAVITY  &&  defined UNSPLIT_GRAVITY )
+#  define USG_SB_NXT_F  ( FLU_SB_PS2 + 2*USG_GHOST_SIZE_F )
+#else
+#  define USG_SB_NXT_F  ( 1 )
+#endif
+
+
 // size of auxiliary arrays and EoS tables
 #if ( MODEL == HYDRO )
 #  define EOS_NAUX_MAX           20    // EoS_AuxArray_Flt/Int[]
@@ -660,8 +675,10 @@
 #  define SRC_NAUX_DLEP          5     // SrcTerms.Dlep_AuxArray_Flt/Int[]
 #  define SRC_DLEP_PROF_NVAR     6     // SrcTerms.Dlep_Profile_DataDevPtr[]/RadiusDevPtr[]
 #  define SRC_DLEP_PROF_NBINMAX  4000
+#  define SRC_NAUX_COOL          10    // SrcTerms.Cool_AuxArray_Flt/Int[]
 #else
 #  define SRC_NAUX_DLEP          0
+#  define SRC_NAUX_COOL          0
 #endif
 #  define SRC_NAUX_USER          10    // SrcTerms.User_AuxArray_Flt/Int[]
 
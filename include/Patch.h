@@ -25,6 +25,8 @@ long  LB_Corner2Index( const int lv, const int Corner[], const Check_t Check );
 //
 // Data Member :  fluid           : Fluid variables (mass density, momentum density x, y ,z, energy density)
 //                                  --> Including passively advected variables (e.g., metal density)
+//                                  --> fluid, magnetic, pot, and pot_ext are stored in single precision if MIXED_PRECISION
+//                                      is on (see real_store in Typedef.h)
 //                magnetic        : Magnetic field (Bx, By, Bz)
 //                pot             : Potential
 //                pot_ext         : Potential with GRA_GHOST_SIZE ghost cells on each side
@@ -183,16 +185,16 @@ struct patch_t
 
 // data members
 // ===================================================================================
-   real (*fluid)[PS1][PS1][PS1];
+   real_store (*fluid)[PS1][PS1][PS1];
 
 #  ifdef MHD
-   real (*magnetic)[ PS1P1*SQR(PS1) ];
+   real_store (*magnetic)[ PS1P1*SQR(PS1) ];
 #  endif
 
 #  ifdef GRAVITY
-   real (*pot)[PS1][PS1];
+   real_store (*pot)[PS1][PS1];
 #  ifdef STORE_POT_GHOST
-   real (*pot_ext)[GRA_NXT][GRA_NXT];
+   real_store (*pot_ext)[GRA_NXT][GRA_NXT];
 #  endif
 #  endif // GRAVITY
 
@@ -670,8 +672,8 @@ struct patch_t
 
       if ( fluid == NULL )
       {
-         fluid = new real [NCOMP_TOTAL][PS1][PS1][PS1];
-         fluid[0][0][0][0] = (real)-1.0;  // arbitrarily initialized
+         fluid = new real_store [NCOMP_TOTAL][PS1][PS1][PS1];
+         fluid[0][0][0][0] = (real_store)-1.0;  // arbitrarily initialized
       }
 
    } // METHOD : hnew
@@ -709,8 +711,8 @@ struct patch_t
 
       if ( magnetic == NULL )
       {
-         magnetic = new real [NCOMP_MAG][ PS1P1*SQR(PS1) ];
-         magnetic[0][0] = (real)-1.0;  // arbitrarily initialized
+         magnetic = new real_store [NCOMP_MAG][ PS1P1*SQR(PS1) ];
+         magnetic[0][0] = (real_store)-1.0;  // arbitrarily initialized
       }
 
    } // METHOD : mnew
@@ -742,10 +744,10 @@ struct patch_t
    void gnew()
    {
 
-      if ( pot == NULL )      pot     = new real [PS1][PS1][PS1];
+      if ( pot == NULL )      pot     = new real_store [PS1][PS1][PS1];
 
 #     ifdef STORE_POT_GHOST
-      if ( pot_ext == NULL )  pot_ext = new real [GRA_NXT][GRA_NXT][GRA_NXT];
+      if ( pot_ext == NULL )  pot_ext = new real_store [GRA_NXT][GRA_NXT][GRA_NXT];
 
 //    always initialize pot_ext[] (even if pot_ext != NULL when calling this function) to indicate that this array
 //    has NOT been properly set --> used by Poi_StorePotWithGhostZone()
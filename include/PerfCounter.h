@@ -0,0 +1,116 @@
+#ifndef __PERFCOUNTER_H__
+#define __PERFCOUNTER_H__
+
+
+
+// hardware events measured by OPT__TIMING_PERF
+const int NPERF_EVENT = 4;
+
+const int
+   PERF_CYCLE = 0,      // CPU cycles
+   PERF_INST  = 1,      // retired instructions
+   PERF_LLC   = 2,      // last-level cache misses
+   PERF_RAW   = 3;      // user-specified raw event (OPT__TIMING_PERF_RAW), usually for floating-point operations
+
+// global hardware counter variables defined in Aux_PerfCounter.cpp
+extern bool Perf_Active;
+extern bool Perf_EventOn[NPERF_EVENT];
+
+void Aux_PerfCounter_Read( ulong Count[] );
+
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Structure   :  PerfCounter_t
+// Description :  Data structure for measuring the hardware events between Start() and Stop()
+//
+// Note        :  1. Attached to Timer_t so that the events are measured together with the elapsed time
+//                   --> See Timer_t::Perf
+//                2. Events are summed over all OpenMP threads of the current rank
+//                   --> Must be started and stopped outside OpenMP parallel regions
+//                3. Nothing is measured if Perf_Active is false
+//
+// Data Member :  Status : (false / true) <--> (stop / counting)
+//                Count  : Accumulated counts of all events
+//
+// Method      :  PerfCounter_t : Constructor
+//                Start         : Start counting
+//                Stop          : Stop counting
+//                Reset         : Reset counters
+//-------------------------------------------------------------------------------------------------------
+struct PerfCounter_t
+{
+
+// data members
+// ===================================================================================
+   bool  Status;
+   ulong Count[NPERF_EVENT];
+
+
+
+   //===================================================================================
+   // Constructor :  PerfCounter_t
+   // Description :  Constructor of the structure "PerfCounter_t"
+   //
+   // Note        :  Initialize all data members
+   //===================================================================================
+   PerfCounter_t()
+   {
+      Status = false;
+      Reset();
+   }
+
+
+
+   //===================================================================================
+   // Method      :  Start
+   // Description :  Start counting and set status as "true"
+   //
+   // Note        :  Same accumulation scheme as Timer_t::Start()
+   //===================================================================================
+   void Start()
+   {
+      if ( !Perf_Active )  return;
+
+      ulong Now[NPERF_EVENT];
+      Aux_PerfCounter_Read( Now );
+
+      for (int e=0; e<NPERF_EVENT; e++)   Count[e] = Now[e] - Count[e];
+      Status = true;
+   }
+
+
+
+   //===================================================================================
+   // Method      :  Stop
+   // Description :  Stop counting and set status as "false"
+   //===================================================================================
+   void Stop()
+   {
+      if ( !Perf_Active )  return;
+
+      ulong Now[NPERF_EVENT];
+      Aux_PerfCounter_Read( Now );
+
+      for (int e=0; e<NPERF_EVENT; e++)   Count[e] = Now[e] - Count[e];
+      Status = false;
+   }
+
+
+
+   //===================================================================================
+   // Method      :  Reset
+   // Description :  Reset all counters
+   //===================================================================================
+   void Reset()
+   {
+      for (int e=0; e<NPERF_EVENT; e++)   Count[e] = 0;
+   }
+
+
+}; // struct PerfCounter_t
+
+
+
+#endif // #ifndef __PERFCOUNTER_H__
@@ -31,6 +31,11 @@ void Aux_DeleteTimer();
 void Aux_ResetTimer();
 void Aux_AccumulatedTiming( const double TotalT, double InitT, double OtherT );
 void Aux_Record_Timing();
+void Aux_Trace_Init();
+void Aux_Trace_Flush();
+void Aux_Trace_End();
+void Aux_PerfCounter_Init();
+void Aux_PerfCounter_End();
 void Aux_Record_PatchCount();
 void Aux_Record_Performance( const double ElapsedTime );
 void Aux_Record_CorrUnphy();
@@ -86,7 +91,8 @@ void CPU_FluidSolver( real h_Flu_Array_In[][FLU_NIN][ CUBE(FLU_NXT) ],
                       const double Time, const bool UsePot, const OptExtAcc_t ExtAcc,
                       const real MinDens, const real MinPres, const real MinEint, const real DualEnergySwitch,
                       const bool NormPassive, const int NNorm, const int NormIdx[],
-                      const bool JeansMinPres, const real JeansMinPres_Coeff );
+                      const bool JeansMinPres, const real JeansMinPres_Coeff,
+                      const bool FuseSrc, const double TimeNew, const int SlabSize );
 real Hydro_Con2Pres( const real Dens, const real MomX, const real MomY, const real MomZ, const real Engy,
                      const real Passive[], const bool CheckMinPres, const real MinPres, const real Emag,
                      const EoS_DE2P_t EoS_DensEint2Pres, const double EoS_AuxArray_Flt[], const int EoS_AuxArray_Int[],
@@ -132,7 +138,7 @@ void Flu_Close( const int lv, const int SaveSg_Flu, const int SaveSg_Mag,
                 const int NPG, const int *PID0_List,
                 const real h_Flu_Array_F_In[][FLU_NIN][ CUBE(FLU_NXT) ],
                 const real h_Mag_Array_In[][NCOMP_MAG][ FLU_NXT_P1*SQR(FLU_NXT) ],
-                const double dt );
+                const double dt, const double TimeNew, const double TimeOld );
 void Flu_Prepare( const int lv, const double PrepTime,
                   real h_Flu_Array_F_In[][FLU_NIN][ CUBE(FLU_NXT) ],
                   real h_Mag_Array_F_In[][NCOMP_MAG][ FLU_NXT_P1*SQR(FLU_NXT) ],
@@ -149,9 +155,18 @@ void Hydro_BoundaryCondition_Outflow( real *Array, const int BC_Face, const int
                                       const int ArraySizeX, const int ArraySizeY, const int ArraySizeZ,
                                       const int Idx_Start[], const int Idx_End[] );
 void Flu_CorrAfterAllSync();
+void Flu_SingleSg_Begin( const int lv, const int SaveSg_Flu, const int SaveSg_Mag );
+void Flu_SingleSg_Prepared( const int lv, const int NPG, const int *PID0_List );
+void Flu_SingleSg_End( const int lv );
 #ifndef SERIAL
 void Flu_AllocateFluxArray_Buffer( const int lv );
 #endif
+#ifdef SUPPORT_FLU_SUPER_BLOCK
+int  Flu_SuperBlock( const int lv, const double TimeNew, const double TimeOld, const double dt,
+                     const int SaveSg_Flu, const int SaveSg_Mag, const int NPG, int *PID0_List );
+void Flu_SuperBlock_MemAllocate( const int Flu_NPatchGroup );
+void Flu_SuperBlock_MemFree();
+#endif
 
 
 // GAMER
@@ -159,6 +174,9 @@ void EvolveLevel( const int lv, const double dTime_FaLv );
 void InvokeSolver( const Solver_t TSolver, const int lv, const double TimeNew, const double TimeOld, const double dt,
                    const double Poi_Coeff, const int SaveSg_Flu, const int SaveSg_Mag, const int SaveSg_Pot,
                    const bool OverlapMPI, const bool Overlap_Sync );
+void InvokeSolver_PatchList( const Solver_t TSolver, const int lv, const double TimeNew, const double TimeOld,
+                             const double dt, const double Poi_Coeff, const int NPG, const int *PID0_List,
+                             const bool Prepare );
 void Prepare_PatchData( const int lv, const double PrepTime, real *OutputCC, real *OutputFC,
                         const int GhostSize, const int NPG, const int *PID0_List, long TVarCC, long TVarFC,
                         const IntScheme_t IntScheme_CC, const IntScheme_t IntScheme_FC, const PrepUnit_t PrepUnit,
@@ -219,6 +237,8 @@ template <typename T> void  Mis_Heapsort( const int N, T Array[], int IdxTable[]
 template <typename T> int   Mis_Matching_char( const int N, const T Array[], const int M, const T Key[], char Match[] );
 template <typename T> int   Mis_Matching_int( const int N, const T Array[], const int M, const T Key[], int Match[] );
 template <typename T> bool  Mis_CompareRealValue( const T Input1, const T Input2, const char *comment, const bool Verbose );
+template <typename TDst, typename TSrc>
+void  Mis_CopyArray( TDst *Dst, const TSrc *Src, const long N );
 ulong  Mis_Idx3D2Idx1D( const int Size[], const int Idx3D[] );
 double Mis_GetTimeStep( const int lv, const double dTime_SyncFaLv, const double AutoReduceDtCoeff );
 double Mis_dTime2dt( const double Time_In, const double dTime_In );
@@ -406,11 +426,14 @@ void LB_GetBufferData( const int lv, const int FluSg, const int MagSg, const int
 real*LB_GetBufferData_MemAllocate_Send( const int NSend );
 real*LB_GetBufferData_MemAllocate_Recv( const int NRecv );
 void LB_GrandsonCheck( const int lv );
-void LB_Init_LoadBalance( const bool Redistribute, const double ParWeight, const bool Reset, const int TLv );
+void LB_Init_LoadBalance( const bool Redistribute, const double ParWeight, const bool Reset, const int TLv,
+                          const bool Incremental );
 void LB_Init_ByFunction();
 void LB_Init_Refine( const int FaLv );
 void LB_SetCutPoint( const int lv, const int NPG_Total, long *CutPoint, const bool InputLBIdx0AndLoad,
                      long *LBIdx0_AllRank_Input, double *Load_AllRank_Input, const double ParWeight );
+void LB_SetCutPoint_AllLevel( const double ParWeight );
+bool LB_SetCutPoint_Incremental( const int lv, long *CutPoint, const double ParWeight );
 void LB_EstimateWorkload_AllPatchGroup( const int lv, const double ParWeight, double *Load_PG );
 double LB_EstimateLoadImbalance();
 void LB_SetCutPoint( const int lv, long *CutPoint, const bool InputLBIdx0AndLoad, long *LBIdx0_AllRank_Input,
@@ -654,6 +677,11 @@ void CPU_SrcSolver( const real h_Flu_Array_In [][FLU_NIN_S ][ CUBE(SRC_NXT)
                     const SrcTerms_t SrcTerms, const int NPatchGroup, const real dt, const real dh,
                     const double TimeNew, const double TimeOld,
                     const real MinDens, const real MinPres, const real MinEint );
+#if ( MODEL == HYDRO )
+void Src_FuseFluid( real fluid[], const real B[], const real dt, const real dh,
+                    const double x, const double y, const double z, const double TimeNew, const double TimeOld,
+                    const real MinDens, const real MinPres, const real MinEint );
+#endif
 
 
 // Grackle
@@ -26,6 +26,7 @@ typedef void (*SrcFunc_t)( real fluid[], const real B[],
 //
 // Data Member :  Any                       : True if at least one of the source terms is activated
 //                Deleptonization           : SRC_DELEPTONIZATION
+//                Cooling                   : SRC_COOLING
 //                User                      : SRC_USER
 //                BoxCenter                 : Simulation box center
 //                Unit_*                    : Code units
@@ -38,6 +39,9 @@ typedef void (*SrcFunc_t)( real fluid[], const real B[],
 //                                            --> For GPU, Dlep_Profile_DataDevPtr[]/RadiusDevPtr[] store the
 //                                                addresses of global memory arrays, which should NOT be used by host
 //                Dlep_Profile_NBin         : Number of radial bins in Dlep_Profile_*
+//                Cool_TableDevPtr          : Cooling table pointer used by the cooling source term
+//                                            --> For GPU, it stores the address of a global memory array,
+//                                                which should NOT be used by host
 //
 // Method      :  None --> It seems that CUDA does not support functions in a struct
 //-------------------------------------------------------------------------------------------------------
@@ -46,6 +50,7 @@ struct SrcTerms_t
 
    bool   Any;
    bool   Deleptonization;
+   bool   Cooling;
    bool   User;
 
    double BoxCenter[3];
@@ -71,6 +76,14 @@ struct SrcTerms_t
    int       Dlep_Profile_NBin;
 #  endif
 
+// cooling
+#  if ( MODEL == HYDRO )
+   SrcFunc_t Cool_FuncPtr;
+   double   *Cool_AuxArrayDevPtr_Flt;
+   int      *Cool_AuxArrayDevPtr_Int;
+   real     *Cool_TableDevPtr;
+#  endif
+
 // user-specified source term
    SrcFunc_t User_FuncPtr;
    double   *User_AuxArrayDevPtr_Flt;
@@ -4,6 +4,7 @@
 
 
 #include "sys/time.h"
+#include "PerfCounter.h"
 
 void Aux_Error( const char *File, const int Line, const char *Func, const char *Format, ... );
 void Aux_Message( FILE *Type, const char *Format, ... );
@@ -17,6 +18,8 @@ void Aux_Message( FILE *Type, const char *Format, ... );
 //
 // Data Member :  Status : (false / true) <--> (stop / ticking)
 //                Time   : Variable recording the elapsed time (in microseconds)
+//                Perf   : Hardware counters measured together with the elapsed time (NULL --> disabled)
+//                         --> Allocated by Aux_CreateTimer() for OPT__TIMING_PERF and freed by the destructor
 //
 // Method      :  Timer_t  : Constructor
 //               ~Timer_t  : Destructor
@@ -30,8 +33,9 @@ struct Timer_t
 
 // data members
 // ===================================================================================
-   bool  Status;
-   ulong Time;
+   bool           Status;
+   ulong          Time;
+   PerfCounter_t *Perf;
 
 
 
@@ -45,6 +49,7 @@ struct Timer_t
    {
       Time   = 0;
       Status = false;
+      Perf   = NULL;
    }
 
 
@@ -57,6 +62,7 @@ struct Timer_t
    //===================================================================================
    ~Timer_t()
    {
+      delete Perf;
    }
 
 
@@ -81,6 +87,8 @@ struct Timer_t
 
       Time   = tv.tv_sec*1000000 + tv.tv_usec - Time;
       Status = true;
+
+      if ( Perf != NULL )  Perf->Start();
    }
 
 
@@ -97,6 +105,8 @@ struct Timer_t
       if ( !Status )    Aux_Message( stderr, "WARNING : timer has NOT been started !!\n" );
 #     endif
 
+      if ( Perf != NULL )  Perf->Stop();
+
       timeval tv;
       gettimeofday( &tv, NULL );
 
@@ -138,6 +148,8 @@ struct Timer_t
 #     endif
 
       Time = 0;
+
+      if ( Perf != NULL )  Perf->Reset();
    }
 
 
@@ -0,0 +1,177 @@
+#ifndef __TRACE_H__
+#define __TRACE_H__
+
+
+
+#include <time.h>
+
+#if (  ( defined __x86_64__  ||  defined __i386__ )  &&  !defined __CUDACC__  )
+#  include <x86intrin.h>
+#  define TRACE_USE_TSC
+#endif
+
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Structure   :  TraceEvent_t
+// Description :  Data structure storing a single completed trace scope
+//
+// Data Member :  Name  : Scope name (must be a string literal or any other static string)
+//                Lv    : Target AMR level (-1 if not applicable)
+//                Start : Clock tick when entering the scope
+//                End   : Clock tick when leaving the scope
+//-------------------------------------------------------------------------------------------------------
+struct TraceEvent_t
+{
+   const char *Name;
+   int         Lv;
+   ulong       Start;
+   ulong       End;
+}; // struct TraceEvent_t
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Structure   :  TraceBuf_t
+// Description :  Ring buffer recording the trace events of a single OpenMP thread
+//
+// Note        :  1. Each thread only writes to its own buffer --> no lock or atomic operation is required
+//                2. The oldest events are overwritten when the buffer is full
+//                   --> NRecord - NEvent = number of lost events
+//                3. Padded to a cache line to avoid false sharing between threads
+//
+// Data Member :  Event   : Event array with Trace_NEventMax elements
+//                Head    : Index in Event[] to store the next event
+//                NRecord : Number of events recorded since the last flush
+//-------------------------------------------------------------------------------------------------------
+struct TraceBuf_t
+{
+   TraceEvent_t *Event;
+   long          Head;
+   long          NRecord;
+   char          Padding[ 64 - sizeof(TraceEvent_t*) - 2*sizeof(long) ];
+}; // struct TraceBuf_t
+
+
+// global tracing variables defined in Aux_Trace.cpp
+extern bool        Trace_Active;
+extern long        Trace_NEventMax;
+extern TraceBuf_t *Trace_Buf;
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  Trace_GetTick
+// Description :  Return the current clock tick of a monotonic clock
+//
+// Note        :  1. Use the time-stamp counter (TSC) on x86, which costs only a few ns per call
+//                   --> Converted to nanoseconds in Aux_Trace_Flush() by calibrating against CLOCK_MONOTONIC
+//                2. Use CLOCK_MONOTONIC in nanoseconds on other architectures
+//-------------------------------------------------------------------------------------------------------
+inline ulong Trace_GetTick()
+{
+#  ifdef TRACE_USE_TSC
+   return __rdtsc();
+#  else
+   timespec ts;
+   clock_gettime( CLOCK_MONOTONIC, &ts );
+   return (ulong)ts.tv_sec*1000000000UL + (ulong)ts.tv_nsec;
+#  endif
+} // FUNCTION : Trace_GetTick
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Structure   :  TraceScope_t
+// Description :  Record the elapsed time of a code block by construction and destruction
+//
+// Note        :  1. Use the macro TRACE_SCOPE() instead of declaring this object directly
+//                2. Scopes can be nested arbitrarily and are recorded independently by each OpenMP thread
+//                3. Nothing is recorded if Trace_Active is false
+//
+// Data Member :  Buf   : Ring buffer of the current thread (NULL if tracing is inactive)
+//                Name  : Scope name
+//                Lv    : Target AMR level
+//                Start : Clock tick when entering the scope
+//
+// Method      :  TraceScope_t  : Constructor
+//               ~TraceScope_t  : Destructor
+//-------------------------------------------------------------------------------------------------------
+struct TraceScope_t
+{
+
+// data members
+// ===================================================================================
+   TraceBuf_t *Buf;
+   const char *Name;
+   int         Lv;
+   ulong       Start;
+
+
+
+   //===================================================================================
+   // Constructor :  TraceScope_t
+   // Description :  Record the starting tick
+   //===================================================================================
+   TraceScope_t( const char *Name_In, const int Lv_In )
+   {
+      if ( !Trace_Active )
+      {
+         Buf = NULL;
+         return;
+      }
+
+#     ifdef OPENMP
+      Buf   = Trace_Buf + omp_get_thread_num();
+#     else
+      Buf   = Trace_Buf;
+#     endif
+      Name  = Name_In;
+      Lv    = Lv_In;
+      Start = Trace_GetTick();
+   }
+
+
+
+   //===================================================================================
+   // Destructor  :  ~TraceScope_t
+   // Description :  Store the completed event in the ring buffer of the current thread
+   //===================================================================================
+   ~TraceScope_t()
+   {
+      if ( Buf == NULL )   return;
+
+      TraceEvent_t *Event = Buf->Event + Buf->Head;
+
+      Event->Name  = Name;
+      Event->Lv    = Lv;
+      Event->Start = Start;
+      Event->End   = Trace_GetTick();
+
+      if ( ++Buf->Head == Trace_NEventMax )  Buf->Head = 0;
+      Buf->NRecord ++;
+   }
+
+
+}; // struct TraceScope_t
+
+
+
+// macro for tracing a code block
+// --> usage: { TRACE_SCOPE( "Name", lv ); ... }
+#ifdef TIMING
+
+#  define TRACE_CONCAT_( a, b )    a##b
+#  define TRACE_CONCAT( a, b )     TRACE_CONCAT_( a, b )
+#  define TRACE_SCOPE( name, lv )  TraceScope_t TRACE_CONCAT( TraceScope_, __LINE__ )( name, lv )
+
+#else
+
+#  define TRACE_SCOPE( name, lv )
+
+#endif
+
+
+
+#endif // #ifndef __TRACE_H__
@@ -22,6 +22,14 @@ typedef double real;
 typedef float  real;
 #endif
 
+// precision of the grid data stored in patches (i.e., fluid, magnetic, pot, and pot_ext)
+// --> MIXED_PRECISION: store in single precision but compute in double precision (i.e., FLOAT8)
+#ifdef MIXED_PRECISION
+typedef float  real_store;
+#else
+typedef real   real_store;
+#endif
+
 
 // short names for unsigned type
 typedef unsigned short     ushort;
@@ -169,7 +177,7 @@ const Check_t
 // target solver in InvokeSolver()
 // --> must start from 0 because of the current TIMING_SOLVER implementation
 // --> when adding new solvers, please modify the NSOLVER constant accordingly
-const int NSOLVER = 7;
+const int NSOLVER = 8;
 
 typedef int Solver_t;
 const Solver_t
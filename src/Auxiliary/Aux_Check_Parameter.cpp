@@ -31,6 +31,10 @@ void Aux_Check_Parameter()
 #     error : ERROR : something is wrong in OpenMP; the macro "_OPENMP" is NOT defined !!
 #  endif
 
+#  if ( defined MIXED_PRECISION  &&  !defined FLOAT8 )
+#     error : ERROR : MIXED_PRECISION must work with FLOAT8 !!
+#  endif
+
 #  if ( defined OVERLAP_MPI  &&  !defined LOAD_BALANCE )
 #     error : ERROR : OVERLAP_MPI must work with LOAD_BALANCE !!
 #  endif
@@ -98,6 +102,11 @@ void Aux_Check_Parameter()
       Aux_Error( ERROR_INFO, "please turn on SUPPORT_HDF5 in the Makefile for OPT__OUTPUT_TOTAL == 1 !!\n" );
 #  endif
 
+#  ifdef MIXED_PRECISION
+   if ( OPT__OUTPUT_TOTAL == OUTPUT_FORMAT_CBINARY )
+      Aux_Error( ERROR_INFO, "MIXED_PRECISION does not support OPT__OUTPUT_TOTAL == 2 (C-binary) !!\n" );
+#  endif
+
    if (  ( OPT__OUTPUT_PART == OUTPUT_YZ  ||  OPT__OUTPUT_PART == OUTPUT_Y  ||  OPT__OUTPUT_PART == OUTPUT_Z )  &&
          ( OUTPUT_PART_X < 0.0  ||  OUTPUT_PART_X >= amr->BoxSize[0] )  )
       Aux_Error( ERROR_INFO, "incorrect OUTPUT_PART_X (out of range [0<=X<%lf]) !!\n", amr->BoxSize[0] );
@@ -421,6 +430,9 @@ void Aux_Check_Parameter()
       Aux_Error( ERROR_INFO, "\"%s\" is required for \"%s\" in LOAD_BALANCE --> check LB_RecordExchangeFixUpDataPatchID() !!\n",
                  "Flu_ParaBuf < PATCH_SIZE", "OPT__FIXUP_FLUX" );
 
+   if ( OPT__LB_ALL_LEVEL  &&  OPT__LB_INCREMENTAL > 0 )
+      Aux_Error( ERROR_INFO, "OPT__LB_INCREMENTAL does not support OPT__LB_ALL_LEVEL !!\n" );
+
 // ensure that the variable "PaddedCr1D" will not overflow
    const int Padded              = 1<<NLEVEL;
    const int BoxNScale_Padded[3] = { amr->BoxScale[0]/PATCH_SIZE + 2*Padded,
@@ -660,10 +672,6 @@ void Aux_Check_Parameter()
       Aux_Error( ERROR_INFO, "EOS_NUCLEAR is not supported yet !!\n" );
 #  endif
 
-#  if ( EOS == EOS_TABULAR )
-      Aux_Error( ERROR_INFO, "EOS_TABULAR is not supported yet !!\n" );
-#  endif
-
 #  ifdef BAROTROPIC_EOS
 #     if ( EOS == EOS_GAMMA  ||  EOS == EOS_NUCLEAR )
 #        error : ERROR : BAROTROPIC_EOS is incompatible with EOS_GAMMA/EOS_NUCLEAR !!
@@ -1354,8 +1362,43 @@ void Aux_Check_Parameter()
 #  if ( MODEL != HYDRO )
    if ( SrcTerms.Deleptonization )
       Aux_Error( ERROR_INFO, "SRC_DELEPTONIZATION is only supported in HYDRO !!\n" );
+
+   if ( SrcTerms.Cooling )
+      Aux_Error( ERROR_INFO, "SRC_COOLING is only supported in HYDRO !!\n" );
 #  endif
 
+#  if ( MODEL == HYDRO )
+   if ( SrcTerms.Cooling )
+   {
+      if ( !OPT__UNIT )
+         Aux_Error( ERROR_INFO, "SRC_COOLING requires OPT__UNIT !!\n" );
+
+#     if ( EOS != EOS_GAMMA )
+      Aux_Error( ERROR_INFO, "SRC_COOLING only supports EOS_GAMMA !!\n" );
+#     endif
+
+#     ifdef COMOVING
+      Aux_Error( ERROR_INFO, "SRC_COOLING does not support COMOVING yet !!\n" );
+#     endif
+
+#     ifdef SUPPORT_GRACKLE
+      if ( GRACKLE_ACTIVATE )
+         Aux_Error( ERROR_INFO, "SRC_COOLING and GRACKLE_ACTIVATE cannot be enabled at the same time !!\n" );
+#     endif
+   }
+#  endif
+
+   if ( SRC_FUSE_FLUID )
+   {
+#     if ( MODEL != HYDRO  ||  ( FLU_SCHEME != MHM && FLU_SCHEME != MHM_RP && FLU_SCHEME != CTU ) )
+      Aux_Error( ERROR_INFO, "SRC_FUSE_FLUID only supports the MHM/MHM_RP/CTU schemes in HYDRO !!\n" );
+#     endif
+
+#     ifdef GPU
+      Aux_Error( ERROR_INFO, "SRC_FUSE_FLUID does not support GPU yet !!\n" );
+#     endif
+   }
+
    if ( SRC_GPU_NPGROUP % GPU_NSTREAM != 0 )
       Aux_Error( ERROR_INFO, "SRC_GPU_NPGROUP (%d) %% GPU_NSTREAM (%d) != 0 !!\n",
                  SRC_GPU_NPGROUP, GPU_NSTREAM );
@@ -1369,6 +1412,9 @@ void Aux_Check_Parameter()
 // ------------------------------
    if ( MPI_Rank == 0 ) {
 
+   if ( SRC_FUSE_FLUID  &&  !SrcTerms.Any )
+      Aux_Message( stderr, "WARNING : SRC_FUSE_FLUID is useless since no source term is enabled !!\n" );
+
    } // if ( MPI_Rank == 0 )
 
 
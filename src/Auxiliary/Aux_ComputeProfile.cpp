@@ -280,15 +280,15 @@ void Aux_ComputeProfile( Profile_t *Prof[], const double Center[], const double
                continue;
 
 
-            const real (*FluidPtr)[PS1][PS1][PS1] = amr->patch[ FluSg ][lv][PID]->fluid;
+            const real_store (*FluidPtr)[PS1][PS1][PS1] = amr->patch[ FluSg ][lv][PID]->fluid;
 #           ifdef GRAVITY
-            const real (*PotPtr  )[PS1][PS1]      = amr->patch[ PotSg ][lv][PID]->pot;
+            const real_store (*PotPtr  )[PS1][PS1]      = amr->patch[ PotSg ][lv][PID]->pot;
 #           endif
 
 //          pointer for temporal interpolation
-            const real (*FluidPtr_IntT)[PS1][PS1][PS1] = ( FluIntTime ) ? amr->patch[ FluSg_IntT ][lv][PID]->fluid : NULL;
+            const real_store (*FluidPtr_IntT)[PS1][PS1][PS1] = ( FluIntTime ) ? amr->patch[ FluSg_IntT ][lv][PID]->fluid : NULL;
 #           ifdef GRAVITY
-            const real (*PotPtr_IntT  )[PS1][PS1]      = ( PotIntTime ) ? amr->patch[ PotSg_IntT ][lv][PID]->pot   : NULL;
+            const real_store (*PotPtr_IntT  )[PS1][PS1]      = ( PotIntTime ) ? amr->patch[ PotSg_IntT ][lv][PID]->pot   : NULL;
 #           endif
 
 
@@ -0,0 +1,230 @@
+#include "GAMER.h"
+
+#ifdef __linux__
+#  include <errno.h>
+#  include <sys/syscall.h>
+#  include <linux/perf_event.h>
+#endif
+
+
+// global hardware counter variables declared in "PerfCounter.h"
+bool Perf_Active               = false;
+bool Perf_EventOn[NPERF_EVENT] = { false, false, false, false };
+
+// file descriptors of all events in all OpenMP threads
+static int (*Perf_FD)[NPERF_EVENT] = NULL;
+
+#ifdef __linux__
+static int OpenEvent( const int Event );
+#endif
+
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  Aux_PerfCounter_Init
+// Description :  Open the hardware performance counters for OPT__TIMING_PERF
+//
+// Note        :  1. Invoked by Init_GAMER()
+//                2. Use the Linux system call perf_event_open()
+//                   --> Each OpenMP thread opens the counters of itself, which are then read by the master thread
+//                       in Aux_PerfCounter_Read()
+//                   --> Threads created after this function (e.g., by nested parallel regions) are not measured
+//                3. Events unavailable on any thread of any rank are disabled on all ranks with a warning
+//                   --> Common reasons are unsupported events in virtual machines and /proc/sys/kernel/perf_event_paranoid
+//                   --> Perf_Active is false if no event is available, in which case the timing results are
+//                       unaffected
+//                4. Only user-space events are measured
+//-------------------------------------------------------------------------------------------------------
+void Aux_PerfCounter_Init()
+{
+
+   if ( !OPT__TIMING_PERF )   return;
+
+   if ( MPI_Rank == 0 )    Aux_Message( stdout, "%s ... ", __FUNCTION__ );
+
+
+#  ifdef __linux__
+
+   const char EventName[NPERF_EVENT][MAX_STRING] = { "cycles", "instructions", "LLC misses", "raw event" };
+
+   int EventOn[NPERF_EVENT], ErrNo[NPERF_EVENT];
+
+   for (int e=0; e<NPERF_EVENT; e++)
+   {
+      EventOn[e] = ( e != PERF_RAW  ||  OPT__TIMING_PERF_RAW > 0 );
+      ErrNo  [e] = 0;
+   }
+
+
+// 1. open the counters of each thread
+   Perf_FD = new int [OMP_NTHREAD][NPERF_EVENT];
+
+#  pragma omp parallel num_threads( OMP_NTHREAD )
+   {
+#     ifdef OPENMP
+      const int TID = omp_get_thread_num();
+#     else
+      const int TID = 0;
+#     endif
+
+      for (int e=0; e<NPERF_EVENT; e++)
+      {
+         Perf_FD[TID][e] = ( EventOn[e] ) ? OpenEvent( e ) : -1;
+
+         if ( Perf_FD[TID][e] < 0  &&  EventOn[e]  &&  TID == 0 )    ErrNo[e] = errno;
+      }
+   }
+
+
+// 2. disable events unavailable on any thread of any rank
+   for (int e=0; e<NPERF_EVENT; e++)
+   {
+      if ( !EventOn[e] )   continue;
+
+      for (int t=0; t<OMP_NTHREAD; t++)
+      {
+         if ( Perf_FD[t][e] < 0 )
+         {
+            Aux_Message( stderr, "WARNING : cannot open the hardware counter of %s on rank %d, thread %d (%s) !!\n",
+                         EventName[e], MPI_Rank, t, (ErrNo[e]!=0)?strerror(ErrNo[e]):"unknown error" );
+            EventOn[e] = false;
+            break;
+         }
+      }
+   }
+
+   int EventOn_AllRank[NPERF_EVENT];
+
+   MPI_Allreduce( EventOn, EventOn_AllRank, NPERF_EVENT, MPI_INT, MPI_MIN, MPI_COMM_WORLD );
+
+   for (int e=0; e<NPERF_EVENT; e++)
+   {
+      Perf_EventOn[e] = EventOn_AllRank[e];
+      Perf_Active    |= Perf_EventOn[e];
+
+      if ( !Perf_EventOn[e] )
+      for (int t=0; t<OMP_NTHREAD; t++)
+      {
+         if ( Perf_FD[t][e] >= 0 )  close( Perf_FD[t][e] );
+         Perf_FD[t][e] = -1;
+      }
+   }
+
+   if ( MPI_Rank == 0 )    Aux_Message( stdout, "done\n" );
+
+   if ( !Perf_Active  &&  MPI_Rank == 0 )
+      Aux_Message( stderr, "WARNING : no hardware counter is available --> OPT__TIMING_PERF has no effect !!\n" );
+
+#  else // #ifdef __linux__
+
+   if ( MPI_Rank == 0 )
+   {
+      Aux_Message( stdout, "done\n" );
+      Aux_Message( stderr, "WARNING : OPT__TIMING_PERF is only supported on Linux --> it has no effect !!\n" );
+   }
+
+#  endif // #ifdef __linux__ ... else ...
+
+} // FUNCTION : Aux_PerfCounter_Init
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  Aux_PerfCounter_End
+// Description :  Close all hardware performance counters
+//
+// Note        :  1. Invoked by End_GAMER()
+//-------------------------------------------------------------------------------------------------------
+void Aux_PerfCounter_End()
+{
+
+   if ( Perf_FD == NULL )  return;
+
+   for (int t=0; t<OMP_NTHREAD; t++)
+   for (int e=0; e<NPERF_EVENT; e++)
+      if ( Perf_FD[t][e] >= 0 )  close( Perf_FD[t][e] );
+
+   delete [] Perf_FD;
+   Perf_FD     = NULL;
+   Perf_Active = false;
+
+} // FUNCTION : Aux_PerfCounter_End
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  Aux_PerfCounter_Read
+// Description :  Return the current counts of all events summed over all OpenMP threads
+//
+// Note        :  1. Invoked by PerfCounter_t::Start() and PerfCounter_t::Stop()
+//                2. Counts are extrapolated by the ratio of the enabled and running times when the kernel
+//                   multiplexes more events than the available hardware counters
+//                3. Disabled events always return zero
+//
+// Parameter   :  Count : Array to store the results
+//-------------------------------------------------------------------------------------------------------
+void Aux_PerfCounter_Read( ulong Count[] )
+{
+
+   for (int e=0; e<NPERF_EVENT; e++)   Count[e] = 0;
+
+#  ifdef __linux__
+   ulong Value[3];   // [0/1/2] = count/time enabled/time running
+
+   for (int t=0; t<OMP_NTHREAD; t++)
+   for (int e=0; e<NPERF_EVENT; e++)
+   {
+      if ( !Perf_EventOn[e] )    continue;
+
+      if ( read( Perf_FD[t][e], Value, sizeof(Value) ) != sizeof(Value) )  continue;
+
+      if ( Value[2] > 0  &&  Value[2] < Value[1] )
+         Count[e] += (ulong)( (double)Value[0]*Value[1]/Value[2] );
+      else
+         Count[e] += Value[0];
+   }
+#  endif
+
+} // FUNCTION : Aux_PerfCounter_Read
+
+
+
+#ifdef __linux__
+//-------------------------------------------------------------------------------------------------------
+// Function    :  OpenEvent
+// Description :  Open the hardware counter of the target event for the calling thread
+//
+// Note        :  1. Counting starts immediately and is never disabled
+//                   --> PerfCounter_t only takes differences
+//
+// Parameter   :  Event : PERF_CYCLE/PERF_INST/PERF_LLC/PERF_RAW
+//
+// Return      :  File descriptor of the counter (<0 on failure with errno set)
+//-------------------------------------------------------------------------------------------------------
+int OpenEvent( const int Event )
+{
+
+   perf_event_attr Attr;
+   memset( &Attr, 0, sizeof(Attr) );
+
+   Attr.size           = sizeof(Attr);
+   Attr.disabled       = 0;
+   Attr.exclude_kernel = 1;
+   Attr.exclude_hv     = 1;
+   Attr.read_format    = PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+
+   switch ( Event )
+   {
+      case PERF_CYCLE : Attr.type = PERF_TYPE_HARDWARE;  Attr.config = PERF_COUNT_HW_CPU_CYCLES;    break;
+      case PERF_INST  : Attr.type = PERF_TYPE_HARDWARE;  Attr.config = PERF_COUNT_HW_INSTRUCTIONS;  break;
+      case PERF_LLC   : Attr.type = PERF_TYPE_HARDWARE;  Attr.config = PERF_COUNT_HW_CACHE_MISSES;  break;
+      case PERF_RAW   : Attr.type = PERF_TYPE_RAW;       Attr.config = OPT__TIMING_PERF_RAW;        break;
+      default         : Aux_Error( ERROR_INFO, "unsupported event %d !!\n", Event );
+   }
+
+// pid = 0 and cpu = -1 --> measure the calling thread on any CPU
+   return syscall( __NR_perf_event_open, &Attr, 0, -1, -1, 0 );
+
+} // FUNCTION : OpenEvent
+#endif // #ifdef __linux__
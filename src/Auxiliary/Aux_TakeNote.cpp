@@ -277,6 +277,12 @@ void Aux_TakeNote()
       fprintf( Note, "FLOAT8                          OFF\n" );
 #     endif
 
+#     ifdef MIXED_PRECISION
+      fprintf( Note, "MIXED_PRECISION                 ON\n" );
+#     else
+      fprintf( Note, "MIXED_PRECISION                 OFF\n" );
+#     endif
+
 #     ifdef SERIAL
       fprintf( Note, "SERIAL                          ON\n" );
 #     else
@@ -557,6 +563,7 @@ void Aux_TakeNote()
       fprintf( Note, "#define SRC_NAUX_DLEP           %d\n",      SRC_NAUX_DLEP         );
       fprintf( Note, "#define SRC_DLEP_PROF_NVAR      %d\n",      SRC_DLEP_PROF_NVAR    );
       fprintf( Note, "#define SRC_DLEP_PROF_NBINMAX   %d\n",      SRC_DLEP_PROF_NBINMAX );
+      fprintf( Note, "#define SRC_NAUX_COOL           %d\n",      SRC_NAUX_COOL         );
       fprintf( Note, "#define SRC_NAUX_USER           %d\n",      SRC_NAUX_USER         );
 #     ifdef GPU
       fprintf( Note, "#define FLU_BLOCK_SIZE_X        %d\n",      FLU_BLOCK_SIZE_X      );
@@ -748,6 +755,7 @@ void Aux_TakeNote()
       fprintf( Note, "AUTO_REDUCE_DT                  %d\n",      AUTO_REDUCE_DT            );
       fprintf( Note, "AUTO_REDUCE_DT_FACTOR           %13.7e\n",  AUTO_REDUCE_DT_FACTOR     );
       fprintf( Note, "AUTO_REDUCE_DT_FACTOR_MIN       %13.7e\n",  AUTO_REDUCE_DT_FACTOR_MIN );
+      fprintf( Note, "AUTO_REDUCE_DT_LOCAL            %d\n",      AUTO_REDUCE_DT_LOCAL      );
       fprintf( Note, "OPT__RECORD_DT                  %d\n",      OPT__RECORD_DT            );
       fprintf( Note, "***********************************************************************************\n" );
       fprintf( Note, "\n\n");
@@ -800,6 +808,7 @@ void Aux_TakeNote()
 #     endif
       fprintf( Note, "OPT__REUSE_MEMORY               %d\n",      OPT__REUSE_MEMORY         );
       fprintf( Note, "OPT__MEMORY_POOL                %d\n",      OPT__MEMORY_POOL          );
+      fprintf( Note, "OPT__SINGLE_SANDGLASS           %d\n",      OPT__SINGLE_SANDGLASS     );
       fprintf( Note, "***********************************************************************************\n" );
       fprintf( Note, "\n\n");
 
@@ -819,6 +828,10 @@ void Aux_TakeNote()
       fprintf( Note, "LB_PAR_WEIGHT                   %13.7e\n",  amr->LB->Par_Weight       );
 #     endif
       fprintf( Note, "OPT__RECORD_LOAD_BALANCE        %d\n",      OPT__RECORD_LOAD_BALANCE  );
+      fprintf( Note, "OPT__LB_ALL_LEVEL               %d\n",      OPT__LB_ALL_LEVEL         );
+      fprintf( Note, "OPT__LB_INCREMENTAL             %d\n",      OPT__LB_INCREMENTAL       );
+      fprintf( Note, "OPT__LB_INC_MAX_SHIFT           %13.7e\n",  OPT__LB_INC_MAX_SHIFT     );
+      fprintf( Note, "OPT__LB_SPARSE_COMM             %d\n",      OPT__LB_SPARSE_COMM       );
 #     endif // #ifdef LOAD_BALANCE
       fprintf( Note, "OPT__MINIMIZE_MPI_BARRIER       %d\n",      OPT__MINIMIZE_MPI_BARRIER );
       fprintf( Note, "***********************************************************************************\n" );
@@ -831,7 +844,15 @@ void Aux_TakeNote()
       fprintf( Note, "***********************************************************************************\n" );
       fprintf( Note, "SRC_ANY                         %d\n",      SrcTerms.Any              );
       fprintf( Note, "SRC_DELEPTONIZATION             %d\n",      SrcTerms.Deleptonization  );
+#     if ( MODEL == HYDRO )
+      fprintf( Note, "SRC_COOLING                     %d\n",      SrcTerms.Cooling          );
+      if ( SrcTerms.Cooling ) {
+      fprintf( Note, "SRC_COOLING_TABLE               %s\n",      SRC_COOLING_TABLE         );
+      fprintf( Note, "SRC_COOLING_REDSHIFT            %13.7e\n",  SRC_COOLING_REDSHIFT      );
+      fprintf( Note, "SRC_COOLING_METAL               %13.7e\n",  SRC_COOLING_METAL         ); }
+#     endif
       fprintf( Note, "SRC_USER                        %d\n",      SrcTerms.User             );
+      fprintf( Note, "SRC_FUSE_FLUID                  %d\n",      SRC_FUSE_FLUID            );
       fprintf( Note, "SRC_GPU_NPGROUP                 %d\n",      SRC_GPU_NPGROUP           );
       fprintf( Note, "***********************************************************************************\n" );
       fprintf( Note, "\n\n");
@@ -888,6 +909,19 @@ void Aux_TakeNote()
       fprintf( Note, "GAMMA                           %13.7e\n",  GAMMA                   );
       fprintf( Note, "MOLECULAR_WEIGHT                %13.7e\n",  MOLECULAR_WEIGHT        );
       fprintf( Note, "ISO_TEMP                        %13.7e\n",  ISO_TEMP                );
+#     if ( EOS == EOS_TABULAR )
+      fprintf( Note, "EOS_TAB_NAME                    %s\n",      EOS_TAB_NAME            );
+      fprintf( Note, "EOS_TAB_NDENS                   %d\n",      EOS_TAB_NDENS           );
+      fprintf( Note, "EOS_TAB_NSEINT                  %d\n",      EOS_TAB_NSEINT          );
+      fprintf( Note, "EOS_TAB_NYE                     %d\n",      EOS_TAB_NYE             );
+      fprintf( Note, "EOS_TAB_NPRES                   %d\n",      EOS_TAB_NPRES           );
+      fprintf( Note, "EOS_TAB_LOGDENS_MIN            %14.7e\n",   EOS_TAB_LOGDENS_MIN     );
+      fprintf( Note, "EOS_TAB_LOGDENS_MAX            %14.7e\n",   EOS_TAB_LOGDENS_MAX     );
+      fprintf( Note, "EOS_TAB_LOGSEINT_MIN           %14.7e\n",   EOS_TAB_LOGSEINT_MIN    );
+      fprintf( Note, "EOS_TAB_LOGSEINT_MAX           %14.7e\n",   EOS_TAB_LOGSEINT_MAX    );
+      fprintf( Note, "EOS_TAB_YE_MIN                  %13.7e\n",  EOS_TAB_YE_MIN          );
+      fprintf( Note, "EOS_TAB_YE_MAX                  %13.7e\n",  EOS_TAB_YE_MAX          );
+#     endif
       fprintf( Note, "MINMOD_COEFF                    %13.7e\n",  MINMOD_COEFF            );
       fprintf( Note, "OPT__LR_LIMITER                 %s\n",      ( OPT__LR_LIMITER == VANLEER           ) ? "VANLEER"    :
                                                                   ( OPT__LR_LIMITER == GMINMOD           ) ? "GMINMOD"    :
@@ -906,6 +940,8 @@ void Aux_TakeNote()
                                                                   ( OPT__1ST_FLUX_CORR_SCHEME == RSOLVER_1ST_HLLD ) ? "RSOLVER_1ST_HLLD" :
                                                                   ( OPT__1ST_FLUX_CORR_SCHEME == RSOLVER_1ST_NONE ) ? "NONE"             :
                                                                                                                 "UNKNOWN" );
+      fprintf( Note, "OPT__FLU_SUPER_BLOCK            %d\n",      OPT__FLU_SUPER_BLOCK      );
+      fprintf( Note, "OPT__FLU_SLAB                   %d\n",      OPT__FLU_SLAB             );
 
 #     elif ( MODEL == ELBDM )
       if ( OPT__UNIT ) {
@@ -1197,6 +1233,12 @@ void Aux_TakeNote()
       fprintf( Note, "OPT__TIMING_BARRIER             %d\n",      OPT__TIMING_BARRIER      );
       fprintf( Note, "OPT__TIMING_BALANCE             %d\n",      OPT__TIMING_BALANCE      );
       fprintf( Note, "OPT__TIMING_MPI                 %d\n",      OPT__TIMING_MPI          );
+      fprintf( Note, "OPT__TIMING_TRACE               %d\n",      OPT__TIMING_TRACE        );
+      if ( OPT__TIMING_TRACE )
+      fprintf( Note, "OPT__TIMING_TRACE_NEVENT        %d\n",      OPT__TIMING_TRACE_NEVENT );
+      fprintf( Note, "OPT__TIMING_PERF                %d\n",      OPT__TIMING_PERF         );
+      if ( OPT__TIMING_PERF )
+      fprintf( Note, "OPT__TIMING_PERF_RAW            0x%lx\n",   OPT__TIMING_PERF_RAW     );
       fprintf( Note, "OPT__RECORD_NOTE                %d\n",      OPT__RECORD_NOTE         );
       fprintf( Note, "OPT__RECORD_UNPHY               %d\n",      OPT__RECORD_UNPHY        );
       fprintf( Note, "OPT__RECORD_MEMORY              %d\n",      OPT__RECORD_MEMORY       );
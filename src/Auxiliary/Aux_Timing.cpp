@@ -6,6 +6,7 @@ void Timing__EvolveLevel( const char FileName[], const double Time_LB_Main[][3]
 #ifdef TIMING_SOLVER
 void Timing__Solver( const char FileName[] );
 #endif
+void Timing__PerfCounter( const char FileName[] );
 
 
 // global timing variables
@@ -110,6 +111,24 @@ void Aux_CreateTimer()
    } // for (int lv=0; lv<NLEVEL; lv++)
 
 
+// attach the hardware counters for OPT__TIMING_PERF
+// --> they are freed by the Timer_t destructor
+   if ( OPT__TIMING_PERF )
+   for (int lv=0; lv<NLEVEL; lv++)
+   {
+      Timer_Flu_Advance[lv]->Perf = new PerfCounter_t;
+
+#     ifdef TIMING_SOLVER
+      for (int v=0; v<NSOLVER; v++)
+      {
+         Timer_Pre[lv][v]->Perf = new PerfCounter_t;
+         Timer_Sol[lv][v]->Perf = new PerfCounter_t;
+         Timer_Clo[lv][v]->Perf = new PerfCounter_t;
+      }
+#     endif
+   }
+
+
    if ( MPI_Rank == 0 )    Aux_Message( stdout, "done\n" );
 
 } // FUNCTION : Aux_CreateTimer
@@ -361,6 +380,10 @@ void Aux_Record_Timing()
 #  endif
 
 
+// 4. hardware counters
+   if ( Perf_Active )   Timing__PerfCounter( FileName );
+
+
    if ( MPI_Rank == 0 )
    {
       FILE *File = fopen( FileName, "a" );
@@ -943,6 +966,156 @@ void Timing__Solver( const char FileName[] )
 
 
 
+//-------------------------------------------------------------------------------------------------------
+// Function    :  Timing__AddPerf
+// Description :  Add the elapsed time and hardware counts of the input timer to Time and Count[]
+//-------------------------------------------------------------------------------------------------------
+static void Timing__AddPerf( Timer_t *Timer, double &Time, double Count[] )
+{
+
+   Time += Timer->GetValue();
+
+   if ( Timer->Perf != NULL )
+   for (int e=0; e<NPERF_EVENT; e++)   Count[e] += (double)Timer->Perf->Count[e];
+
+} // FUNCTION : Timing__AddPerf
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  Timing__PerfCounter
+// Description :  Record the hardware counters for the option "OPT__TIMING_PERF"
+//
+// Note        :  1. Counts are summed over all OpenMP threads and MPI ranks while the elapsed time is the
+//                   MAXIMUM value of all ranks
+//                2. Derived quantities:
+//                   IPC     : instructions per cycle
+//                   BW_LLC  : LLC misses times the cache-line size (assumed to be 64 bytes) per second
+//                             --> Rough estimate of the main-memory bandwidth in GB/s
+//                   GFLOP/s : Raw events per second
+//                             --> Meaningful only when OPT__TIMING_PERF_RAW counts floating-point operations
+//                3. Only the fluid solver is recorded without TIMING_SOLVER
+//                4. Poi_* combine POISSON_SOLVER, GRAVITY_SOLVER, and POISSON_AND_GRAVITY_SOLVER
+//-------------------------------------------------------------------------------------------------------
+void Timing__PerfCounter( const char FileName[] )
+{
+
+   const int    NScope_Max = 7;
+   const char   ScopeName[NScope_Max][8] = { "Flu_Adv", "Flu_Pre", "Flu_Sol", "Flu_Clo", "Poi_Pre", "Poi_Sol", "Poi_Clo" };
+   const double CacheLine = 64.0;
+#  ifdef TIMING_SOLVER
+#  ifdef GRAVITY
+   const int    NScope     = 7;
+#  else
+   const int    NScope     = 4;
+#  endif
+#  else
+   const int    NScope     = 1;
+#  endif
+
+   double Time_loc [NScope_Max][NLEVEL], Count_loc[NScope_Max][NLEVEL][NPERF_EVENT];
+   double Time_max [NScope_Max][NLEVEL], Count_sum[NScope_Max][NLEVEL][NPERF_EVENT];
+
+
+// collect the local results
+   for (int s=0; s<NScope_Max; s++)
+   for (int lv=0; lv<NLEVEL; lv++)
+   {
+      Time_loc[s][lv] = 0.0;
+      for (int e=0; e<NPERF_EVENT; e++)   Count_loc[s][lv][e] = 0.0;
+   }
+
+   for (int lv=0; lv<NLEVEL; lv++)
+   {
+      Timing__AddPerf( Timer_Flu_Advance[lv], Time_loc[0][lv], Count_loc[0][lv] );
+
+#     ifdef TIMING_SOLVER
+      Timing__AddPerf( Timer_Pre[lv][FLUID_SOLVER], Time_loc[1][lv], Count_loc[1][lv] );
+      Timing__AddPerf( Timer_Sol[lv][FLUID_SOLVER], Time_loc[2][lv], Count_loc[2][lv] );
+      Timing__AddPerf( Timer_Clo[lv][FLUID_SOLVER], Time_loc[3][lv], Count_loc[3][lv] );
+
+#     ifdef GRAVITY
+      for (int v=POISSON_SOLVER; v<=POISSON_AND_GRAVITY_SOLVER; v++)
+      {
+         Timing__AddPerf( Timer_Pre[lv][v], Time_loc[4][lv], Count_loc[4][lv] );
+         Timing__AddPerf( Timer_Sol[lv][v], Time_loc[5][lv], Count_loc[5][lv] );
+         Timing__AddPerf( Timer_Clo[lv][v], Time_loc[6][lv], Count_loc[6][lv] );
+      }
+#     endif
+#     endif // #ifdef TIMING_SOLVER
+   }
+
+   MPI_Reduce( Time_loc [0],    Time_max [0],    NScope_Max*NLEVEL,             MPI_DOUBLE, MPI_MAX, 0, MPI_COMM_WORLD );
+   MPI_Reduce( Count_loc[0][0], Count_sum[0][0], NScope_Max*NLEVEL*NPERF_EVENT, MPI_DOUBLE, MPI_SUM, 0, MPI_COMM_WORLD );
+
+
+   if ( MPI_Rank == 0 )
+   {
+//    sum over all levels (printed as lv == NLEVEL below)
+      double Time_AllLv[NScope_Max], Count_AllLv[NScope_Max][NPERF_EVENT];
+
+      for (int s=0; s<NScope; s++)
+      {
+         Time_AllLv[s] = 0.0;
+         for (int e=0; e<NPERF_EVENT; e++)   Count_AllLv[s][e] = 0.0;
+
+         for (int lv=0; lv<NLEVEL; lv++)
+         {
+            Time_AllLv[s] += Time_max[s][lv];
+            for (int e=0; e<NPERF_EVENT; e++)   Count_AllLv[s][e] += Count_sum[s][lv][e];
+         }
+      }
+
+
+      FILE *File = fopen( FileName, "a" );
+
+      fprintf( File, "\nHardware counters (summed over all threads and ranks)\n" );
+      fprintf( File, "---------------------------------------------------------------------------------------" );
+      fprintf( File, "---------------------------------------\n" );
+      fprintf( File, "%3s%10s%10s%12s%12s%12s%12s%8s%10s%10s\n",
+               "Lv", "Scope", "Time", "Cycles", "Inst", "LLC_Miss", "Raw", "IPC", "BW_LLC", "GFLOP/s" );
+
+      for (int lv=0; lv<=NLEVEL; lv++)
+      for (int s=0; s<NScope; s++)
+      {
+         const double  Time  = ( lv == NLEVEL ) ? Time_AllLv [s] : Time_max [s][lv];
+         const double *Count = ( lv == NLEVEL ) ? Count_AllLv[s] : Count_sum[s][lv];
+
+         if ( Time <= 0.0 )   continue;
+
+         if ( lv == NLEVEL )  fprintf( File, "%3s%10s%10.4f", "Sum", ScopeName[s], Time );
+         else                 fprintf( File, "%3d%10s%10.4f", lv,    ScopeName[s], Time );
+
+         for (int e=0; e<NPERF_EVENT; e++)
+         {
+            if ( Perf_EventOn[e] )  fprintf( File, "%12.4e", Count[e] );
+            else                    fprintf( File, "%12s",   "N/A" );
+         }
+
+         if ( Perf_EventOn[PERF_CYCLE]  &&  Perf_EventOn[PERF_INST]  &&  Count[PERF_CYCLE] > 0.0 )
+                                    fprintf( File, "%8.3f",  Count[PERF_INST]/Count[PERF_CYCLE] );
+         else                       fprintf( File, "%8s",    "N/A" );
+
+         if ( Perf_EventOn[PERF_LLC] )
+                                    fprintf( File, "%10.3f", Count[PERF_LLC]*CacheLine/Time*1.0e-9 );
+         else                       fprintf( File, "%10s",   "N/A" );
+
+         if ( Perf_EventOn[PERF_RAW] )
+                                    fprintf( File, "%10.3f", Count[PERF_RAW]/Time*1.0e-9 );
+         else                       fprintf( File, "%10s",   "N/A" );
+
+         fprintf( File, "\n" );
+      } // for lv, s
+
+      fprintf( File, "\n" );
+
+      fclose( File );
+   } // if ( MPI_Rank == 0 )
+
+} // FUNCTION : Timing__PerfCounter
+
+
+
 //-------------------------------------------------------------------------------------------------------
 // Function    :  Aux_AccumulatedTiming
 // Description :  Record the accumulated timing results (in second)
@@ -0,0 +1,193 @@
+#include "GAMER.h"
+
+#ifdef TIMING
+
+
+// global tracing variables declared in "Trace.h"
+bool        Trace_Active    = false;
+long        Trace_NEventMax = 0;
+TraceBuf_t *Trace_Buf       = NULL;
+
+// reference clock for converting ticks to microseconds
+static ulong  Trace_Tick0;
+static double Trace_NSec0;
+
+static FILE  *Trace_File = NULL;
+
+static double GetMonotonicNSec();
+
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  Aux_Trace_Init
+// Description :  Allocate the per-thread ring buffers and open the per-rank trace file for OPT__TIMING_TRACE
+//
+// Note        :  1. Invoked by Init_GAMER()
+//                2. Output file is "Record__Trace_RankXXXXX.json" in the Chrome trace-event format
+//                   --> Can be loaded by chrome://tracing or https://ui.perfetto.dev
+//                   --> Use "pid" for MPI ranks and "tid" for OpenMP threads
+//                3. All ranks call MPI_Barrier() before setting the reference clock so that the timestamps
+//                   of different ranks are approximately aligned
+//-------------------------------------------------------------------------------------------------------
+void Aux_Trace_Init()
+{
+
+   if ( !OPT__TIMING_TRACE )  return;
+
+   if ( MPI_Rank == 0 )    Aux_Message( stdout, "%s ... ", __FUNCTION__ );
+
+
+// allocate the ring buffers
+   Trace_NEventMax = OPT__TIMING_TRACE_NEVENT;
+   Trace_Buf       = new TraceBuf_t [OMP_NTHREAD];
+
+   for (int t=0; t<OMP_NTHREAD; t++)
+   {
+      Trace_Buf[t].Event   = new TraceEvent_t [Trace_NEventMax];
+      Trace_Buf[t].Head    = 0;
+      Trace_Buf[t].NRecord = 0;
+   }
+
+
+// open the trace file and record the metadata
+   char FileName[MAX_STRING];
+   sprintf( FileName, "Record__Trace_Rank%05d.json", MPI_Rank );
+
+   if ( Aux_CheckFileExist(FileName) )
+      Aux_Message( stderr, "WARNING : file \"%s\" already exists and will be overwritten !!\n", FileName );
+
+   Trace_File = fopen( FileName, "w" );
+
+   fprintf( Trace_File, "[\n" );
+   fprintf( Trace_File, "{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":%d,\"args\":{\"name\":\"Rank %d\"}}",
+            MPI_Rank, MPI_Rank );
+
+   for (int t=0; t<OMP_NTHREAD; t++)
+   fprintf( Trace_File, ",\n{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":%d,\"tid\":%d,\"args\":{\"name\":\"Thread %d\"}}",
+            MPI_Rank, t, t );
+
+
+// set the reference clock
+   MPI_Barrier( MPI_COMM_WORLD );
+
+   Trace_Tick0  = Trace_GetTick();
+   Trace_NSec0  = GetMonotonicNSec();
+   Trace_Active = true;
+
+
+   if ( MPI_Rank == 0 )    Aux_Message( stdout, "done\n" );
+
+} // FUNCTION : Aux_Trace_Init
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  Aux_Trace_Flush
+// Description :  Append all events recorded since the last flush to the trace file and reset the ring buffers
+//
+// Note        :  1. Invoked by main() after every root-level step and by Aux_Trace_End()
+//                2. Must NOT be called inside an OpenMP parallel region
+//                3. Events are recorded as complete events (ph = "X") with timestamps in microseconds
+//                   relative to the reference clock set in Aux_Trace_Init()
+//                4. The tick-to-nanosecond ratio of TSC is calibrated against CLOCK_MONOTONIC over the entire
+//                   interval since Aux_Trace_Init()
+//-------------------------------------------------------------------------------------------------------
+void Aux_Trace_Flush()
+{
+
+   if ( !Trace_Active )    return;
+
+
+// calibrate the clock
+#  ifdef TRACE_USE_TSC
+   const ulong  dTick       = Trace_GetTick() - Trace_Tick0;
+   const double NSecPerTick = ( dTick > 0 ) ? ( GetMonotonicNSec() - Trace_NSec0 ) / dTick : 1.0;
+#  else
+   const double NSecPerTick = 1.0;
+#  endif
+   const double USecPerTick = 1.0e-3*NSecPerTick;
+
+
+// output events in chronological order of completion
+   long NLost = 0;
+
+   for (int t=0; t<OMP_NTHREAD; t++)
+   {
+      TraceBuf_t *Buf = Trace_Buf + t;
+
+      const long NEvent = MIN( Buf->NRecord, Trace_NEventMax );
+      const long First  = ( Buf->NRecord > Trace_NEventMax ) ? Buf->Head : 0;
+
+      NLost += Buf->NRecord - NEvent;
+
+      for (long e=0; e<NEvent; e++)
+      {
+         const TraceEvent_t *Event = Buf->Event + (First+e)%Trace_NEventMax;
+
+         fprintf( Trace_File, ",\n{\"name\":\"%s\",\"ph\":\"X\",\"pid\":%d,\"tid\":%d,\"ts\":%.3f,\"dur\":%.3f",
+                  Event->Name, MPI_Rank, t,
+                  (Event->Start - Trace_Tick0)*USecPerTick, (Event->End - Event->Start)*USecPerTick );
+
+         if ( Event->Lv >= 0 )   fprintf( Trace_File, ",\"args\":{\"lv\":%d}}", Event->Lv );
+         else                    fprintf( Trace_File, "}" );
+      }
+
+      Buf->Head    = 0;
+      Buf->NRecord = 0;
+   } // for (int t=0; t<OMP_NTHREAD; t++)
+
+   fflush( Trace_File );
+
+   if ( NLost > 0 )
+      Aux_Message( stderr, "WARNING : %ld trace events lost on rank %d (Step %ld) --> increase %s (%d) !!\n",
+                   NLost, MPI_Rank, Step, "OPT__TIMING_TRACE_NEVENT", OPT__TIMING_TRACE_NEVENT );
+
+} // FUNCTION : Aux_Trace_Flush
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  Aux_Trace_End
+// Description :  Flush the remaining events, close the trace file, and free the ring buffers
+//
+// Note        :  1. Invoked by End_GAMER()
+//-------------------------------------------------------------------------------------------------------
+void Aux_Trace_End()
+{
+
+   if ( !Trace_Active )    return;
+
+   Aux_Trace_Flush();
+
+   Trace_Active = false;
+
+   fprintf( Trace_File, "\n]\n" );
+   fclose( Trace_File );
+   Trace_File = NULL;
+
+   for (int t=0; t<OMP_NTHREAD; t++)   delete [] Trace_Buf[t].Event;
+   delete [] Trace_Buf;
+   Trace_Buf = NULL;
+
+} // FUNCTION : Aux_Trace_End
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  GetMonotonicNSec
+// Description :  Return the current time of CLOCK_MONOTONIC in nanoseconds
+//-------------------------------------------------------------------------------------------------------
+double GetMonotonicNSec()
+{
+
+   timespec ts;
+   clock_gettime( CLOCK_MONOTONIC, &ts );
+
+   return 1.0e9*ts.tv_sec + ts.tv_nsec;
+
+} // FUNCTION : GetMonotonicNSec
+
+
+
+#endif // #ifdef TIMING
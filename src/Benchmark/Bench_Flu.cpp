@@ -0,0 +1,278 @@
+#include "GAMER.h"
+
+void Bench_Record( const char *Solver, const char *Data, const int NPG, const int NThread, const double Time,
+                   const double NUpdate, const double NByte, const double Time1 );
+void Bench_SetNThread( const int NThread );
+
+#if ( MODEL == HYDRO )
+static real SetData( const int Data, const int NPG, const real dh );
+#endif
+
+// synthetic data sets
+static const int  NDATA = 2;
+static const char DataName[NDATA][MAX_STRING] = { "smooth", "shock" };
+
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  Bench_Flu
+// Description :  Benchmark the CPU fluid solver CPU_FluidSolver()
+//
+// Note        :  1. Invoked by main() in Bench_Main.cpp
+//                2. Two synthetic data sets are used
+//                   (1) smooth : Sinusoidal density and pressure with a uniform flow
+//                   (2) shock  : Oblique Sod-like discontinuities in every patch group
+//                   --> Both include a uniform magnetic field for MHD
+//                3. Flux and electric field are not stored and gravity is disabled
+//                   --> Time of CPU_FluidSolver() only, which is the same as Timer_Sol[lv][FLUID_SOLVER] in
+//                       Record__Timing with TIMING_SOLVER
+//                4. The input array is restored before each call since it may be modified by the solver
+//                5. Record the best time of NRep calls for each thread count
+//                6. Only support HYDRO for now
+//
+// Parameter   :  NPG        : Number of patch groups per solver call
+//                NRep       : Number of repetitions
+//                NThread    : Number of thread counts to be benchmarked
+//                ThreadList : List of thread counts
+//-------------------------------------------------------------------------------------------------------
+void Bench_Flu( const int NPG, const int NRep, const int NThread, const int ThreadList[] )
+{
+
+#  if ( MODEL == HYDRO )
+
+   Aux_Message( stdout, "%s (NPG %d, NRep %d) ...\n", __FUNCTION__, NPG, NRep );
+
+   if ( NPG < OMP_NTHREAD )
+      Aux_Error( ERROR_INFO, "NPG (%d) < OMP_NTHREAD (%d) !!\n", NPG, OMP_NTHREAD );
+
+
+// allocate the solver arrays
+#  ifdef GRAVITY
+   Init_MemAllocate_Fluid( NPG, NPG,      NPG );
+#  else
+   Init_MemAllocate_Fluid( NPG, NULL_INT, NPG );
+#  endif
+
+   const long   Size_FluIn  = (long)NPG*FLU_NIN*CUBE(FLU_NXT);
+#  ifdef MHD
+   const long   Size_MagIn  = (long)NPG*NCOMP_MAG*FLU_NXT_P1*SQR(FLU_NXT);
+#  endif
+   const real   dh          = (real)1.0/PS2;
+   const double NUpdate     = (double)NPG*CUBE(PS2);
+
+// input+output arrays
+   double NByte = (double)NPG*( FLU_NIN*CUBE(FLU_NXT) + FLU_NOUT*CUBE(PS2) )*sizeof(real);
+#  ifdef MHD
+   NByte += (double)NPG*NCOMP_MAG*( FLU_NXT_P1*SQR(FLU_NXT) + PS2P1*SQR(PS2) )*sizeof(real);
+#  endif
+#  ifdef DUAL_ENERGY
+   NByte += (double)NPG*CUBE(PS2)*sizeof(char);
+#  endif
+
+   real *Flu_Backup = new real [Size_FluIn];
+#  ifdef MHD
+   real *Mag_Backup = new real [Size_MagIn];
+#  endif
+
+
+// useless variables for disabled features
+#  ifndef DUAL_ENERGY
+   char (*h_DE_Array_F_Out[2])[ CUBE(PS2) ]                           = { NULL, NULL };
+   const double DUAL_ENERGY_SWITCH = NULL_REAL;
+#  endif
+#  ifndef MHD
+   real (*h_Mag_Array_F_In [2])[NCOMP_MAG][ FLU_NXT_P1*SQR(FLU_NXT) ] = { NULL, NULL };
+   real (*h_Mag_Array_F_Out[2])[NCOMP_MAG][ PS2P1*SQR(PS2) ]          = { NULL, NULL };
+   real (*h_Ele_Array      [2])[9][NCOMP_ELE][ PS2P1*PS2 ]            = { NULL, NULL };
+#  endif
+
+   const bool   StoreFlux_No     = false;
+   const bool   StoreElectric_No = false;
+   const bool   UsePot_No        = false;
+   const bool   JeansMinPres_No  = false;
+   const bool   FuseSrc_No       = false;
+   const double Time             = 0.0;
+   const int    ArrayID          = 0;
+
+
+   for (int d=0; d<NDATA; d++)
+   {
+      const real dt = SetData( d, NPG, dh );
+
+      memcpy( Flu_Backup, h_Flu_Array_F_In[ArrayID], Size_FluIn*sizeof(real) );
+#     ifdef MHD
+      memcpy( Mag_Backup, h_Mag_Array_F_In[ArrayID], Size_MagIn*sizeof(real) );
+#     endif
+
+      double Time1 = NULL_REAL;
+
+      for (int t=0; t<NThread; t++)
+      {
+         Bench_SetNThread( ThreadList[t] );
+
+         double   TimeMin = HUGE_NUMBER;
+         Timer_t  Timer;
+
+//       rep = -1 is for warm-up
+         for (int rep=-1; rep<NRep; rep++)
+         {
+            memcpy( h_Flu_Array_F_In[ArrayID], Flu_Backup, Size_FluIn*sizeof(real) );
+#           ifdef MHD
+            memcpy( h_Mag_Array_F_In[ArrayID], Mag_Backup, Size_MagIn*sizeof(real) );
+#           endif
+
+            Timer.Reset();
+            Timer.Start();
+
+            CPU_FluidSolver( h_Flu_Array_F_In[ArrayID], h_Flu_Array_F_Out[ArrayID],
+                             h_Mag_Array_F_In[ArrayID], h_Mag_Array_F_Out[ArrayID],
+                             h_DE_Array_F_Out[ArrayID], NULL, h_Ele_Array[ArrayID],
+                             NULL, NULL,
+                             NPG, dt, dh, StoreFlux_No, StoreElectric_No, (rep+2)%2, OPT__LR_LIMITER, MINMOD_COEFF,
+                             NULL_REAL, NULL_REAL, NULL_BOOL,
+                             Time, UsePot_No, EXT_ACC_NONE,
+                             MIN_DENS, MIN_PRES, MIN_EINT, DUAL_ENERGY_SWITCH,
+                             OPT__NORMALIZE_PASSIVE, PassiveNorm_NVar, PassiveNorm_VarIdx, JeansMinPres_No, NULL_REAL,
+                             FuseSrc_No, NULL_REAL, OPT__FLU_SLAB );
+
+            Timer.Stop();
+
+            if ( rep >= 0 )   TimeMin = fmin( TimeMin, Timer.GetValue() );
+         }
+
+         if ( t == 0 )  Time1 = TimeMin*ThreadList[0];
+
+         Bench_Record( "FluidSolver", DataName[d], NPG, ThreadList[t], TimeMin, NUpdate, NByte, Time1 );
+      } // for (int t=0; t<NThread; t++)
+   } // for (int d=0; d<NDATA; d++)
+
+   Bench_SetNThread( OMP_NTHREAD );
+
+
+   delete [] Flu_Backup;
+#  ifdef MHD
+   delete [] Mag_Backup;
+#  endif
+
+   End_MemFree_Fluid();
+
+   Aux_Message( stdout, "%s ... done\n", __FUNCTION__ );
+
+#  else
+
+   Aux_Message( stderr, "WARNING : fluid solver benchmark only supports HYDRO --> skipped !!\n" );
+
+#  endif // #if ( MODEL == HYDRO ) ... else ...
+
+} // FUNCTION : Bench_Flu
+
+
+
+#if ( MODEL == HYDRO )
+//-------------------------------------------------------------------------------------------------------
+// Function    :  SetData
+// Description :  Fill the input arrays of the fluid solver with the target synthetic data set
+//
+// Note        :  1. Each patch group is shifted by a different phase so that they are not identical
+//                2. Magnetic field is uniform and therefore divergence-free
+//
+// Parameter   :  Data : Target data set (0/1 = smooth/shock)
+//                NPG  : Number of patch groups
+//                dh   : Cell size
+//
+// Return      :  h_Flu_Array_F_In[0], h_Mag_Array_F_In[0], time-step satisfying the CFL condition
+//-------------------------------------------------------------------------------------------------------
+real SetData( const int Data, const int NPG, const real dh )
+{
+
+   const double Amp  = 0.2;
+   const double Vel  = 0.5;
+   const double L    = FLU_NXT*dh;
+   const double k    = 2.0*M_PI/L;
+#  ifdef MHD
+   const double B0   = 0.5;
+   const real   Emag = 0.5*SQR(B0);
+#  else
+   const real   Emag = NULL_REAL;
+#  endif
+
+   double MaxSpeed = 0.0;
+
+   for (int PG=0; PG<NPG; PG++)
+   {
+      const double Phase = 2.0*M_PI*PG/NPG;
+      int idx = 0;
+
+      for (int kk=0; kk<FLU_NXT; kk++)    {  const double z = (kk+0.5)*dh;
+      for (int jj=0; jj<FLU_NXT; jj++)    {  const double y = (jj+0.5)*dh;
+      for (int ii=0; ii<FLU_NXT; ii++)    {  const double x = (ii+0.5)*dh;
+
+         double Dens, Pres;
+
+         if ( Data == 0 )
+         {
+            Dens = 1.0 + Amp*sin( k*(x+y+z) + Phase );
+            Pres = 1.0 + Amp*cos( k*(x-y)   + Phase );
+         }
+
+         else
+         {
+            const bool Left = ( x + y + z < 1.5*L*( 1.0 + 0.1*sin(Phase) ) );
+
+            Dens = ( Left ) ? 1.0 : 0.125;
+            Pres = ( Left ) ? 1.0 : 0.1;
+         }
+
+         const double MomX = Dens*Vel;
+         const double MomY = Dens*Vel*0.5;
+         const double MomZ = Dens*Vel*0.25;
+
+         real Passive[NCOMP_PASSIVE], fluid[NCOMP_TOTAL];
+
+         for (int v=0; v<NCOMP_PASSIVE; v++)    Passive[v] = Dens*( 0.5 + 0.5*sin( k*x + v ) ) + TINY_NUMBER;
+
+         const real Eint = EoS_DensPres2Eint_CPUPtr( Dens, Pres, (NCOMP_PASSIVE>0)?Passive:NULL,
+                                                     EoS_AuxArray_Flt, EoS_AuxArray_Int, h_EoS_Table, NULL );
+         const real CSqr = EoS_DensPres2CSqr_CPUPtr( Dens, Pres, (NCOMP_PASSIVE>0)?Passive:NULL,
+                                                     EoS_AuxArray_Flt, EoS_AuxArray_Int, h_EoS_Table, NULL );
+
+         fluid[DENS] = Dens;
+         fluid[MOMX] = MomX;
+         fluid[MOMY] = MomY;
+         fluid[MOMZ] = MomZ;
+#        ifdef MHD
+         fluid[ENGY] = Hydro_ConEint2Etot( Dens, MomX, MomY, MomZ, Eint, Emag );
+#        else
+         fluid[ENGY] = Hydro_ConEint2Etot( Dens, MomX, MomY, MomZ, Eint, (real)0.0 );
+#        endif
+#        if   ( DUAL_ENERGY == DE_ENPY )
+         fluid[ENPY] = Hydro_Con2Entropy( Dens, MomX, MomY, MomZ, fluid[ENGY], Emag,
+                                          EoS_DensEint2Pres_CPUPtr, EoS_AuxArray_Flt, EoS_AuxArray_Int, h_EoS_Table );
+#        endif
+         for (int v=0; v<NCOMP_PASSIVE; v++)    fluid[ NCOMP_FLUID + v ] = Passive[v];
+
+         for (int v=0; v<FLU_NIN; v++)    h_Flu_Array_F_In[0][PG][v][idx] = fluid[v];
+
+//       fast magnetosonic speed is bounded by sqrt( Cs^2 + B^2/rho )
+#        ifdef MHD
+         const double Speed = sqrt( SQR(MomX)+SQR(MomY)+SQR(MomZ) )/Dens + sqrt( CSqr + 2.0*Emag/Dens );
+#        else
+         const double Speed = sqrt( SQR(MomX)+SQR(MomY)+SQR(MomZ) )/Dens + sqrt( CSqr );
+#        endif
+         MaxSpeed = fmax( MaxSpeed, Speed );
+
+         idx ++;
+      }}}
+
+#     ifdef MHD
+      for (int v=0; v<NCOMP_MAG; v++)
+      for (int t=0; t<FLU_NXT_P1*SQR(FLU_NXT); t++)
+         h_Mag_Array_F_In[0][PG][v][t] = ( v == MAGX ) ? B0 : 0.0;
+#     endif
+   } // for (int PG=0; PG<NPG; PG++)
+
+   return DT__FLUID*dh/MaxSpeed;
+
+} // FUNCTION : SetData
+#endif // #if ( MODEL == HYDRO )
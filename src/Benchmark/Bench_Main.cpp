@@ -0,0 +1,274 @@
+#include "GAMER.h"
+#include "TestProb.h"
+
+void Bench_Flu( const int NPG, const int NRep, const int NThread, const int ThreadList[] );
+#ifdef GRAVITY
+void Bench_Poi( const int NPG, const int NRep, const int NThread, const int ThreadList[] );
+#endif
+#ifdef PARTICLE
+void Bench_Par( const int NPG, const int NRep, const int NThread, const int ThreadList[] );
+#endif
+
+static void Bench_Init( int *argc, char ***argv );
+#ifdef PARTICLE
+static void Bench_AddParticleAttribute();
+#endif
+
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  main
+// Description :  Main function of the standalone solver microbenchmarks "gamer_bench"
+//
+// Note        :  1. Built by "make bench" with the same Makefile options as GAMER
+//                   --> Fluid/Poisson schemes, Riemann solver, and floating-point precision are all set at
+//                       compile time exactly as in a production build
+//                2. Usage: ./gamer_bench [flu|poi|par|all] [NPatchGroup] [NRepeat]
+//                   --> Default: all, FLU_GPU_NPGROUP (POT_GPU_NPGROUP for poi), 10
+//                3. Solver parameters (e.g., OPT__LR_LIMITER, GAMMA, SOR_OMEGA) are loaded from "Input__Parameter"
+//                   in the working directory, but no test problem is initialized
+//                4. Each solver runs on synthetic patch-group data with OpenMP thread counts of
+//                   1, 2, 4, ..., OMP_NTHREAD
+//                5. Results are appended to "Record__Bench" (see Bench_Record())
+//                6. Only CPU solvers with a single MPI process are supported
+//-------------------------------------------------------------------------------------------------------
+int main( int argc, char *argv[] )
+{
+
+   Bench_Init( &argc, &argv );
+
+
+// parse the command-line arguments
+   const char *Target = ( argc > 1 ) ? argv[1]       : "all";
+   const int   NPG    = ( argc > 2 ) ? atoi(argv[2]) : -1;
+   const int   NRep   = ( argc > 3 ) ? atoi(argv[3]) : 10;
+
+   const bool BenchFlu = ( strcmp(Target, "flu") == 0  ||  strcmp(Target, "all") == 0 );
+   const bool BenchPoi = ( strcmp(Target, "poi") == 0  ||  strcmp(Target, "all") == 0 );
+   const bool BenchPar = ( strcmp(Target, "par") == 0  ||  strcmp(Target, "all") == 0 );
+
+   if ( !BenchFlu  &&  !BenchPoi  &&  !BenchPar )
+      Aux_Error( ERROR_INFO, "unknown target \"%s\" (flu/poi/par/all) !!\n", Target );
+
+   if ( NRep <= 0 )  Aux_Error( ERROR_INFO, "NRepeat (%d) <= 0 !!\n", NRep );
+
+
+// thread counts to be benchmarked: 1, 2, 4, ..., OMP_NTHREAD
+   int NThread = 0;
+   int ThreadList[32];
+
+#  ifdef OPENMP
+   for (int nt=1; nt<OMP_NTHREAD; nt*=2)  ThreadList[ NThread ++ ] = nt;
+#  endif
+   ThreadList[ NThread ++ ] = OMP_NTHREAD;
+
+
+// run the benchmarks
+   if ( BenchFlu )
+      Bench_Flu( (NPG>0)?NPG:FLU_GPU_NPGROUP, NRep, NThread, ThreadList );
+
+   if ( BenchPoi )
+   {
+#     ifdef GRAVITY
+      Bench_Poi( (NPG>0)?NPG:POT_GPU_NPGROUP, NRep, NThread, ThreadList );
+#     else
+      if ( strcmp(Target, "poi") == 0 )
+         Aux_Message( stderr, "WARNING : Poisson solver benchmark is skipped since GRAVITY is disabled !!\n" );
+#     endif
+   }
+
+   if ( BenchPar )
+   {
+#     ifdef PARTICLE
+      Bench_Par( (NPG>0)?NPG:POT_GPU_NPGROUP, NRep, NThread, ThreadList );
+#     else
+      if ( strcmp(Target, "par") == 0 )
+         Aux_Message( stderr, "WARNING : particle benchmark is skipped since PARTICLE is disabled !!\n" );
+#     endif
+   }
+
+
+   MPI_Finalize();
+
+   return 0;
+
+} // FUNCTION : main
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  Bench_Init
+// Description :  Initialize the runtime parameters and solver settings required by the benchmarks
+//
+// Note        :  1. Subset of Init_GAMER() without the AMR hierarchy, test problem, and FFTW
+//                2. External acceleration and potential are not initialized and must not be used
+//                3. User-defined particle attributes normally added by the test problem are replaced by
+//                   dummy attributes (see Bench_AddParticleAttribute())
+//-------------------------------------------------------------------------------------------------------
+void Bench_Init( int *argc, char ***argv )
+{
+
+#  ifdef SERIAL
+   MPI_Rank  = 0;
+   MPI_NRank = 1;
+#  else
+   Init_MPI( argc, argv );
+#  endif
+
+#  ifdef GPU
+   Aux_Error( ERROR_INFO, "gamer_bench only supports CPU solvers --> disable GPU !!\n" );
+#  endif
+
+   if ( MPI_NRank != 1 )   Aux_Error( ERROR_INFO, "gamer_bench only supports a single MPI process !!\n" );
+
+   amr = new AMR_t;
+
+#  ifdef PARTICLE
+   amr->Par = new Particle_t();
+#  endif
+
+   Init_Load_Parameter();
+
+   Init_Unit();
+
+   Init_ResetParameter();
+
+#  ifdef OPENMP
+   Init_OpenMP();
+#  endif
+
+   Init_Field();
+#  ifdef PARTICLE
+   Par_Init_Attribute_User_Ptr = Bench_AddParticleAttribute;
+   Par_Init_Attribute();
+#  endif
+
+#  if ( MODEL == HYDRO )
+   EoS_Init();
+#  endif
+
+   Src_Init();
+
+} // FUNCTION : Bench_Init
+
+
+
+#ifdef PARTICLE
+//-------------------------------------------------------------------------------------------------------
+// Function    :  Bench_AddParticleAttribute
+// Description :  Add PAR_NATT_USER dummy particle attributes
+//
+// Note        :  1. Invoked by Par_Init_Attribute() using the function pointer "Par_Init_Attribute_User_Ptr"
+//-------------------------------------------------------------------------------------------------------
+void Bench_AddParticleAttribute()
+{
+
+   char Label[MAX_STRING];
+
+   for (int v=0; v<PAR_NATT_USER; v++)
+   {
+      sprintf( Label, "ParBench%d", v );
+      AddParticleAttribute( Label );
+   }
+
+} // FUNCTION : Bench_AddParticleAttribute
+#endif
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  Bench_Record
+// Description :  Record the benchmark results in "Record__Bench" and stdout
+//
+// Note        :  1. One line per solver, data set, and thread count, which is straightforward to parse
+//                   by scripts for detecting performance regressions
+//                2. Rate       : Number of cell (or particle) updates per second
+//                   Bandwidth  : Input+output array size of the solver per second in GB/s
+//                                --> Lower bound of the actual memory traffic
+//                   Efficiency : Parallel efficiency relative to the single-thread result
+//
+// Parameter   :  Solver  : Solver name
+//                Data    : Name of the synthetic data set
+//                NPG     : Number of patch groups
+//                NThread : Number of OpenMP threads
+//                Time    : Elapsed time per solver call in seconds
+//                NUpdate : Number of cell (or particle) updates per solver call
+//                NByte   : Input+output array size per solver call in bytes
+//                Time1   : Elapsed time per solver call with a single thread
+//-------------------------------------------------------------------------------------------------------
+void Bench_Record( const char *Solver, const char *Data, const int NPG, const int NThread, const double Time,
+                   const double NUpdate, const double NByte, const double Time1 )
+{
+
+   const char FileName[] = "Record__Bench";
+   static bool FirstTime = true;
+
+   FILE *File = fopen( FileName, "a" );
+
+   if ( FirstTime )
+   {
+      fprintf( File, "# MODEL %d, FLU_SCHEME %d, LR_SCHEME %d, RSOLVER %d, POT_SCHEME %d, FLOAT8 %d, PS1 %d\n",
+               MODEL,
+#              ifdef FLU_SCHEME
+               FLU_SCHEME,
+#              else
+               -1,
+#              endif
+#              ifdef LR_SCHEME
+               LR_SCHEME,
+#              else
+               -1,
+#              endif
+#              ifdef RSOLVER
+               RSOLVER,
+#              else
+               -1,
+#              endif
+#              ifdef POT_SCHEME
+               POT_SCHEME,
+#              else
+               -1,
+#              endif
+#              ifdef FLOAT8
+               1,
+#              else
+               0,
+#              endif
+               PS1 );
+      fprintf( File, "#%-19s %-10s %8s %8s %13s %13s %13s %10s\n",
+               "Solver", "Data", "NPG", "NThread", "Time[s]", "Rate[1/s]", "BW[GB/s]", "Efficiency" );
+
+      Aux_Message( stdout, "#%-19s %-10s %8s %8s %13s %13s %13s %10s\n",
+                   "Solver", "Data", "NPG", "NThread", "Time[s]", "Rate[1/s]", "BW[GB/s]", "Efficiency" );
+
+      FirstTime = false;
+   }
+
+   const double Rate       = NUpdate/Time;
+   const double Bandwidth  = NByte/Time*1.0e-9;
+   const double Efficiency = Time1/( Time*NThread );
+
+   fprintf( File, "%-20s %-10s %8d %8d %13.6e %13.6e %13.6e %10.4f\n",
+            Solver, Data, NPG, NThread, Time, Rate, Bandwidth, Efficiency );
+   fclose( File );
+
+   Aux_Message( stdout, "%-20s %-10s %8d %8d %13.6e %13.6e %13.6e %10.4f\n",
+                Solver, Data, NPG, NThread, Time, Rate, Bandwidth, Efficiency );
+
+} // FUNCTION : Bench_Record
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  Bench_SetNThread
+// Description :  Set the number of OpenMP threads used by the following parallel regions
+//-------------------------------------------------------------------------------------------------------
+void Bench_SetNThread( const int NThread )
+{
+
+#  ifdef OPENMP
+   omp_set_num_threads( NThread );
+#  endif
+
+} // FUNCTION : Bench_SetNThread
@@ -0,0 +1,173 @@
+#include "GAMER.h"
+
+#ifdef PARTICLE
+
+void Bench_Record( const char *Solver, const char *Data, const int NPG, const int NThread, const double Time,
+                   const double NUpdate, const double NByte, const double Time1 );
+void Bench_SetNThread( const int NThread );
+
+static void SetData( const int Data, const int NPatch, const long NParPerPatch, const real dh );
+
+// synthetic data sets
+static const int  NDATA = 2;
+static const char DataName[NDATA][MAX_STRING] = { "uniform", "cluster" };
+
+// number of particles per patch
+static const long NPAR_PER_PATCH = CUBE(PS1);
+
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  Bench_Par
+// Description :  Benchmark the particle mass assignment Par_MassAssignment()
+//
+// Note        :  1. Invoked by main() in Bench_Main.cpp
+//                2. Two synthetic data sets are used, both with NPAR_PER_PATCH particles per patch
+//                   (1) uniform : Uniformly distributed particles
+//                   (2) cluster : Gaussian-distributed particles concentrated around the patch center
+//                3. Deposit particles onto the rho_ext[] arrays of 8*NPG patches in parallel with the particle
+//                   interpolation scheme PAR_INTERP, which is the same as Prepare_PatchData()
+//                4. Record the best time of NRep calls for each thread count
+//
+// Parameter   :  NPG        : Number of patch groups per call
+//                NRep       : Number of repetitions
+//                NThread    : Number of thread counts to be benchmarked
+//                ThreadList : List of thread counts
+//-------------------------------------------------------------------------------------------------------
+void Bench_Par( const int NPG, const int NRep, const int NThread, const int ThreadList[] )
+{
+
+   Aux_Message( stdout, "%s (NPG %d, NRep %d) ...\n", __FUNCTION__, NPG, NRep );
+
+
+   const int    NPatch             = 8*NPG;
+   const long   NPar               = NPatch*NPAR_PER_PATCH;
+   const real   dh                 = (real)1.0/PS2;
+   const double NUpdate            = (double)NPar;
+   const double NByte              = (double)NPar*4*sizeof(real) + (double)NPatch*CUBE(RHOEXT_NXT)*sizeof(real);
+   const double EdgeL[3]           = { -RHOEXT_GHOST_SIZE*dh, -RHOEXT_GHOST_SIZE*dh, -RHOEXT_GHOST_SIZE*dh };
+   const bool   Periodic_No[3]     = { false, false, false };
+   const bool   PredictPos_No      = false;
+   const bool   InitZero_Yes       = true;
+   const bool   UnitDens_No        = false;
+   const bool   CheckFarAway_No    = false;
+   const bool   UseInputMassPos_No = false;
+   const double Time               = 0.0;
+
+   amr->Par->InitRepo( NPar, MPI_NRank );
+
+   real (*Rho)[ CUBE(RHOEXT_NXT) ] = new real [NPatch][ CUBE(RHOEXT_NXT) ];
+   long *ParList                   = new long [NPar];
+
+   for (long p=0; p<NPar; p++)   ParList[p] = p;
+
+
+   for (int d=0; d<NDATA; d++)
+   {
+      SetData( d, NPatch, NPAR_PER_PATCH, dh );
+
+      double Time1 = NULL_REAL;
+
+      for (int t=0; t<NThread; t++)
+      {
+         Bench_SetNThread( ThreadList[t] );
+
+         double   TimeMin = HUGE_NUMBER;
+         Timer_t  Timer;
+
+//       rep = -1 is for warm-up
+         for (int rep=-1; rep<NRep; rep++)
+         {
+            Timer.Reset();
+            Timer.Start();
+
+#           pragma omp parallel for schedule( runtime )
+            for (int P=0; P<NPatch; P++)
+               Par_MassAssignment( ParList+P*NPAR_PER_PATCH, NPAR_PER_PATCH, amr->Par->Interp, Rho[P], RHOEXT_NXT,
+                                   EdgeL, dh, PredictPos_No, Time, InitZero_Yes, Periodic_No, NULL,
+                                   UnitDens_No, CheckFarAway_No, UseInputMassPos_No, NULL );
+
+            Timer.Stop();
+
+            if ( rep >= 0 )   TimeMin = fmin( TimeMin, Timer.GetValue() );
+         }
+
+         if ( t == 0 )  Time1 = TimeMin*ThreadList[0];
+
+         Bench_Record( "ParMassAssignment", DataName[d], NPG, ThreadList[t], TimeMin, NUpdate, NByte, Time1 );
+      } // for (int t=0; t<NThread; t++)
+   } // for (int d=0; d<NDATA; d++)
+
+   Bench_SetNThread( OMP_NTHREAD );
+
+
+   delete [] Rho;
+   delete [] ParList;
+
+   Aux_Message( stdout, "%s ... done\n", __FUNCTION__ );
+
+} // FUNCTION : Bench_Par
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  SetData
+// Description :  Set the particle mass and position of the target synthetic data set
+//
+// Note        :  1. Particles [P*NParPerPatch ... (P+1)*NParPerPatch-1] belong to patch P, which covers
+//                   [0 ... PS1*dh) along each direction
+//                2. Use a fixed random seed for reproducibility
+//
+// Parameter   :  Data         : Target data set (0/1 = uniform/cluster)
+//                NPatch       : Number of patches
+//                NParPerPatch : Number of particles per patch
+//                dh           : Cell size
+//
+// Return      :  amr->Par->Mass/PosX/PosY/PosZ[]
+//-------------------------------------------------------------------------------------------------------
+void SetData( const int Data, const int NPatch, const long NParPerPatch, const real dh )
+{
+
+   const double L     = PS1*dh;
+   const double Sigma = 0.1*L;
+   const long   NPar  = NPatch*NParPerPatch;
+
+   real *Pos[3] = { amr->Par->PosX, amr->Par->PosY, amr->Par->PosZ };
+
+   RandomNumber_t RNG( 1 );
+   RNG.SetSeed( 0, 123 );
+
+   for (long p=0; p<NPar; p++)
+   {
+      amr->Par->Mass[p] = 1.0/NParPerPatch;
+
+      for (int d=0; d<3; d++)
+      {
+         double x;
+
+         if ( Data == 0 )
+            x = RNG.GetValue( 0, 0.0, L );
+
+//       Box-Muller transform truncated to the patch
+         else
+         {
+            do
+            {
+               const double R1 = RNG.GetValue( 0, TINY_NUMBER, 1.0 );
+               const double R2 = RNG.GetValue( 0, 0.0, 1.0 );
+
+               x = 0.5*L + Sigma*sqrt( -2.0*log(R1) )*cos( 2.0*M_PI*R2 );
+            }
+            while ( x < 0.0  ||  x >= L );
+         }
+
+         Pos[d][p] = x;
+      }
+   }
+
+} // FUNCTION : SetData
+
+
+
+#endif // #ifdef PARTICLE
@@ -0,0 +1,168 @@
+#include "GAMER.h"
+
+#ifdef GRAVITY
+
+void Bench_Record( const char *Solver, const char *Data, const int NPG, const int NThread, const double Time,
+                   const double NUpdate, const double NByte, const double Time1 );
+void Bench_SetNThread( const int NThread );
+
+static void SetData( const int Data, const int NPG, const real dh );
+
+// synthetic data sets
+static const int  NDATA = 2;
+static const char DataName[NDATA][MAX_STRING] = { "smooth", "clump" };
+
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  Bench_Poi
+// Description :  Benchmark the CPU Poisson solver (SOR or MG) in CPU_PoissonGravitySolver()
+//
+// Note        :  1. Invoked by main() in Bench_Main.cpp
+//                2. Two synthetic data sets are used
+//                   (1) smooth : Sinusoidal density
+//                   (2) clump  : A Gaussian clump with a density contrast of 1e3 in every patch group
+//                   --> The number of iterations of SOR/MG may differ between the two
+//                3. Only the Poisson solver is measured (i.e., POISSON_SOLVER in InvokeSolver())
+//                   --> The coarse-grid potential in the ghost zones is set to zero
+//                   --> External potential is disabled
+//                4. Record the best time of NRep calls for each thread count
+//
+// Parameter   :  NPG        : Number of patch groups per solver call
+//                NRep       : Number of repetitions
+//                NThread    : Number of thread counts to be benchmarked
+//                ThreadList : List of thread counts
+//-------------------------------------------------------------------------------------------------------
+void Bench_Poi( const int NPG, const int NRep, const int NThread, const int ThreadList[] )
+{
+
+   Aux_Message( stdout, "%s (NPG %d, NRep %d) ...\n", __FUNCTION__, NPG, NRep );
+
+   if ( NPG < OMP_NTHREAD )
+      Aux_Error( ERROR_INFO, "NPG (%d) < OMP_NTHREAD (%d) !!\n", NPG, OMP_NTHREAD );
+
+
+// allocate the solver arrays
+   Init_MemAllocate_PoissonGravity( NPG );
+
+   const int    NPatch    = 8*NPG;
+   const real   dh        = (real)1.0/PS2;
+   const real   Poi_Coeff = 4.0*M_PI*NEWTON_G;
+   const double NUpdate   = (double)NPatch*CUBE(PS1);
+   const double NByte     = (double)NPatch*( CUBE(RHO_NXT) + CUBE(POT_NXT) + CUBE(GRA_NXT) )*sizeof(real);
+
+#  if ( MODEL != ELBDM )
+   const double ELBDM_ETA = NULL_REAL;
+#  endif
+   const bool   POISSON_ON  = true;
+   const bool   GRAVITY_OFF = false;
+   const double Time        = 0.0;
+   const int    ArrayID     = 0;
+
+
+   for (int d=0; d<NDATA; d++)
+   {
+      SetData( d, NPG, dh );
+
+      double Time1 = NULL_REAL;
+
+      for (int t=0; t<NThread; t++)
+      {
+         Bench_SetNThread( ThreadList[t] );
+
+         double   TimeMin = HUGE_NUMBER;
+         Timer_t  Timer;
+
+//       rep = -1 is for warm-up
+         for (int rep=-1; rep<NRep; rep++)
+         {
+            Timer.Reset();
+            Timer.Start();
+
+            CPU_PoissonGravitySolver( h_Rho_Array_P[ArrayID], h_Pot_Array_P_In[ArrayID],
+                                      h_Pot_Array_P_Out[ArrayID], NULL, NULL,
+                                      NULL, NULL, NULL, NULL,
+                                      NPG, NULL_REAL, dh, SOR_MIN_ITER, SOR_MAX_ITER,
+                                      SOR_OMEGA, MG_MAX_ITER, MG_NPRE_SMOOTH, MG_NPOST_SMOOTH,
+                                      MG_TOLERATED_ERROR, Poi_Coeff, OPT__POT_INT_SCHEME,
+                                      NULL_BOOL, ELBDM_ETA, NULL_REAL, POISSON_ON, GRAVITY_OFF,
+                                      true, EXT_POT_NONE, EXT_ACC_NONE,
+                                      Time, Time, NULL_REAL );
+
+            Timer.Stop();
+
+            if ( rep >= 0 )   TimeMin = fmin( TimeMin, Timer.GetValue() );
+         }
+
+         if ( t == 0 )  Time1 = TimeMin*ThreadList[0];
+
+#        if   ( POT_SCHEME == SOR )
+         Bench_Record( "PoissonSolver_SOR", DataName[d], NPG, ThreadList[t], TimeMin, NUpdate, NByte, Time1 );
+#        elif ( POT_SCHEME == MG  )
+         Bench_Record( "PoissonSolver_MG",  DataName[d], NPG, ThreadList[t], TimeMin, NUpdate, NByte, Time1 );
+#        endif
+      } // for (int t=0; t<NThread; t++)
+   } // for (int d=0; d<NDATA; d++)
+
+   Bench_SetNThread( OMP_NTHREAD );
+
+
+   End_MemFree_PoissonGravity();
+
+   Aux_Message( stdout, "%s ... done\n", __FUNCTION__ );
+
+} // FUNCTION : Bench_Poi
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  SetData
+// Description :  Fill the input arrays of the Poisson solver with the target synthetic data set
+//
+// Note        :  1. Each patch is shifted by a different phase so that they are not identical
+//
+// Parameter   :  Data : Target data set (0/1 = smooth/clump)
+//                NPG  : Number of patch groups
+//                dh   : Cell size
+//
+// Return      :  h_Rho_Array_P[0], h_Pot_Array_P_In[0]
+//-------------------------------------------------------------------------------------------------------
+void SetData( const int Data, const int NPG, const real dh )
+{
+
+   const double L     = RHO_NXT*dh;
+   const double k     = 2.0*M_PI/L;
+   const double Sigma = 0.15*L;
+
+   for (int P=0; P<8*NPG; P++)
+   {
+      const double Phase = 2.0*M_PI*P/(8*NPG);
+      const double Cen   = 0.5*L*( 1.0 + 0.2*sin(Phase) );
+
+      for (int kk=0; kk<RHO_NXT; kk++)    {  const double z = (kk+0.5)*dh;
+      for (int jj=0; jj<RHO_NXT; jj++)    {  const double y = (jj+0.5)*dh;
+      for (int ii=0; ii<RHO_NXT; ii++)    {  const double x = (ii+0.5)*dh;
+
+         if ( Data == 0 )
+            h_Rho_Array_P[0][P][kk][jj][ii] = 1.0 + 0.5*sin( k*(x+y+z) + Phase );
+
+         else
+         {
+            const double r2 = SQR(x-Cen) + SQR(y-Cen) + SQR(z-Cen);
+
+            h_Rho_Array_P[0][P][kk][jj][ii] = 1.0 + 1.0e3*exp( -0.5*r2/SQR(Sigma) );
+         }
+      }}}
+
+      for (int kk=0; kk<POT_NXT; kk++)
+      for (int jj=0; jj<POT_NXT; jj++)
+      for (int ii=0; ii<POT_NXT; ii++)
+         h_Pot_Array_P_In[0][P][kk][jj][ii] = 0.0;
+   } // for (int P=0; P<8*NPG; P++)
+
+} // FUNCTION : SetData
+
+
+
+#endif // #ifdef GRAVITY
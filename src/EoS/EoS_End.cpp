@@ -9,6 +9,8 @@
 // nothing to do
 #elif ( EOS == EOS_ISOTHERMAL )
 // nothing to do
+#elif ( EOS == EOS_TABULAR )
+void EoS_End_Tabular();
 #elif ( EOS == EOS_NUCLEAR )
 # error : ERROR : EOS_NUCLEAR is NOT supported yet !!
 #endif // # EOS
@@ -41,6 +43,8 @@ void EoS_End()
 // nothing to do
 #  elif ( EOS == EOS_ISOTHERMAL )
 // nothing to do
+#  elif ( EOS == EOS_TABULAR )
+   EoS_End_Ptr = EoS_End_Tabular;
 #  elif ( EOS == EOS_NUCLEAR )
 #  error : ERROR : EOS_NUCLEAR is NOT supported yet !!
 #  endif // # EOS
@@ -0,0 +1,826 @@
+#include "CUFLU.h"
+#ifdef __CUDACC__
+#include "CUAPI.h"
+#include "CUFLU_Shared_FluUtility.cu"
+#else
+#include "ReadPara.h"
+#endif
+
+#if ( MODEL == HYDRO )
+
+
+
+/********************************************************
+1. Tabular EoS on uniform-in-log grids
+
+   --> Pressure and sound speed squared as a function of (density, specific internal energy, Ye)
+   --> Ye = electron fraction = passive scalar "Ye"/density, which is optional
+       (i.e., EOS_TAB_NYE = 1 for a 2D table)
+
+2. This file is shared by both CPU and GPU
+
+   GPU_EoS_Tabular.cu -> CPU_EoS_Tabular.cpp
+
+3. Three steps are required to implement an EoS
+
+   I.   Set EoS auxiliary arrays
+   II.  Implement EoS conversion functions
+   III. Set EoS initialization functions
+
+4. Input table "EOS_TAB_NAME"
+
+   --> Binary file storing double-precision values in cgs units
+   --> Layout: [EOS_TAB_NDENS][EOS_TAB_NYE][EOS_TAB_NSEINT][2], where the last dimension stores
+       {pressure, sound speed squared}
+   --> Density and specific internal energy are uniformly sampled in log10 space between
+       EOS_TAB_LOGDENS_MIN/MAX and EOS_TAB_LOGSEINT_MIN/MAX, respectively
+   --> Ye is uniformly sampled in linear space between EOS_TAB_YE_MIN/MAX
+
+5. Tables constructed by EoS_Init_Tabular()
+
+   Table[EOS_TAB_FORWARD] : pres/eint on the (ln(dens), Ye, ln(seint)) grid
+   Table[EOS_TAB_INVERSE] : {eint/pres, dens*cs^2/pres} on the (ln(dens), Ye, ln(pres)) grid
+                            --> Obtained by inverting each monotonic P(seint) column of the input table,
+                                with EOS_TAB_NPRES points spanning the full pressure range of the input table
+
+   --> eint = internal energy density = dens*seint
+   --> Storing these dimensionless ratios instead of ln(pres), ln(seint), and ln(cs^2) avoids evaluating
+       exp() at run time and makes the interpolation exact for an ideal gas
+
+   --> All tables are stored in code units
+   --> Variables of the same node are stored contiguously so that each interpolation stencil point
+       fetches all variables from the same cache line
+   --> Indices are computed in O(1) since all grids are uniform, and input values beyond the
+       table range use the ratios at the table boundaries
+********************************************************/
+
+
+
+// table indices
+#define EOS_TAB_FORWARD       0
+#define EOS_TAB_INVERSE       1
+
+// number of variables stored in each table node
+#define EOS_TAB_NVAR_FORWARD  1
+#define EOS_TAB_NVAR_INVERSE  2
+
+
+// =============================================
+// I. Set EoS auxiliary arrays
+// =============================================
+
+#ifndef __CUDACC__
+
+// ln(pres) range of the inverse table set by EoS_Init_Tabular()
+static double EoS_Tab_LnPresMin, EoS_Tab_LnPresMax;
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  EoS_SetAuxArray_Tabular
+// Description :  Set the auxiliary arrays AuxArray_Flt/Int[]
+//
+//                   AuxArray_Flt[0] = ln(dens) of the first table node
+//                   AuxArray_Flt[1] = 1/d[ln(dens)]
+//                   AuxArray_Flt[2] = ln(seint) of the first table node
+//                   AuxArray_Flt[3] = 1/d[ln(seint)]
+//                   AuxArray_Flt[4] = Ye of the first table node
+//                   AuxArray_Flt[5] = 1/d[Ye]
+//                   AuxArray_Flt[6] = ln(pres) of the first node of the inverse table
+//                   AuxArray_Flt[7] = 1/d[ln(pres)]
+//
+//                   AuxArray_Int[0] = EOS_TAB_NDENS
+//                   AuxArray_Int[1] = EOS_TAB_NSEINT
+//                   AuxArray_Int[2] = EOS_TAB_NYE
+//                   AuxArray_Int[3] = EOS_TAB_NPRES
+//                   AuxArray_Int[4] = passive scalar index of Ye (i.e., field index - NCOMP_FLUID)
+//
+// Note        :  1. Invoked by EoS_Init_Tabular() after the inverse table has been constructed
+//                2. AuxArray_Flt/Int[] have the size of EOS_NAUX_MAX defined in Macro.h (default = 20)
+//                3. Add "#ifndef __CUDACC__" since this routine is only useful on CPU
+//                4. All values are in code units
+//
+// Parameter   :  AuxArray_Flt/Int : Floating-point/Integer arrays to be filled up
+//
+// Return      :  AuxArray_Flt/Int[]
+//-------------------------------------------------------------------------------------------------------
+void EoS_SetAuxArray_Tabular( double AuxArray_Flt[], int AuxArray_Int[] )
+{
+
+   const double Ln10       = log( 10.0 );
+   const double LnDensMin  = EOS_TAB_LOGDENS_MIN *Ln10 - log( UNIT_D      );
+   const double LnDensMax  = EOS_TAB_LOGDENS_MAX *Ln10 - log( UNIT_D      );
+   const double LnSEintMin = EOS_TAB_LOGSEINT_MIN*Ln10 - log( SQR(UNIT_V) );
+   const double LnSEintMax = EOS_TAB_LOGSEINT_MAX*Ln10 - log( SQR(UNIT_V) );
+
+   AuxArray_Flt[0] = LnDensMin;
+   AuxArray_Flt[1] = ( EOS_TAB_NDENS - 1 ) / ( LnDensMax - LnDensMin );
+   AuxArray_Flt[2] = LnSEintMin;
+   AuxArray_Flt[3] = ( EOS_TAB_NSEINT - 1 ) / ( LnSEintMax - LnSEintMin );
+   AuxArray_Flt[4] = EOS_TAB_YE_MIN;
+   AuxArray_Flt[5] = ( EOS_TAB_NYE > 1 ) ? ( EOS_TAB_NYE - 1 ) / ( EOS_TAB_YE_MAX - EOS_TAB_YE_MIN ) : 0.0;
+   AuxArray_Flt[6] = EoS_Tab_LnPresMin;
+   AuxArray_Flt[7] = ( EOS_TAB_NPRES - 1 ) / ( EoS_Tab_LnPresMax - EoS_Tab_LnPresMin );
+
+   AuxArray_Int[0] = EOS_TAB_NDENS;
+   AuxArray_Int[1] = EOS_TAB_NSEINT;
+   AuxArray_Int[2] = EOS_TAB_NYE;
+   AuxArray_Int[3] = EOS_TAB_NPRES;
+
+   if ( EOS_TAB_NYE > 1 )
+   {
+      char YeLabel[] = "Ye";
+      AuxArray_Int[4] = GetFieldIndex( YeLabel, CHECK_ON ) - NCOMP_FLUID;
+
+      if ( AuxArray_Int[4] < 0 )
+         Aux_Error( ERROR_INFO, "field \"%s\" must be a passive scalar !!\n", YeLabel );
+   }
+   else
+      AuxArray_Int[4] = -1;
+
+} // FUNCTION : EoS_SetAuxArray_Tabular
+
+#endif // #ifndef __CUDACC__
+
+
+
+// =============================================
+// II. Implement EoS conversion functions
+//     (1) EoS_DensEint2Pres_*
+//     (2) EoS_DensPres2Eint_*
+//     (3) EoS_DensPres2CSqr_*
+//     (4) EoS_General_* [OPTIONAL]
+// =============================================
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  EoS_Tabular_GetIdx
+// Description :  Convert a normalized table coordinate to the index of the left node and the
+//                linear interpolation weight of the right node
+//
+// Note        :  1. Coordinates outside the table are clamped to the table boundaries
+//                2. NaN coordinates are propagated to the weight so that the interpolated result is
+//                   also NaN and can be caught by the caller
+//
+// Parameter   :  x     : Normalized coordinate (i.e., (value-min)/spacing)
+//                N     : Number of table nodes along this dimension (must be >= 2)
+//                Idx   : Index of the left node to be returned
+//                Frac  : Weight of the right node to be returned
+//
+// Return      :  Idx, Frac
+//-------------------------------------------------------------------------------------------------------
+GPU_DEVICE
+static void EoS_Tabular_GetIdx( const real x, const int N, int &Idx, real &Frac )
+{
+
+   if      ( x >= (real)(N-1) )  {  Idx = N - 2;     Frac = (real)1.0;       }
+   else if ( x >= (real)0.0   )  {  Idx = (int)x;    Frac = x - (real)Idx;   }
+   else if ( x <  (real)0.0   )  {  Idx = 0;         Frac = (real)0.0;       }
+   else                          {  Idx = 0;         Frac = x;               }  // NaN
+
+} // FUNCTION : EoS_Tabular_GetIdx
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  EoS_Tabular_Interpolate
+// Description :  Bilinear (NYe=1) or trilinear (NYe>1) interpolation on a [NDens][NYe][NX][NVar] table
+//
+// Note        :  1. Interpolate all NVar variables of a node simultaneously since they are stored
+//                   contiguously
+//
+// Parameter   :  Out      : Output array with NVar elements
+//                Table    : Table to be interpolated
+//                NVar     : Number of variables per node
+//                NYe/NX   : Table size along the Ye/x dimensions
+//                IdxD/Y/X : Left node indices along the density/Ye/x dimensions
+//                FracD/Y/X: Right node weights along the density/Ye/x dimensions
+//
+// Return      :  Out[]
+//-------------------------------------------------------------------------------------------------------
+GPU_DEVICE
+static void EoS_Tabular_Interpolate( real Out[], const real *Table, const int NVar, const int NYe, const int NX,
+                                     const int IdxD, const int IdxY, const int IdxX,
+                                     const real FracD, const real FracY, const real FracX )
+{
+
+   const long StrideX = NVar;
+   const long StrideY = StrideX*NX;
+   const long StrideD = StrideY*NYe;
+   const real *T      = Table + IdxD*StrideD + IdxY*StrideY + IdxX*StrideX;
+
+   for (int v=0; v<NVar; v++)
+   {
+      const real *Tv = T + v;
+      real Val;
+
+      Val = ( (real)1.0 - FracD )*( ( (real)1.0 - FracX )*Tv[0      ] + FracX*Tv[        StrideX] )
+          +               FracD  *( ( (real)1.0 - FracX )*Tv[StrideD] + FracX*Tv[StrideD+StrideX] );
+
+      if ( NYe > 1 )
+      {
+         Tv += StrideY;
+
+         const real ValY = ( (real)1.0 - FracD )*( ( (real)1.0 - FracX )*Tv[0      ] + FracX*Tv[        StrideX] )
+                         +               FracD  *( ( (real)1.0 - FracX )*Tv[StrideD] + FracX*Tv[StrideD+StrideX] );
+
+         Val = ( (real)1.0 - FracY )*Val + FracY*ValY;
+      }
+
+      Out[v] = Val;
+   }
+
+} // FUNCTION : EoS_Tabular_Interpolate
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  EoS_Tabular_GetDensYeIdx
+// Description :  Compute the table indices and weights along the density and Ye dimensions
+//
+// Note        :  1. Use the first Ye node when Passive == NULL
+//                   --> Only routines assuming a Ye-independent EoS may pass Passive=NULL
+//
+// Parameter   :  Dens       : Gas mass density
+//                Passive    : Passive scalars
+//                AuxArray_* : Auxiliary arrays (see EoS_SetAuxArray_Tabular())
+//                IdxD/Y     : Left node indices to be returned
+//                FracD/Y    : Right node weights to be returned
+//
+// Return      :  IdxD/Y, FracD/Y
+//-------------------------------------------------------------------------------------------------------
+GPU_DEVICE
+static void EoS_Tabular_GetDensYeIdx( const real Dens, const real Passive[],
+                                      const double AuxArray_Flt[], const int AuxArray_Int[],
+                                      int &IdxD, int &IdxY, real &FracD, real &FracY )
+{
+
+   EoS_Tabular_GetIdx( ( LOG(Dens) - (real)AuxArray_Flt[0] )*(real)AuxArray_Flt[1], AuxArray_Int[0], IdxD, FracD );
+
+   if ( AuxArray_Int[2] > 1  &&  Passive != NULL )
+      EoS_Tabular_GetIdx( ( Passive[ AuxArray_Int[4] ]/Dens - (real)AuxArray_Flt[4] )*(real)AuxArray_Flt[5],
+                          AuxArray_Int[2], IdxY, FracY );
+   else
+   {
+      IdxY  = 0;
+      FracY = (real)0.0;
+   }
+
+} // FUNCTION : EoS_Tabular_GetDensYeIdx
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  EoS_DensEint2Pres_Tabular
+// Description :  Convert gas mass density and internal energy density to gas pressure
+//
+// Note        :  1. Internal energy density here is per unit volume instead of per unit mass
+//                2. See EoS_SetAuxArray_Tabular() for the values stored in AuxArray_Flt/Int[]
+//
+// Parameter   :  Dens       : Gas mass density
+//                Eint       : Gas internal energy density
+//                Passive    : Passive scalars (for Ye)
+//                AuxArray_* : Auxiliary arrays (see the Note above)
+//                Table      : EoS tables
+//                ExtraInOut : Useless for this EoS
+//
+// Return      :  Gas pressure
+//-------------------------------------------------------------------------------------------------------
+GPU_DEVICE_NOINLINE
+static real EoS_DensEint2Pres_Tabular( const real Dens, const real Eint, const real Passive[],
+                                       const double AuxArray_Flt[], const int AuxArray_Int[],
+                                       const real *const Table[EOS_NTABLE_MAX], real ExtraInOut[] )
+{
+
+// check
+#  ifdef GAMER_DEBUG
+   if ( AuxArray_Flt == NULL )   printf( "ERROR : AuxArray_Flt == NULL in %s !!\n", __FUNCTION__ );
+   if ( AuxArray_Int == NULL )   printf( "ERROR : AuxArray_Int == NULL in %s !!\n", __FUNCTION__ );
+   if ( Table == NULL )          printf( "ERROR : Table == NULL in %s !!\n", __FUNCTION__ );
+
+   if ( Hydro_CheckNegative(Dens) )
+      printf( "ERROR : invalid input density (%14.7e) at file <%s>, line <%d>, function <%s>\n",
+              Dens, __FILE__, __LINE__, __FUNCTION__ );
+
+   if ( Hydro_CheckNegative(Eint) )
+      printf( "ERROR : invalid input internal energy (%14.7e) at file <%s>, line <%d>, function <%s>\n",
+              Eint, __FILE__, __LINE__, __FUNCTION__ );
+#  endif // GAMER_DEBUG
+
+
+   int  IdxD, IdxY, IdxE;
+   real FracD, FracY, FracE, Pres2Eint;
+
+   EoS_Tabular_GetDensYeIdx( Dens, Passive, AuxArray_Flt, AuxArray_Int, IdxD, IdxY, FracD, FracY );
+   EoS_Tabular_GetIdx( ( LOG(Eint/Dens) - (real)AuxArray_Flt[2] )*(real)AuxArray_Flt[3], AuxArray_Int[1], IdxE, FracE );
+   EoS_Tabular_Interpolate( &Pres2Eint, Table[EOS_TAB_FORWARD], EOS_TAB_NVAR_FORWARD, AuxArray_Int[2], AuxArray_Int[1],
+                            IdxD, IdxY, IdxE, FracD, FracY, FracE );
+
+   return Eint*Pres2Eint;
+
+} // FUNCTION : EoS_DensEint2Pres_Tabular
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  EoS_DensPres2Eint_Tabular
+// Description :  Convert gas mass density and pressure to gas internal energy density
+//
+// Note        :  1. See EoS_DensEint2Pres_Tabular()
+//                2. Use the inverse table so that no root finding is required at run time
+//
+// Parameter   :  Dens       : Gas mass density
+//                Pres       : Gas pressure
+//                Passive    : Passive scalars (for Ye)
+//                AuxArray_* : Auxiliary arrays (see the Note above)
+//                Table      : EoS tables
+//                ExtraInOut : Useless for this EoS
+//
+// Return      :  Gas internal energy density
+//-------------------------------------------------------------------------------------------------------
+GPU_DEVICE_NOINLINE
+static real EoS_DensPres2Eint_Tabular( const real Dens, const real Pres, const real Passive[],
+                                       const double AuxArray_Flt[], const int AuxArray_Int[],
+                                       const real *const Table[EOS_NTABLE_MAX], real ExtraInOut[] )
+{
+
+// check
+#  ifdef GAMER_DEBUG
+   if ( AuxArray_Flt == NULL )   printf( "ERROR : AuxArray_Flt == NULL in %s !!\n", __FUNCTION__ );
+   if ( AuxArray_Int == NULL )   printf( "ERROR : AuxArray_Int == NULL in %s !!\n", __FUNCTION__ );
+   if ( Table == NULL )          printf( "ERROR : Table == NULL in %s !!\n", __FUNCTION__ );
+
+   if ( Hydro_CheckNegative(Dens) )
+      printf( "ERROR : invalid input density (%14.7e) at file <%s>, line <%d>, function <%s>\n",
+              Dens, __FILE__, __LINE__, __FUNCTION__ );
+
+   if ( Hydro_CheckNegative(Pres) )
+      printf( "ERROR : invalid input pressure (%14.7e) at file <%s>, line <%d>, function <%s>\n",
+              Pres, __FILE__, __LINE__, __FUNCTION__ );
+#  endif // GAMER_DEBUG
+
+
+   int  IdxD, IdxY, IdxP;
+   real FracD, FracY, FracP, Out[EOS_TAB_NVAR_INVERSE];
+
+   EoS_Tabular_GetDensYeIdx( Dens, Passive, AuxArray_Flt, AuxArray_Int, IdxD, IdxY, FracD, FracY );
+   EoS_Tabular_GetIdx( ( LOG(Pres) - (real)AuxArray_Flt[6] )*(real)AuxArray_Flt[7], AuxArray_Int[3], IdxP, FracP );
+   EoS_Tabular_Interpolate( Out, Table[EOS_TAB_INVERSE], EOS_TAB_NVAR_INVERSE, AuxArray_Int[2], AuxArray_Int[3],
+                            IdxD, IdxY, IdxP, FracD, FracY, FracP );
+
+   return Pres*Out[0];
+
+} // FUNCTION : EoS_DensPres2Eint_Tabular
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  EoS_DensPres2CSqr_Tabular
+// Description :  Convert gas mass density and pressure to sound speed squared
+//
+// Note        :  1. See EoS_DensPres2Eint_Tabular()
+//
+// Parameter   :  Dens       : Gas mass density
+//                Pres       : Gas pressure
+//                Passive    : Passive scalars (for Ye)
+//                AuxArray_* : Auxiliary arrays (see the Note above)
+//                Table      : EoS tables
+//                ExtraInOut : Useless for this EoS
+//
+// Return      :  Sound speed square
+//-------------------------------------------------------------------------------------------------------
+GPU_DEVICE_NOINLINE
+static real EoS_DensPres2CSqr_Tabular( const real Dens, const real Pres, const real Passive[],
+                                       const double AuxArray_Flt[], const int AuxArray_Int[],
+                                       const real *const Table[EOS_NTABLE_MAX], real ExtraInOut[] )
+{
+
+// check
+#  ifdef GAMER_DEBUG
+   if ( AuxArray_Flt == NULL )   printf( "ERROR : AuxArray_Flt == NULL in %s !!\n", __FUNCTION__ );
+   if ( AuxArray_Int == NULL )   printf( "ERROR : AuxArray_Int == NULL in %s !!\n", __FUNCTION__ );
+   if ( Table == NULL )          printf( "ERROR : Table == NULL in %s !!\n", __FUNCTION__ );
+
+   if ( Hydro_CheckNegative(Dens) )
+      printf( "ERROR : invalid input density (%14.7e) at file <%s>, line <%d>, function <%s>\n",
+              Dens, __FILE__, __LINE__, __FUNCTION__ );
+
+   if ( Hydro_CheckNegative(Pres) )
+      printf( "ERROR : invalid input pressure (%14.7e) at file <%s>, line <%d>, function <%s>\n",
+              Pres, __FILE__, __LINE__, __FUNCTION__ );
+#  endif // GAMER_DEBUG
+
+
+   int  IdxD, IdxY, IdxP;
+   real FracD, FracY, FracP, Out[EOS_TAB_NVAR_INVERSE];
+
+   EoS_Tabular_GetDensYeIdx( Dens, Passive, AuxArray_Flt, AuxArray_Int, IdxD, IdxY, FracD, FracY );
+   EoS_Tabular_GetIdx( ( LOG(Pres) - (real)AuxArray_Flt[6] )*(real)AuxArray_Flt[7], AuxArray_Int[3], IdxP, FracP );
+   EoS_Tabular_Interpolate( Out, Table[EOS_TAB_INVERSE], EOS_TAB_NVAR_INVERSE, AuxArray_Int[2], AuxArray_Int[3],
+                            IdxD, IdxY, IdxP, FracD, FracY, FracP );
+
+   return Pres*Out[1]/Dens;
+
+} // FUNCTION : EoS_DensPres2CSqr_Tabular
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  EoS_General_Tabular
+// Description :  General EoS converter: In[] -> Out[]
+//
+// Note        :  1. See EoS_DensEint2Pres_Tabular()
+//                2. In[] and Out[] must NOT overlap
+//                3. Useless for this EoS
+//
+// Parameter   :  Mode       : To support multiple modes in this general converter
+//                Out        : Output array
+//                In         : Input array
+//                AuxArray_* : Auxiliary arrays (see the Note above)
+//                Table      : EoS tables
+//
+// Return      :  Out[]
+//-------------------------------------------------------------------------------------------------------
+GPU_DEVICE_NOINLINE
+static void EoS_General_Tabular( const int Mode, real Out[], const real In[], const double AuxArray_Flt[],
+                                 const int AuxArray_Int[], const real *const Table[EOS_NTABLE_MAX] )
+{
+
+// not used by this EoS
+
+} // FUNCTION : EoS_General_Tabular
+
+
+
+// =============================================
+// III. Set EoS initialization functions
+// =============================================
+
+#ifdef __CUDACC__
+#  define FUNC_SPACE __device__ static
+#else
+#  define FUNC_SPACE            static
+#endif
+
+FUNC_SPACE EoS_DE2P_t EoS_DensEint2Pres_Ptr = EoS_DensEint2Pres_Tabular;
+FUNC_SPACE EoS_DP2E_t EoS_DensPres2Eint_Ptr = EoS_DensPres2Eint_Tabular;
+FUNC_SPACE EoS_DP2C_t EoS_DensPres2CSqr_Ptr = EoS_DensPres2CSqr_Tabular;
+FUNC_SPACE EoS_GENE_t EoS_General_Ptr       = EoS_General_Tabular;
+
+//-----------------------------------------------------------------------------------------
+// Function    :  EoS_SetCPU/GPUFunc_Tabular
+// Description :  Return the function pointers of the CPU/GPU EoS routines
+//
+// Note        :  1. Invoked by EoS_Init_Tabular()
+//                2. Must obtain the CPU and GPU function pointers by **separate** routines
+//                   since CPU and GPU functions are compiled completely separately in GAMER
+//                   --> In other words, a unified routine like the following won't work
+//
+//                      EoS_SetFunc_Tabular( CPU_FuncPtr, GPU_FuncPtr );
+//
+//                3. Call-by-reference
+//
+// Parameter   :  EoS_DensEint2Pres_CPU/GPUPtr : CPU/GPU function pointers to be set
+//                EoS_DensPres2Eint_CPU/GPUPtr : ...
+//                EoS_DensPres2CSqr_CPU/GPUPtr : ...
+//                EoS_General_CPU/GPUPtr       : ...
+//
+// Return      :  EoS_DensEint2Pres_CPU/GPUPtr, EoS_DensPres2Eint_CPU/GPUPtr,
+//                EoS_DensPres2CSqr_CPU/GPUPtr, EoS_General_CPU/GPUPtr
+//-----------------------------------------------------------------------------------------
+#ifdef __CUDACC__
+__host__
+void EoS_SetGPUFunc_Tabular( EoS_DE2P_t &EoS_DensEint2Pres_GPUPtr,
+                             EoS_DP2E_t &EoS_DensPres2Eint_GPUPtr,
+                             EoS_DP2C_t &EoS_DensPres2CSqr_GPUPtr,
+                             EoS_GENE_t &EoS_General_GPUPtr )
+{
+   CUDA_CHECK_ERROR(  cudaMemcpyFromSymbol( &EoS_DensEint2Pres_GPUPtr, EoS_DensEint2Pres_Ptr, sizeof(EoS_DE2P_t) )  );
+   CUDA_CHECK_ERROR(  cudaMemcpyFromSymbol( &EoS_DensPres2Eint_GPUPtr, EoS_DensPres2Eint_Ptr, sizeof(EoS_DP2E_t) )  );
+   CUDA_CHECK_ERROR(  cudaMemcpyFromSymbol( &EoS_DensPres2CSqr_GPUPtr, EoS_DensPres2CSqr_Ptr, sizeof(EoS_DP2C_t) )  );
+   CUDA_CHECK_ERROR(  cudaMemcpyFromSymbol( &EoS_General_GPUPtr,       EoS_General_Ptr,       sizeof(EoS_GENE_t) )  );
+}
+
+
+
+//-----------------------------------------------------------------------------------------
+// Function    :  EoS_SendTable2GPU_Tabular / EoS_FreeGPUTable_Tabular
+// Description :  Allocate/free the GPU EoS tables and transfer the CPU tables to GPU
+//
+// Note        :  1. Invoked by EoS_Init_Tabular() and EoS_End_Tabular(), respectively
+//                2. d_Table[] will be copied to the constant memory by CUAPI_SetConstMemory_EoS()
+//
+// Parameter   :  h_Table   : CPU tables
+//                d_Table   : GPU tables to be allocated/freed
+//                TableSize : Number of elements in each table
+//
+// Return      :  d_Table[]
+//-----------------------------------------------------------------------------------------
+__host__
+void EoS_SendTable2GPU_Tabular( real *h_Table[], real *d_Table[], const long TableSize[] )
+{
+   for (int t=0; t<EOS_NTABLE_MAX; t++)
+   {
+      if ( h_Table[t] == NULL )  continue;
+
+      CUDA_CHECK_ERROR(  cudaMalloc( (void**)&d_Table[t], TableSize[t]*sizeof(real) )  );
+      CUDA_CHECK_ERROR(  cudaMemcpy( d_Table[t], h_Table[t], TableSize[t]*sizeof(real), cudaMemcpyHostToDevice )  );
+   }
+}
+
+__host__
+void EoS_FreeGPUTable_Tabular( real *d_Table[] )
+{
+   for (int t=0; t<EOS_NTABLE_MAX; t++)
+   {
+      if ( d_Table[t] != NULL )  CUDA_CHECK_ERROR(  cudaFree( d_Table[t] )  );
+      d_Table[t] = NULL;
+   }
+}
+
+#else // #ifdef __CUDACC__
+
+void EoS_SetCPUFunc_Tabular( EoS_DE2P_t &EoS_DensEint2Pres_CPUPtr,
+                             EoS_DP2E_t &EoS_DensPres2Eint_CPUPtr,
+                             EoS_DP2C_t &EoS_DensPres2CSqr_CPUPtr,
+                             EoS_GENE_t &EoS_General_CPUPtr )
+{
+   EoS_DensEint2Pres_CPUPtr = EoS_DensEint2Pres_Ptr;
+   EoS_DensPres2Eint_CPUPtr = EoS_DensPres2Eint_Ptr;
+   EoS_DensPres2CSqr_CPUPtr = EoS_DensPres2CSqr_Ptr;
+   EoS_General_CPUPtr       = EoS_General_Ptr;
+}
+
+#endif // #ifdef __CUDACC__ ... else ...
+
+
+
+#ifndef __CUDACC__
+
+// local function prototypes
+void EoS_SetAuxArray_Tabular( double [], int [] );
+void EoS_SetCPUFunc_Tabular( EoS_DE2P_t &, EoS_DP2E_t &, EoS_DP2C_t &, EoS_GENE_t & );
+#ifdef GPU
+void EoS_SetGPUFunc_Tabular( EoS_DE2P_t &, EoS_DP2E_t &, EoS_DP2C_t &, EoS_GENE_t & );
+void EoS_SendTable2GPU_Tabular( real *[], real *[], const long [] );
+void EoS_FreeGPUTable_Tabular( real *[] );
+extern real *d_EoS_Table[EOS_NTABLE_MAX];
+#endif
+void EoS_LoadTable_Tabular();
+
+//-----------------------------------------------------------------------------------------
+// Function    :  EoS_Init_Tabular
+// Description :  Initialize EoS
+//
+// Note        :  1. Load the input table and construct the forward/inverse tables by invoking
+//                   EoS_LoadTable_Tabular()
+//                2. Set auxiliary arrays by invoking EoS_SetAuxArray_*()
+//                   --> It will be copied to GPU automatically in CUAPI_SetConstMemory()
+//                3. Set the CPU/GPU EoS routines by invoking EoS_SetCPU/GPUFunc_*()
+//                4. Invoked by EoS_Init()
+//                   --> Enable it by linking to the function pointer "EoS_Init_Ptr"
+//                5. Add "#ifndef __CUDACC__" since this routine is only useful on CPU
+//
+// Parameter   :  None
+//
+// Return      :  None
+//-----------------------------------------------------------------------------------------
+void EoS_Init_Tabular()
+{
+
+   EoS_LoadTable_Tabular();
+
+   EoS_SetAuxArray_Tabular( EoS_AuxArray_Flt, EoS_AuxArray_Int );
+   EoS_SetCPUFunc_Tabular( EoS_DensEint2Pres_CPUPtr, EoS_DensPres2Eint_CPUPtr,
+                           EoS_DensPres2CSqr_CPUPtr, EoS_General_CPUPtr );
+#  ifdef GPU
+   EoS_SetGPUFunc_Tabular( EoS_DensEint2Pres_GPUPtr, EoS_DensPres2Eint_GPUPtr,
+                           EoS_DensPres2CSqr_GPUPtr, EoS_General_GPUPtr );
+
+   long TableSize[EOS_NTABLE_MAX];
+   for (int t=0; t<EOS_NTABLE_MAX; t++)   TableSize[t] = 0;
+   TableSize[EOS_TAB_FORWARD] = (long)EOS_TAB_NDENS*EOS_TAB_NYE*EOS_TAB_NSEINT*EOS_TAB_NVAR_FORWARD;
+   TableSize[EOS_TAB_INVERSE] = (long)EOS_TAB_NDENS*EOS_TAB_NYE*EOS_TAB_NPRES *EOS_TAB_NVAR_INVERSE;
+
+   EoS_SendTable2GPU_Tabular( h_EoS_Table, d_EoS_Table, TableSize );
+#  endif
+
+} // FUNCTION : EoS_Init_Tabular
+
+
+
+//-----------------------------------------------------------------------------------------
+// Function    :  EoS_End_Tabular
+// Description :  Free the EoS tables
+//
+// Note        :  1. Invoked by EoS_End()
+//
+// Parameter   :  None
+//
+// Return      :  None
+//-----------------------------------------------------------------------------------------
+void EoS_End_Tabular()
+{
+
+   for (int t=0; t<EOS_NTABLE_MAX; t++)
+   {
+      delete [] h_EoS_Table[t];
+      h_EoS_Table[t] = NULL;
+   }
+
+#  ifdef GPU
+   EoS_FreeGPUTable_Tabular( d_EoS_Table );
+#  endif
+
+} // FUNCTION : EoS_End_Tabular
+
+
+
+//-----------------------------------------------------------------------------------------
+// Function    :  EoS_LoadTable_Tabular
+// Description :  Load the input EoS table and construct the forward and inverse tables
+//
+// Note        :  1. Invoked by EoS_Init_Tabular()
+//                2. See the top of this file for the format of the input table
+//                3. Pressure must increase monotonically with the specific internal energy
+//                   at fixed density and Ye
+//                4. Pressures outside the range of a given (density, Ye) column adopt the ratios at
+//                   the boundary of that column when constructing the inverse table
+//                5. All MPI ranks load the table
+//
+// Parameter   :  None
+//
+// Return      :  h_EoS_Table[EOS_TAB_FORWARD/EOS_TAB_INVERSE], EoS_Tab_LnPresMin/Max
+//-----------------------------------------------------------------------------------------
+void EoS_LoadTable_Tabular()
+{
+
+   if ( MPI_Rank == 0 )    Aux_Message( stdout, "   Loading the EoS table \"%s\" ...\n", EOS_TAB_NAME );
+
+
+// checks
+// parameters
+   if ( EOS_TAB_NDENS < 2 )   Aux_Error( ERROR_INFO, "EOS_TAB_NDENS = %d < 2 !!\n", EOS_TAB_NDENS );
+   if ( EOS_TAB_NSEINT < 2 )  Aux_Error( ERROR_INFO, "EOS_TAB_NSEINT = %d < 2 !!\n", EOS_TAB_NSEINT );
+   if ( EOS_TAB_NYE < 1 )     Aux_Error( ERROR_INFO, "EOS_TAB_NYE = %d < 1 !!\n", EOS_TAB_NYE );
+   if ( EOS_TAB_NPRES < 2 )   Aux_Error( ERROR_INFO, "EOS_TAB_NPRES = %d < 2 !!\n", EOS_TAB_NPRES );
+
+   if ( EOS_TAB_LOGDENS_MIN  == NoDef_double  ||  EOS_TAB_LOGDENS_MAX  == NoDef_double  ||
+        EOS_TAB_LOGSEINT_MIN == NoDef_double  ||  EOS_TAB_LOGSEINT_MAX == NoDef_double    )
+      Aux_Error( ERROR_INFO, "EOS_TAB_LOGDENS_MIN/MAX and EOS_TAB_LOGSEINT_MIN/MAX must be set !!\n" );
+
+   if ( EOS_TAB_LOGDENS_MIN >= EOS_TAB_LOGDENS_MAX )
+      Aux_Error( ERROR_INFO, "EOS_TAB_LOGDENS_MIN (%14.7e) >= EOS_TAB_LOGDENS_MAX (%14.7e) !!\n",
+                 EOS_TAB_LOGDENS_MIN, EOS_TAB_LOGDENS_MAX );
+
+   if ( EOS_TAB_LOGSEINT_MIN >= EOS_TAB_LOGSEINT_MAX )
+      Aux_Error( ERROR_INFO, "EOS_TAB_LOGSEINT_MIN (%14.7e) >= EOS_TAB_LOGSEINT_MAX (%14.7e) !!\n",
+                 EOS_TAB_LOGSEINT_MIN, EOS_TAB_LOGSEINT_MAX );
+
+   if ( EOS_TAB_NYE > 1  &&  EOS_TAB_YE_MIN >= EOS_TAB_YE_MAX )
+      Aux_Error( ERROR_INFO, "EOS_TAB_YE_MIN (%14.7e) >= EOS_TAB_YE_MAX (%14.7e) !!\n",
+                 EOS_TAB_YE_MIN, EOS_TAB_YE_MAX );
+
+// file existence
+   if ( ! Aux_CheckFileExist(EOS_TAB_NAME) )
+      Aux_Error( ERROR_INFO, "EoS table \"%s\" does not exist !!\n", EOS_TAB_NAME );
+
+// file size
+   const int  NDens    = EOS_TAB_NDENS;
+   const int  NYe      = EOS_TAB_NYE;
+   const int  NSEint   = EOS_TAB_NSEINT;
+   const int  NPres    = EOS_TAB_NPRES;
+   const long NNode    = (long)NDens*NYe*NSEint;
+   const long NInput   = NNode*2;
+
+   FILE *File = fopen( EOS_TAB_NAME, "rb" );
+
+   fseek( File, 0, SEEK_END );
+
+   const long ExpectSize = NInput*sizeof(double);
+   const long FileSize   = ftell( File );
+   if ( FileSize != ExpectSize )
+      Aux_Error( ERROR_INFO, "size of the EoS table <%s> (%ld) != expect (%ld) !!\n",
+                 EOS_TAB_NAME, FileSize, ExpectSize );
+
+
+// load the input table
+   double *Input = new double [NInput];
+
+   fseek( File, 0, SEEK_SET );
+   const long NLoad = fread( Input, sizeof(double), NInput, File );
+   fclose( File );
+
+   if ( NLoad != NInput )
+      Aux_Error( ERROR_INFO, "failed to load the EoS table <%s> (%ld != %ld) !!\n", EOS_TAB_NAME, NLoad, NInput );
+
+
+// convert to the natural logarithm in code units
+   const double LnUnitP    = log( UNIT_P );
+   const double LnUnitCSqr = log( SQR(UNIT_V) );
+
+   EoS_Tab_LnPresMin = +__DBL_MAX__;
+   EoS_Tab_LnPresMax = -__DBL_MAX__;
+
+   for (long n=0; n<NNode; n++)
+   {
+      const double Pres = Input[ 2*n + 0 ];
+      const double CSqr = Input[ 2*n + 1 ];
+
+      if ( !Aux_IsFinite(Pres)  ||  Pres <= 0.0  ||  !Aux_IsFinite(CSqr)  ||  CSqr <= 0.0 )
+         Aux_Error( ERROR_INFO, "invalid table entry %ld (pres %14.7e, cs^2 %14.7e) !!\n", n, Pres, CSqr );
+
+      Input[ 2*n + 0 ] = log( Pres ) - LnUnitP;
+      Input[ 2*n + 1 ] = log( CSqr ) - LnUnitCSqr;
+
+      EoS_Tab_LnPresMin = MIN( EoS_Tab_LnPresMin, Input[ 2*n + 0 ] );
+      EoS_Tab_LnPresMax = MAX( EoS_Tab_LnPresMax, Input[ 2*n + 0 ] );
+   }
+
+   if ( EoS_Tab_LnPresMin >= EoS_Tab_LnPresMax )
+      Aux_Error( ERROR_INFO, "EoS table has a constant pressure (ln(pres) = %14.7e) !!\n", EoS_Tab_LnPresMin );
+
+
+// construct the forward table
+   const double Ln10       = log( 10.0 );
+   const double LnDensMin  = EOS_TAB_LOGDENS_MIN*Ln10 - log( UNIT_D );
+   const double dLnDens    = ( EOS_TAB_LOGDENS_MAX - EOS_TAB_LOGDENS_MIN )*Ln10 / ( NDens - 1 );
+   const double LnSEintMin = EOS_TAB_LOGSEINT_MIN*Ln10 - LnUnitCSqr;
+   const double dLnSEint   = ( EOS_TAB_LOGSEINT_MAX - EOS_TAB_LOGSEINT_MIN )*Ln10 / ( NSEint - 1 );
+   const double dLnPres    = ( EoS_Tab_LnPresMax - EoS_Tab_LnPresMin ) / ( NPres - 1 );
+
+   h_EoS_Table[EOS_TAB_FORWARD] = new real [ NNode*EOS_TAB_NVAR_FORWARD ];
+
+   for (long n=0; n<NNode; n++)
+   {
+      const double LnDens  = LnDensMin  + ( n/(NYe*NSEint) )*dLnDens;
+      const double LnSEint = LnSEintMin + ( n%NSEint       )*dLnSEint;
+
+      h_EoS_Table[EOS_TAB_FORWARD][n] = (real)exp( Input[ 2*n + 0 ] - LnDens - LnSEint );
+   }
+
+
+// construct the inverse table by inverting each P(seint) column
+
+   h_EoS_Table[EOS_TAB_INVERSE] = new real [ (long)NDens*NYe*NPres*EOS_TAB_NVAR_INVERSE ];
+
+   for (long c=0; c<(long)NDens*NYe; c++)
+   {
+      const double *Column = Input + c*NSEint*2;
+      real         *Inv    = h_EoS_Table[EOS_TAB_INVERSE] + c*NPres*EOS_TAB_NVAR_INVERSE;
+      const double  LnDens = LnDensMin + ( c/NYe )*dLnDens;
+
+      for (int e=1; e<NSEint; e++)
+      {
+         if ( Column[ 2*e ] <= Column[ 2*(e-1) ] )
+            Aux_Error( ERROR_INFO, "pressure does not increase monotonically with seint (column %ld, node %d) !!\n",
+                       c, e );
+      }
+
+//    target pressures are sorted --> locate the enclosing segment incrementally
+      int e = 0;
+
+      for (int p=0; p<NPres; p++)
+      {
+         double LnPres = EoS_Tab_LnPresMin + p*dLnPres;
+         double LnSEint, LnCSqr;
+
+         if      ( LnPres <= Column[ 0 ] )
+         {
+            LnPres  = Column[ 0 ];
+            LnSEint = LnSEintMin;
+            LnCSqr  = Column[ 1 ];
+         }
+
+         else if ( LnPres >= Column[ 2*(NSEint-1) ] )
+         {
+            LnPres  = Column[ 2*(NSEint-1) ];
+            LnSEint = LnSEintMin + (NSEint-1)*dLnSEint;
+            LnCSqr  = Column[ 2*(NSEint-1) + 1 ];
+         }
+
+         else
+         {
+            while ( Column[ 2*(e+1) ] < LnPres )   e ++;
+
+            const double Frac = ( LnPres - Column[ 2*e ] ) / ( Column[ 2*(e+1) ] - Column[ 2*e ] );
+
+            LnSEint = LnSEintMin + ( e + Frac )*dLnSEint;
+            LnCSqr  = ( 1.0 - Frac )*Column[ 2*e + 1 ] + Frac*Column[ 2*(e+1) + 1 ];
+         }
+
+         Inv[ p*EOS_TAB_NVAR_INVERSE + 0 ] = (real)exp( LnDens + LnSEint - LnPres );
+         Inv[ p*EOS_TAB_NVAR_INVERSE + 1 ] = (real)exp( LnDens + LnCSqr  - LnPres );
+      }
+   } // for (long c=0; c<(long)NDens*NYe; c++)
+
+
+   delete [] Input;
+
+
+   if ( MPI_Rank == 0 )    Aux_Message( stdout, "   Loading the EoS table \"%s\" ... done\n", EOS_TAB_NAME );
+
+} // FUNCTION : EoS_LoadTable_Tabular
+
+#endif // #ifndef __CUDACC__
+
+
+
+#endif // #if ( MODEL == HYDRO )
@@ -0,0 +1 @@
+CPU_EoS_Tabular.cpp
\ No newline at end of file
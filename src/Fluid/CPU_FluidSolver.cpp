@@ -51,7 +51,7 @@ void CPU_FluidSolver_MHM(
    const real DualEnergySwitch, const bool NormPassive, const int NNorm,
    const int c_NormIdx[],
    const bool JeansMinPres, const real JeansMinPres_Coeff,
-   const EoS_t EoS );
+   const EoS_t EoS, const bool FuseSrc, const double TimeNew, const int SlabSize );
 #elif ( FLU_SCHEME == CTU )
 void CPU_FluidSolver_CTU(
    const real   g_Flu_Array_In [][NCOMP_TOTAL][ CUBE(FLU_NXT) ],
@@ -78,7 +78,7 @@ void CPU_FluidSolver_CTU(
    const real DualEnergySwitch, const bool NormPassive, const int NNorm,
    const int c_NormIdx[],
    const bool JeansMinPres, const real JeansMinPres_Coeff,
-   const EoS_t EoS );
+   const EoS_t EoS, const bool FuseSrc, const double TimeNew );
 #endif // FLU_SCHEME
 
 #elif ( MODEL == ELBDM )
@@ -160,6 +160,11 @@ static real (*h_EC_Ele     )[NCOMP_MAG][ CUBE(N_EC_ELE)          ] = NULL;
 //                                      --> Should be set to the global variable "PassiveNorm_VarIdx"
 //                JeansMinPres        : Apply minimum pressure estimated from the Jeans length
 //                JeansMinPres_Coeff  : Coefficient used by JeansMinPres = G*(Jeans_NCell*Jeans_dh)^2/(Gamma*pi);
+//                FuseSrc             : Add the local source terms at the end of the full-step update (for SRC_FUSE_FLUID)
+//                                      --> Only supported by the MHM/MHM_RP/CTU schemes
+//                TimeNew             : Physical time after update (for SRC_FUSE_FLUID only)
+//                SlabSize            : Number of z planes updated at a time in each patch group (for OPT__FLU_SLAB)
+//                                      --> Only supported by the non-MHD MHM/MHM_RP schemes
 //-------------------------------------------------------------------------------------------------------
 void CPU_FluidSolver( real h_Flu_Array_In[][FLU_NIN][ CUBE(FLU_NXT) ],
                       real h_Flu_Array_Out[][FLU_NOUT][ CUBE(PS2) ],
@@ -177,7 +182,8 @@ void CPU_FluidSolver( real h_Flu_Array_In[][FLU_NIN][ CUBE(FLU_NXT) ],
                       const double Time, const bool UsePot, const OptExtAcc_t ExtAcc,
                       const real MinDens, const real MinPres, const real MinEint,
                       const real DualEnergySwitch, const bool NormPassive, const int NNorm, const int NormIdx[],
-                      const bool JeansMinPres, const real JeansMinPres_Coeff )
+                      const bool JeansMinPres, const real JeansMinPres_Coeff,
+                      const bool FuseSrc, const double TimeNew, const int SlabSize )
 {
 
 // check
@@ -210,7 +216,8 @@ void CPU_FluidSolver( real h_Flu_Array_In[][FLU_NIN][ CUBE(FLU_NXT) ],
                             h_PriVar, h_Slope_PPM, h_FC_Var, h_FC_Flux, h_FC_Mag_Half, h_EC_Ele,
                             NPatchGroup, dt, dh, StoreFlux, StoreElectric, LR_Limiter, MinMod_Coeff, Time,
                             UsePot, ExtAcc, CPUExtAcc_Ptr, ExtAcc_AuxArray, MinDens, MinPres, MinEint,
-                            DualEnergySwitch, NormPassive, NNorm, NormIdx, JeansMinPres, JeansMinPres_Coeff, EoS );
+                            DualEnergySwitch, NormPassive, NNorm, NormIdx, JeansMinPres, JeansMinPres_Coeff, EoS,
+                            FuseSrc, TimeNew, SlabSize );
 
 #     elif ( FLU_SCHEME == CTU )
 
@@ -219,7 +226,8 @@ void CPU_FluidSolver( real h_Flu_Array_In[][FLU_NIN][ CUBE(FLU_NXT) ],
                             h_PriVar, h_Slope_PPM, h_FC_Var, h_FC_Flux, h_FC_Mag_Half, h_EC_Ele,
                             NPatchGroup, dt, dh, StoreFlux, StoreElectric, LR_Limiter, MinMod_Coeff, Time,
                             UsePot, ExtAcc, CPUExtAcc_Ptr, ExtAcc_AuxArray, MinDens, MinPres, MinEint,
-                            DualEnergySwitch, NormPassive, NNorm, NormIdx, JeansMinPres, JeansMinPres_Coeff, EoS );
+                            DualEnergySwitch, NormPassive, NNorm, NormIdx, JeansMinPres, JeansMinPres_Coeff, EoS,
+                            FuseSrc, TimeNew );
 
 #     else
 
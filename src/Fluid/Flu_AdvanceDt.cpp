@@ -9,6 +9,11 @@ int FluStatus_ThisRank;
 void Flu_SwapFixUpTempArray( const int lv );
 void Flu_InitFixUpTempArray( const int lv );
 
+// defined in Flu_RetryLocal.cpp
+#if ( MODEL == HYDRO )
+int  Flu_RetryLocal( const int lv, const double TimeNew, const double TimeOld, const double dt, const int SaveSg_Flu );
+#endif
+
 
 
 
@@ -19,6 +24,8 @@ void Flu_InitFixUpTempArray( const int lv );
 // Note        :  1. Invoke InvokeSolver()
 //                2. Currently the updated data can only be stored in the different sandglass from the
 //                   input data
+//                3. Also add the local source terms when SRC_FUSE_FLUID is on
+//                   --> Src_AdvanceDt() is skipped in this case
 //
 // Parameter   :  lv           : Target refinement level
 //                TimeNew      : Target physical time to reach
@@ -56,11 +63,30 @@ int Flu_AdvanceDt( const int lv, const double TimeNew, const double TimeOld, con
 #  endif
 
 
+// work prior to the source terms fused into the fluid solver (see Src_AdvanceDt())
+// --> invoke it here instead of in EvolveLevel() so that it is redone when AUTO_REDUCE_DT reduces dt
+   if ( SRC_FUSE_FLUID  &&  SrcTerms.Any )   Src_WorkBeforeMajorFunc( lv, TimeNew, TimeOld, dt );
+
+
 // invoke the fluid solver
+// --> for OPT__SINGLE_SANDGLASS, the old-time data are released during the fluid solver (see Flu_SingleSg.cpp)
    FluStatus_ThisRank = GAMER_SUCCESS;
 
+   Flu_SingleSg_Begin( lv, SaveSg_Flu, SaveSg_Mag );
+
    InvokeSolver( FLUID_SOLVER, lv, TimeNew, TimeOld, dt, NULL_REAL, SaveSg_Flu, SaveSg_Mag, NULL_INT, OverlapMPI, Overlap_Sync );
 
+   Flu_SingleSg_End( lv );
+
+
+// re-solve the failed patch groups locally (only for AUTO_REDUCE_DT_LOCAL)
+// --> FluStatus_ThisRank becomes GAMER_FAILED only if the patch-local retry also fails, in which case
+//     the whole level will be advanced again with a smaller dt
+#  if ( MODEL == HYDRO )
+   if ( AUTO_REDUCE_DT_LOCAL  &&  Flu_RetryLocal( lv, TimeNew, TimeOld, dt, SaveSg_Flu ) == GAMER_FAILED )
+      FluStatus_ThisRank = GAMER_FAILED;
+#  endif
+
 
 // collect the fluid solver status from all ranks (only necessary for AUTO_REDUCE_DT)
    int FluStatus_AllRank;
@@ -8,13 +8,17 @@ extern int FluStatus_ThisRank;
 // whether or not to continue applying AUTO_REDUCE_DT (decalred in Flu_AdvanceDt.cpp)
 extern bool AutoReduceDt_Continue;
 
+// defined in Flu_RetryLocal.cpp
+void Flu_RetryLocal_Record( const int NPG, const int *PID0_List, const bool *Failed,
+                            const real h_Flux_Array[][9][NFLUX_TOTAL][ SQR(PS2) ] );
 
-static void StoreFlux( const int lv, const real Flux_Array[][9][NFLUX_TOTAL][ SQR(PS2) ],
-                       const int NPG, const int *PID0_List, const real dt );
+
+void StoreFlux( const int lv, const real Flux_Array[][9][NFLUX_TOTAL][ SQR(PS2) ],
+                const int NPG, const int *PID0_List, const real dt );
 static void CorrectFlux( const int SonLv, const real Flux_Array[][9][NFLUX_TOTAL][ SQR(PS2) ],
                          const int NPG, const int *PID0_List, const real dt );
 #if ( MODEL == HYDRO )
-static bool Unphysical( const real Fluid[], const int CheckMode, const real Emag );
+bool Unphysical( const real Fluid[], const int CheckMode, const real Emag );
 static void CorrectUnphysical( const int lv, const int NPG, const int *PID0_List,
                                const real h_Flu_Array_F_In[][FLU_NIN][ CUBE(FLU_NXT) ],
                                real h_Flu_Array_F_Out[][FLU_NOUT][ CUBE(PS2) ],
@@ -22,7 +26,7 @@ static void CorrectUnphysical( const int lv, const int NPG, const int *PID0_List
                                real h_Flux_Array[][9][NFLUX_TOTAL][ SQR(PS2) ],
                                const real h_Mag_Array_F_In[][NCOMP_MAG][ FLU_NXT_P1*SQR(FLU_NXT) ],
                                const real h_Mag_Array_F_Out[][NCOMP_MAG][ PS2P1*SQR(PS2) ],
-                               const real dt );
+                               const real dt, const double TimeNew, const double TimeOld );
 #ifdef MHD
 void StoreElectric( const int lv, const real h_Ele_Array[][9][NCOMP_ELE][ PS2P1*PS2 ],
                     const int NPG, const int *PID0_List, const real dt );
@@ -66,6 +70,8 @@ extern void Hydro_RiemannSolver_HLLE( const int XYZ, real Flux_Out[], const real
 //                h_Flu_Array_F_In  : Host array storing the input fluid variables
 //                h_Mag_Array_F_In  : Host array storing the input B field (for MHD only)
 //                dt                : Evolution time-step
+//                TimeNew           : Target physical time to reach (for SRC_FUSE_FLUID only)
+//                TimeOld           : Physical time before update   (for SRC_FUSE_FLUID only)
 //-------------------------------------------------------------------------------------------------------
 void Flu_Close( const int lv, const int SaveSg_Flu, const int SaveSg_Mag,
                 real h_Flux_Array[][9][NFLUX_TOTAL][ SQR(PS2) ],
@@ -76,14 +82,14 @@ void Flu_Close( const int lv, const int SaveSg_Flu, const int SaveSg_Mag,
                 const int NPG, const int *PID0_List,
                 const real h_Flu_Array_F_In[][FLU_NIN][ CUBE(FLU_NXT) ],
                 const real h_Mag_Array_F_In[][NCOMP_MAG][ FLU_NXT_P1*SQR(FLU_NXT) ],
-                const double dt )
+                const double dt, const double TimeNew, const double TimeOld )
 {
 
 // try to correct the unphysical results in h_Flu_Array_F_Out (e.g., negative density)
 // --> must be done BEFORE invoking both StoreFlux() and CorrectFlux() since CorrectUnphysical() might modify the flux array
 #  if ( MODEL == HYDRO )
    CorrectUnphysical( lv, NPG, PID0_List, h_Flu_Array_F_In, h_Flu_Array_F_Out, h_DE_Array_F_Out, h_Flux_Array,
-                      h_Mag_Array_F_In, h_Mag_Array_F_Out, dt );
+                      h_Mag_Array_F_In, h_Mag_Array_F_Out, dt, TimeNew, TimeOld );
 #  endif
 
 
@@ -447,7 +453,9 @@ bool Unphysical( const real Fluid[], const int CheckMode, const real Emag )
 //                         Apply floors
 //
 //                      if ( still_found_unphysical )
-//                         if ( AUTO_REDUCE_DT )
+//                         if ( AUTO_REDUCE_DT_LOCAL )
+//                            Record the patch group and re-solve it with sub-steps in Flu_RetryLocal()
+//                         else if ( AUTO_REDUCE_DT )
 //                            Invoke the fluid solver again on the same level but with a smaller dt
 //                         else
 //                            Print debug messages and abort
@@ -465,6 +473,7 @@ bool Unphysical( const real Fluid[], const int CheckMode, const real Emag )
 //                h_Mag_Array_F_In  : Input B field array
 //                h_Mag_Array_F_Out : Output B field array
 //                dt                : Evolution time-step
+//                TimeNew/Old       : Physical time after/before update (for SRC_FUSE_FLUID only)
 //-------------------------------------------------------------------------------------------------------
 void CorrectUnphysical( const int lv, const int NPG, const int *PID0_List,
                         const real h_Flu_Array_F_In[][FLU_NIN][ CUBE(FLU_NXT) ],
@@ -473,7 +482,7 @@ void CorrectUnphysical( const int lv, const int NPG, const int *PID0_List,
                         real h_Flux_Array[][9][NFLUX_TOTAL][ SQR(PS2) ],
                         const real h_Mag_Array_F_In[][NCOMP_MAG][ FLU_NXT_P1*SQR(FLU_NXT) ],
                         const real h_Mag_Array_F_Out[][NCOMP_MAG][ PS2P1*SQR(PS2) ],
-                        const real dt )
+                        const real dt, const double TimeNew, const double TimeOld )
 {
 
    const real dh               = (real)amr->dh[lv];
@@ -487,6 +496,16 @@ void CorrectUnphysical( const int lv, const int NPG, const int *PID0_List,
    long NCorrThisTime = 0;
    bool CorrectUnphy  = GAMER_SUCCESS;
 
+// patch groups to be re-solved by Flu_RetryLocal() for AUTO_REDUCE_DT_LOCAL
+   bool *RetryPG = NULL;
+
+   if ( AUTO_REDUCE_DT_LOCAL  &&  AutoReduceDt_Continue )
+   {
+      RetryPG = new bool [NPG];
+
+      for (int TID=0; TID<NPG; TID++)  RetryPG[TID] = false;
+   }
+
 
 // OpenMP parallel region
 #  pragma omp parallel
@@ -768,6 +787,31 @@ void CorrectUnphysical( const int lv, const int NPG, const int *PID0_List,
             }
 
 
+//          ========================================================================================
+//          (D) add the source terms fused into the fluid solver again for SRC_FUSE_FLUID
+//              --> the 1st-order-flux correction recomputes Update[] from the input data, which do not
+//                  include the source terms applied by Hydro_FullStepUpdate()
+//              --> skip cells that remain unphysical, which will be handled below anyway
+//          ========================================================================================
+            else if ( SRC_FUSE_FLUID  &&  !Unphysical(Update, CheckMinEint, Emag_Out) )
+            {
+               const patch_t *pa0 = amr->patch[0][lv][ PID0_List[TID] ];
+               double xyz[3];
+
+               for (int d=0; d<3; d++)    xyz[d] = pa0->EdgeL[d] + ( ijk_out[d] + 0.5 )*amr->dh[lv];
+
+#              ifdef MHD
+               real B[NCOMP_MAG];
+               MHD_GetCellCenteredBField( B, h_Mag_Array_F_Out[TID][MAGX], h_Mag_Array_F_Out[TID][MAGY],
+                                          h_Mag_Array_F_Out[TID][MAGZ], PS2, PS2, PS2, ijk_out[0], ijk_out[1], ijk_out[2] );
+#              else
+               real *B = NULL;
+#              endif
+
+               Src_FuseFluid( Update, B, dt, dh, xyz[0], xyz[1], xyz[2], TimeNew, TimeOld, MIN_DENS, MIN_PRES, MIN_EINT );
+            }
+
+
 //          ensure positive density
 //          --> apply it only when AutoReduceDt_Continue is false
 //              --> otherwise AUTO_REDUCE_DT may not be triggered due to this density floor
@@ -818,10 +862,18 @@ void CorrectUnphysical( const int lv, const int NPG, const int *PID0_List,
 //          --> when AutoReduceDt_Continue is true, we still check Eint instead of Etot
             if ( Unphysical(Update, (AutoReduceDt_Continue)?CheckMinEint:CheckMinEtot, Emag_Out) )
             {
-//             set CorrectUnphy = GAMER_FAILED if any cells fail
+//             record the failed patch group for AUTO_REDUCE_DT_LOCAL
+//             --> each patch group is processed by a single thread and thus no thread racing
+               if ( RetryPG != NULL )
+                  RetryPG[TID] = true;
+
+//             otherwise, set CorrectUnphy = GAMER_FAILED if any cells fail
 //             --> use critical directive to avoid thread racing (may not be necessary here?)
-#              pragma omp critical
-               CorrectUnphy = GAMER_FAILED;
+               else
+               {
+#                 pragma omp critical
+                  CorrectUnphy = GAMER_FAILED;
+               }
 
 
 //             output the debug information (only if AutoReduceDt_Continue is false)
@@ -1008,6 +1060,16 @@ void CorrectUnphysical( const int lv, const int NPG, const int *PID0_List,
    } // end of OpenMP parallel region
 
 
+// record the failed patch groups and their fluxes for AUTO_REDUCE_DT_LOCAL
+// --> they will be re-solved by Flu_RetryLocal() after all patch groups on this level have been updated
+   if ( RetryPG != NULL )
+   {
+      Flu_RetryLocal_Record( NPG, PID0_List, RetryPG, h_Flux_Array );
+
+      delete [] RetryPG;
+   }
+
+
 // operations when CorrectUnphysical() fails
    if ( CorrectUnphy == GAMER_FAILED )
    {
@@ -172,8 +172,8 @@ void Flu_FixUp_Restrict( const int FaLv, const int SonFluSg, const int FaFluSg,
          for (int v=0; v<NFluVar; v++)
          {
             const int TFluVarIdx = TFluVarIdxList[v];
-            const real (*SonPtr)[PS1][PS1] = amr->patch[SonFluSg][SonLv][SonPID]->fluid[TFluVarIdx];
-                  real (* FaPtr)[PS1][PS1] = amr->patch[ FaFluSg][ FaLv][ FaPID]->fluid[TFluVarIdx];
+            const real_store (*SonPtr)[PS1][PS1] = amr->patch[SonFluSg][SonLv][SonPID]->fluid[TFluVarIdx];
+                  real_store (* FaPtr)[PS1][PS1] = amr->patch[ FaFluSg][ FaLv][ FaPID]->fluid[TFluVarIdx];
 
             int ii, jj, kk, I, J, K, Ip, Jp, Kp;
 
@@ -193,8 +193,8 @@ void Flu_FixUp_Restrict( const int FaLv, const int SonFluSg, const int FaFluSg,
 #        ifdef GRAVITY
          if ( ResPot )
          {
-            const real (*SonPtr)[PS1][PS1] = amr->patch[SonPotSg][SonLv][SonPID]->pot;
-                  real (* FaPtr)[PS1][PS1] = amr->patch[ FaPotSg][ FaLv][ FaPID]->pot;
+            const real_store (*SonPtr)[PS1][PS1] = amr->patch[SonPotSg][SonLv][SonPID]->pot;
+                  real_store (* FaPtr)[PS1][PS1] = amr->patch[ FaPotSg][ FaLv][ FaPID]->pot;
 
             int ii, jj, kk, I, J, K, Ip, Jp, Kp;
 
@@ -221,8 +221,8 @@ void Flu_FixUp_Restrict( const int FaLv, const int SonFluSg, const int FaFluSg,
             int idx_fa, idx_son0, I, J, K;
 
 //          Bx
-            const real *SonBx = amr->patch[SonMagSg][SonLv][SonPID]->magnetic[0];
-                  real * FaBx = amr->patch[ FaMagSg][ FaLv][ FaPID]->magnetic[0];
+            const real_store *SonBx = amr->patch[SonMagSg][SonLv][SonPID]->magnetic[0];
+                  real_store * FaBx = amr->patch[ FaMagSg][ FaLv][ FaPID]->magnetic[0];
 
             for (int k=0; k<PS1_half;   k++)  {  K = k*2;
             for (int j=0; j<PS1_half;   j++)  {  J = j*2;
@@ -238,8 +238,8 @@ void Flu_FixUp_Restrict( const int FaLv, const int SonFluSg, const int FaFluSg,
             }}}
 
 //          By
-            const real *SonBy = amr->patch[SonMagSg][SonLv][SonPID]->magnetic[1];
-                  real * FaBy = amr->patch[ FaMagSg][ FaLv][ FaPID]->magnetic[1];
+            const real_store *SonBy = amr->patch[SonMagSg][SonLv][SonPID]->magnetic[1];
+                  real_store * FaBy = amr->patch[ FaMagSg][ FaLv][ FaPID]->magnetic[1];
 
             for (int k=0; k<PS1_half;   k++)  {  K = k*2;
             for (int j=0; j<PS1_half+1; j++)  {  J = j*2;
@@ -255,8 +255,8 @@ void Flu_FixUp_Restrict( const int FaLv, const int SonFluSg, const int FaFluSg,
             }}}
 
 //          Bz
-            const real *SonBz = amr->patch[SonMagSg][SonLv][SonPID]->magnetic[2];
-                  real * FaBz = amr->patch[ FaMagSg][ FaLv][ FaPID]->magnetic[2];
+            const real_store *SonBz = amr->patch[SonMagSg][SonLv][SonPID]->magnetic[2];
+                  real_store * FaBz = amr->patch[ FaMagSg][ FaLv][ FaPID]->magnetic[2];
 
             for (int k=0; k<PS1_half+1; k++)  {  K = k*2;
             for (int j=0; j<PS1_half;   j++)  {  J = j*2;
@@ -323,15 +323,21 @@ void Flu_FixUp_Restrict( const int FaLv, const int SonFluSg, const int FaFluSg,
          const real UseEnpy2FixEngy  = HUGE_NUMBER;
          char dummy;    // we do not record the dual-energy status here
 
+//       use local copies since the patch data may be stored in a different precision (i.e., MIXED_PRECISION)
+         real Etot = amr->patch[FaFluSg][FaLv][FaPID]->fluid[ENGY][k][j][i];
+         real Enpy = amr->patch[FaFluSg][FaLv][FaPID]->fluid[ENPY][k][j][i];
+
          Hydro_DualEnergyFix( amr->patch[FaFluSg][FaLv][FaPID]->fluid[DENS][k][j][i],
                               amr->patch[FaFluSg][FaLv][FaPID]->fluid[MOMX][k][j][i],
                               amr->patch[FaFluSg][FaLv][FaPID]->fluid[MOMY][k][j][i],
                               amr->patch[FaFluSg][FaLv][FaPID]->fluid[MOMZ][k][j][i],
-                              amr->patch[FaFluSg][FaLv][FaPID]->fluid[ENGY][k][j][i],
-                              amr->patch[FaFluSg][FaLv][FaPID]->fluid[ENPY][k][j][i],
+                              Etot, Enpy,
                               dummy, EoS_AuxArray_Flt[1], EoS_AuxArray_Flt[2], CheckMinPres_Yes, MIN_PRES,
                               UseEnpy2FixEngy, Emag );
 
+         amr->patch[FaFluSg][FaLv][FaPID]->fluid[ENGY][k][j][i] = Etot;
+         amr->patch[FaFluSg][FaLv][FaPID]->fluid[ENPY][k][j][i] = Enpy;
+
 #        else // #ifdef DUAL_ENERGY
 
 //       actually it might not be necessary to check the minimum internal energy here
@@ -14,7 +14,7 @@
 //                h_Flu_Array_F_In     : Host array to store the prepared fluid data
 //                h_Mag_Array_F_In     : Host array to store the prepared B field (for MHD onlhy)
 //                h_Pot_Array_USG_F    : Host array to store the prepared potential data (for UNSPLIT_GRAVITY only)
-//                h_Corner_Array_USG_F : Host array to store the prepared corner data (for UNSPLIT_GRAVITY only)
+//                h_Corner_Array_F     : Host array to store the prepared corner data (for UNSPLIT_GRAVITY and SRC_FUSE_FLUID only)
 //                NPG                  : Number of patch groups to be prepared at a time
 //                PID0_List            : List recording the patch indices with LocalID==0 to be udpated
 //-------------------------------------------------------------------------------------------------------
@@ -72,9 +72,14 @@ void Flu_Prepare( const int lv, const double PrepTime,
                       USG_GHOST_SIZE_F, NPG, PID0_List, _POTE, _NONE,
                       OPT__GRA_INT_SCHEME, INT_NONE, UNIT_PATCHGROUP, NSIDE_26, IntPhase_No,
                       OPT__BC_FLU, OPT__BC_POT, MinDens_No, MinPres_No, DE_Consistency_No );
+#  endif // #ifdef UNSPLIT_GRAVITY
 
 // prepare the corner array
-   if ( OPT__EXT_ACC )
+#  ifdef UNSPLIT_GRAVITY
+   if ( OPT__EXT_ACC  ||  SRC_FUSE_FLUID )
+#  else
+   if ( SRC_FUSE_FLUID )
+#  endif
    {
       const double dh_half = 0.5*amr->dh[lv];
 
@@ -89,6 +94,9 @@ void Flu_Prepare( const int lv, const double PrepTime,
          for (int d=0; d<3; d++)    h_Corner_Array_F[TID][d] = amr->patch[0][lv][PID0]->EdgeL[d] + dh_half;
       } // for (int TID=0; TID<NPG; TID++)
    }
-#  endif // #ifdef UNSPLIT_GRAVITY
+
+
+// release the old-time data no longer required for OPT__SINGLE_SANDGLASS
+   Flu_SingleSg_Prepared( lv, NPG, PID0_List );
 
 } // FUNCTION : Flu_Prepare
@@ -0,0 +1,417 @@
+#include "GAMER.h"
+
+#if ( MODEL == HYDRO )
+
+
+
+// whether or not to continue applying AUTO_REDUCE_DT (declared in EvolveLevel.cpp)
+extern bool AutoReduceDt_Continue;
+
+// defined in Flu_Close.cpp
+void StoreFlux( const int lv, const real Flux_Array[][9][NFLUX_TOTAL][ SQR(PS2) ],
+                const int NPG, const int *PID0_List, const real dt );
+bool Unphysical( const real Fluid[], const int CheckMode, const real Emag );
+
+static bool SubCycle( const int lv, const double TimeNew, const double TimeOld, const double dt, const int NSub,
+                      const int NPG, const int *PID0_List, const real Flux_Full[][9][NFLUX_TOTAL][ SQR(PS2) ],
+                      real FluxSum[][9][NFLUX_TOTAL][ SQR(PS2) ] );
+
+
+// patch groups failing in the fluid solver and their original fluxes recorded by Flu_RetryLocal_Record()
+static int    Retry_NPG       = 0;
+static int    Retry_NPG_Alloc = 0;
+static int   *Retry_PID0      = NULL;
+static real (*Retry_Flux)[9][NFLUX_TOTAL][ SQR(PS2) ] = NULL;
+
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  Flu_RetryLocal_Record
+// Description :  Record the patch groups failing in the fluid solver for the patch-local retry of AUTO_REDUCE_DT
+//
+// Note        :  1. Invoked by Flu_Close()->CorrectUnphysical() when AUTO_REDUCE_DT_LOCAL is on
+//                2. Also record the fluxes of the failed patch groups, which will be imposed on the
+//                   boundaries of these patch groups after the retry to ensure conservation
+//                   --> These fluxes have been used by the neighboring patch groups and by the flux fix-up
+//                       operations (i.e., StoreFlux() and CorrectFlux())
+//                3. Not thread-safe
+//
+// Parameter   :  NPG          : Number of patch groups in the input arrays
+//                PID0_List    : List recording the patch indices with LocalID==0
+//                Failed       : Whether each patch group fails or not
+//                h_Flux_Array : Array storing the fluxes of all patch groups
+//-------------------------------------------------------------------------------------------------------
+void Flu_RetryLocal_Record( const int NPG, const int *PID0_List, const bool *Failed,
+                            const real h_Flux_Array[][9][NFLUX_TOTAL][ SQR(PS2) ] )
+{
+
+   int NFailed = 0;
+
+   for (int TID=0; TID<NPG; TID++)
+      if ( Failed[TID] )   NFailed ++;
+
+   if ( NFailed == 0 )  return;
+
+
+// allocate or enlarge the arrays
+   if ( Retry_NPG + NFailed > Retry_NPG_Alloc )
+   {
+      Retry_NPG_Alloc = 2*( Retry_NPG + NFailed );
+
+      int   *PID0_New = new int  [Retry_NPG_Alloc];
+      real (*Flux_New)[9][NFLUX_TOTAL][ SQR(PS2) ] = new real [Retry_NPG_Alloc][9][NFLUX_TOTAL][ SQR(PS2) ];
+
+      if ( Retry_NPG > 0 )
+      {
+         memcpy( PID0_New, Retry_PID0, Retry_NPG*sizeof(int) );
+         memcpy( Flux_New, Retry_Flux, Retry_NPG*sizeof(*Retry_Flux) );
+      }
+
+      delete [] Retry_PID0;
+      delete [] Retry_Flux;
+
+      Retry_PID0 = PID0_New;
+      Retry_Flux = Flux_New;
+   }
+
+
+// record the failed patch groups
+   for (int TID=0; TID<NPG; TID++)
+   {
+      if ( ! Failed[TID] )  continue;
+
+      Retry_PID0[Retry_NPG] = PID0_List[TID];
+      memcpy( Retry_Flux[Retry_NPG], h_Flux_Array[TID], sizeof(*Retry_Flux) );
+
+      Retry_NPG ++;
+   }
+
+} // FUNCTION : Flu_RetryLocal_Record
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  Flu_RetryLocal
+// Description :  Re-solve the patch groups recorded by Flu_RetryLocal_Record() with local sub-cycling
+//
+// Note        :  1. Invoked by Flu_AdvanceDt() when AUTO_REDUCE_DT_LOCAL is on
+//                   --> Only the failed patch groups are re-solved, and the rest of the level keeps the results of
+//                       the original update
+//                   --> Different ranks re-solve their own patch groups independently without any MPI communication
+//                2. Each failed patch group is advanced by NSub sub-steps of dt/NSub
+//                   --> Halo (i.e., ghost zones) is prepared at TimeOld and kept fixed during the sub-steps
+//                   --> NSub increases consecutively as the level-wide AUTO_REDUCE_DT reduces dt, with the
+//                       minimum allowed dt coefficient set by AUTO_REDUCE_DT_FACTOR_MIN
+//                3. Conservation is ensured by replacing the time-integrated fluxes across the boundaries of the failed
+//                   patch groups with the original fluxes recorded by Flu_RetryLocal_Record()
+//                   --> Consistent with both the neighboring patch groups and the coarse-fine flux fix-up
+//                   --> Coarse-grid fluxes inside the failed patch groups are re-stored by StoreFlux() with the
+//                       time-averaged fluxes of the sub-steps
+//                4. Return GAMER_FAILED if any cell is still unphysical with the smallest sub-step
+//                   --> The caller will then fall back to reducing dt of the whole level
+//                5. Clear the recorded patch groups on exit
+//
+// Parameter   :  lv         : Target refinement level
+//                TimeNew    : Target physical time to reach
+//                TimeOld    : Physical time before update
+//                dt         : Time interval to advance solution
+//                SaveSg_Flu : Sandglass to store the updated fluid data
+//
+// Return      :  GAMER_SUCCESS / GAMER_FAILED
+//-------------------------------------------------------------------------------------------------------
+int Flu_RetryLocal( const int lv, const double TimeNew, const double TimeOld, const double dt, const int SaveSg_Flu )
+{
+
+// nothing to do if no patch group fails on this rank
+   if ( Retry_NPG == 0 )   return GAMER_SUCCESS;
+
+   TRACE_SCOPE( "Flu_RetryLocal", lv );
+
+
+// check
+#  ifdef MHD
+   Aux_Error( ERROR_INFO, "AUTO_REDUCE_DT_LOCAL does not support MHD yet !!\n" );
+#  endif
+
+   if ( ! AutoReduceDt_Continue )
+      Aux_Error( ERROR_INFO, "AutoReduceDt_Continue is off for AUTO_REDUCE_DT_LOCAL !!\n" );
+
+
+   const int NPG_Max = ( FLU_GPU_NPGROUP < Retry_NPG ) ? FLU_GPU_NPGROUP : Retry_NPG;
+   int Status   = GAMER_SUCCESS;
+   int NSub_Max = 1;
+
+   real (*FluxSum)[9][NFLUX_TOTAL][ SQR(PS2) ] = new real [NPG_Max][9][NFLUX_TOTAL][ SQR(PS2) ];
+
+
+   for (int Disp=0; Disp<Retry_NPG; Disp+=NPG_Max)
+   {
+      const int  NPG       = ( NPG_Max < Retry_NPG-Disp ) ? NPG_Max : Retry_NPG-Disp;
+      const int *PID0_List = Retry_PID0 + Disp;
+
+      double Coeff = 1.0;
+      int    NSub  = 1;
+      bool   Done  = false;
+
+//    1. sub-cycle with a decreasing sub-step until all cells are physical
+      while ( !Done  &&  Coeff >= AUTO_REDUCE_DT_FACTOR_MIN )
+      {
+         Coeff *= AUTO_REDUCE_DT_FACTOR;
+         NSub   = MAX(  NSub+1, (int)ceil( 1.0/Coeff )  );
+
+         Done   = SubCycle( lv, TimeNew, TimeOld, dt, NSub, NPG, PID0_List, Retry_Flux+Disp, FluxSum );
+      }
+
+      if ( !Done )
+      {
+         Status = GAMER_FAILED;
+         break;
+      }
+
+      NSub_Max = MAX( NSub_Max, NSub );
+
+
+//    2. store the updated data
+#     pragma omp parallel for schedule( static )
+      for (int TID=0; TID<NPG; TID++)
+      {
+         const int PID0 = PID0_List[TID];
+
+         for (int LocalID=0; LocalID<8; LocalID++)
+         {
+            const int PID     = PID0 + LocalID;
+            const int Table_x = TABLE_02( LocalID, 'x', 0, PATCH_SIZE );
+            const int Table_y = TABLE_02( LocalID, 'y', 0, PATCH_SIZE );
+            const int Table_z = TABLE_02( LocalID, 'z', 0, PATCH_SIZE );
+
+            for (int k=0; k<PATCH_SIZE; k++)    {  const int K = Table_z + k;
+            for (int j=0; j<PATCH_SIZE; j++)    {  const int J = Table_y + j;
+            for (int i=0; i<PATCH_SIZE; i++)    {  const int I = Table_x + i;
+
+               const int KJI = IDX321( I, J, K, PS2, PS2 );
+
+               for (int v=0; v<FLU_NOUT; v++)
+                  amr->patch[SaveSg_Flu][lv][PID]->fluid[v][k][j][i] = h_Flu_Array_F_Out[0][TID][v][KJI];
+
+//             de_status is always stored in Sg=0
+#              ifdef DUAL_ENERGY
+               amr->patch[0][lv][PID]->de_status[k][j][i] = h_DE_Array_F_Out[0][TID][KJI];
+#              endif
+
+            }}}
+         } // for (int LocalID=0; LocalID<8; LocalID++)
+      } // for (int TID=0; TID<NPG; TID++)
+
+
+//    3. re-store the coarse-grid fluxes with the time-averaged fluxes
+//       --> fluxes on the boundaries of the patch groups are identical to the recorded ones
+      if ( OPT__FIXUP_FLUX )  StoreFlux( lv, FluxSum, NPG, PID0_List, dt );
+   } // for (int Disp=0; Disp<Retry_NPG; Disp+=NPG_Max)
+
+
+   if ( Status == GAMER_SUCCESS )
+      Aux_Message( stderr, "WARNING : fluid solver failed in %d patch group(s) (Rank %d, Lv %2d, counter %8ld) --> "
+                   "re-solved locally with %d sub-steps\n", Retry_NPG, MPI_Rank, lv, AdvanceCounter[lv], NSub_Max );
+   else
+      Aux_Message( stderr, "WARNING : patch-local retry failed (Rank %d, Lv %2d, counter %8ld) --> "
+                   "reduce dt of the whole level\n", MPI_Rank, lv, AdvanceCounter[lv] );
+
+
+// clear the recorded patch groups
+   delete [] FluxSum;
+   delete [] Retry_PID0;
+   delete [] Retry_Flux;
+
+   Retry_NPG       = 0;
+   Retry_NPG_Alloc = 0;
+   Retry_PID0      = NULL;
+   Retry_Flux      = NULL;
+
+
+   return Status;
+
+} // FUNCTION : Flu_RetryLocal
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  SubCycle
+// Description :  Advance the target patch groups by NSub sub-steps and impose the original fluxes on their boundaries
+//
+// Note        :  1. Invoked by Flu_RetryLocal()
+//                2. Input data are prepared only for the first sub-step
+//                   --> The interior of the input array is then replaced by the updated data after each sub-step,
+//                       while the ghost zones are kept fixed
+//                   --> Rely on the fact that the MHM/MHM_RP/CTU schemes do not modify the input array
+//                3. Updated data are left in h_Flu_Array_F_Out[0] and h_DE_Array_F_Out[0]
+//
+// Parameter   :  lv        : Target refinement level
+//                TimeNew   : Target physical time to reach
+//                TimeOld   : Physical time before update
+//                dt        : Time interval to advance solution
+//                NSub      : Number of sub-steps
+//                NPG       : Number of patch groups to be updated
+//                PID0_List : List recording the patch indices with LocalID==0 to be updated
+//                Flux_Full : Original fluxes recorded by Flu_RetryLocal_Record()
+//                FluxSum   : Array to store the time-averaged fluxes
+//
+// Return      :  true  --> All cells are physical
+//                false --> Some cells are still unphysical
+//-------------------------------------------------------------------------------------------------------
+bool SubCycle( const int lv, const double TimeNew, const double TimeOld, const double dt, const int NSub,
+               const int NPG, const int *PID0_List, const real Flux_Full[][9][NFLUX_TOTAL][ SQR(PS2) ],
+               real FluxSum[][9][NFLUX_TOTAL][ SQR(PS2) ] )
+{
+
+   const int    CheckMinEint = 1;
+   const real   _dh          = (real)1.0/amr->dh[lv];
+   const double dt_Sub       = dt/NSub;
+   const double dTime_Sub    = ( TimeNew - TimeOld )/NSub;
+#  ifdef DUAL_ENERGY
+   const bool   CorrPres_No  = false;
+#  endif
+
+   int NUnphy = 0;
+
+
+// initialize the time-integrated fluxes
+   for (int TID=0; TID<NPG; TID++)
+   for (int f=0; f<9; f++)
+   for (int v=0; v<NFLUX_TOTAL; v++)
+   for (int t=0; t<SQR(PS2); t++)
+      FluxSum[TID][f][v][t] = (real)0.0;
+
+
+// 1. advance the patch groups by NSub sub-steps
+   for (int s=0; s<NSub; s++)
+   {
+      const double TimeOld_Sub = TimeOld + s*dTime_Sub;
+      const double TimeNew_Sub = ( s == NSub-1 ) ? TimeNew : TimeOld_Sub + dTime_Sub;
+      const bool   Prepare     = ( s == 0 );
+
+      InvokeSolver_PatchList( FLUID_SOLVER, lv, TimeNew_Sub, TimeOld_Sub, dt_Sub, NULL_REAL, NPG, PID0_List, Prepare );
+
+#     pragma omp parallel for reduction( +:NUnphy ) schedule( runtime )
+      for (int TID=0; TID<NPG; TID++)
+      {
+//       check unphysical results
+         for (int t=0; t<CUBE(PS2); t++)
+         {
+            real Out[NCOMP_TOTAL];
+
+            for (int v=0; v<NCOMP_TOTAL; v++)   Out[v] = h_Flu_Array_F_Out[0][TID][v][t];
+
+            if ( Unphysical(Out, CheckMinEint, NULL_REAL) )    NUnphy ++;
+         }
+
+//       accumulate fluxes
+         for (int f=0; f<9; f++)
+         for (int v=0; v<NFLUX_TOTAL; v++)
+         for (int t=0; t<SQR(PS2); t++)
+            FluxSum[TID][f][v][t] += dt_Sub*h_Flux_Array[0][TID][f][v][t];
+
+//       copy the updated data to the interior of the input array for the next sub-step
+         if ( s < NSub-1 )
+         {
+            for (int v=0; v<NCOMP_TOTAL; v++)
+            for (int k=0; k<PS2; k++)
+            for (int j=0; j<PS2; j++)
+            for (int i=0; i<PS2; i++)
+            {
+               const int idx_in  = IDX321( i+FLU_GHOST_SIZE, j+FLU_GHOST_SIZE, k+FLU_GHOST_SIZE, FLU_NXT, FLU_NXT );
+               const int idx_out = IDX321( i, j, k, PS2, PS2 );
+
+               h_Flu_Array_F_In[0][TID][v][idx_in] = h_Flu_Array_F_Out[0][TID][v][idx_out];
+            }
+         }
+      } // for (int TID=0; TID<NPG; TID++)
+
+      if ( NUnphy > 0 )    return false;
+   } // for (int s=0; s<NSub; s++)
+
+
+// 2. replace the time-integrated fluxes across the boundaries of the patch groups with the original ones
+#  pragma omp parallel for reduction( +:NUnphy ) schedule( runtime )
+   for (int TID=0; TID<NPG; TID++)
+   {
+//    2-1. correct the cells adjacent to the six boundary faces (face indices 0/2, 3/5, 6/8)
+      for (int d=0; d<3; d++)
+      for (int Side=0; Side<2; Side++)
+      {
+         const int  Face = 3*d + 2*Side;
+         const int  ijk  = ( Side == 0 ) ? 0 : PS2-1;
+         const real Sign = ( Side == 0 ) ? +_dh : -_dh;
+
+         for (int m=0; m<PS2; m++)
+         for (int n=0; n<PS2; n++)
+         {
+            int i, j, k;
+
+            switch ( d )
+            {
+               case 0:  i = ijk;  j = n;    k = m;    break;
+               case 1:  i = n;    j = ijk;  k = m;    break;
+               default: i = n;    j = m;    k = ijk;  break;
+            }
+
+            const int idx_out  = IDX321( i, j, k, PS2, PS2 );
+            const int idx_flux = m*PS2 + n;
+
+            for (int v=0; v<NFLUX_TOTAL; v++)
+            {
+               const real Flux_Orig = dt*Flux_Full[TID][Face][v][idx_flux];
+
+               h_Flu_Array_F_Out[0][TID][v][idx_out] += Sign*( Flux_Orig - FluxSum[TID][Face][v][idx_flux] );
+               FluxSum[TID][Face][v][idx_flux]        = Flux_Orig;
+            }
+         }
+      } // d, Side
+
+
+//    2-2. ensure the consistency of the corrected cells and check unphysical results
+      for (int k=0; k<PS2; k++)
+      for (int j=0; j<PS2; j++)
+      for (int i=0; i<PS2; i++)
+      {
+         if ( i != 0  &&  i != PS2-1  &&  j != 0  &&  j != PS2-1  &&  k != 0  &&  k != PS2-1 )  continue;
+
+         const int idx_out = IDX321( i, j, k, PS2, PS2 );
+         real Update[NCOMP_TOTAL];
+
+         for (int v=0; v<NCOMP_TOTAL; v++)   Update[v] = h_Flu_Array_F_Out[0][TID][v][idx_out];
+
+#        if ( NCOMP_PASSIVE > 0 )
+         for (int v=NCOMP_FLUID; v<NCOMP_TOTAL; v++)  Update[v] = FMAX( Update[v], TINY_NUMBER );
+
+         if ( OPT__NORMALIZE_PASSIVE )
+            Hydro_NormalizePassive( Update[DENS], Update+NCOMP_FLUID, PassiveNorm_NVar, PassiveNorm_VarIdx );
+#        endif
+
+#        ifdef DUAL_ENERGY
+         Hydro_DualEnergyFix( Update[DENS], Update[MOMX], Update[MOMY], Update[MOMZ], Update[ENGY], Update[ENPY],
+                              h_DE_Array_F_Out[0][TID][idx_out], EoS_AuxArray_Flt[1], EoS_AuxArray_Flt[2],
+                              CorrPres_No, MIN_PRES, DUAL_ENERGY_SWITCH, NULL_REAL );
+#        endif
+
+         if ( Unphysical(Update, CheckMinEint, NULL_REAL) )    NUnphy ++;
+
+         for (int v=0; v<NCOMP_TOTAL; v++)   h_Flu_Array_F_Out[0][TID][v][idx_out] = Update[v];
+      } // i,j,k
+
+
+//    2-3. convert the time-integrated fluxes to the time-averaged fluxes for StoreFlux()
+      for (int f=0; f<9; f++)
+      for (int v=0; v<NFLUX_TOTAL; v++)
+      for (int t=0; t<SQR(PS2); t++)
+         FluxSum[TID][f][v][t] /= dt;
+   } // for (int TID=0; TID<NPG; TID++)
+
+
+   return ( NUnphy == 0 );
+
+} // FUNCTION : SubCycle
+
+
+
+#endif // #if ( MODEL == HYDRO )
@@ -0,0 +1,324 @@
+#include "GAMER.h"
+
+
+typedef real_store (*FluArray_t)[PS1][PS1][PS1];
+#ifdef MHD
+typedef real_store (*MagArray_t)[ PS1P1*SQR(PS1) ];
+#endif
+
+static int GetNeighborPG( const int lv, const int PID0, int NeighborPID0[] );
+static void ReleaseOldSg( const int lv, const int PID0 );
+static void AllocateSaveSg( const int lv, const int PID );
+
+
+// status of the single-sandglass mode on the level being advanced
+// --> SingleSg_Lv = -1 if the old-time data are kept on all levels
+static int         SingleSg_Lv    = -1;
+static int         SingleSg_OldSg_Flu;
+static int         SingleSg_SaveSg_Flu;
+static int        *NUnprepared    = NULL;   // number of patch groups whose ghost zones still require the old data of a patch group
+static FluArray_t *FluPool        = NULL;   // old-time fluid[] arrays released during this step
+static int         NFluPool       = 0;
+#ifdef MHD
+static int         SingleSg_OldSg_Mag;
+static int         SingleSg_SaveSg_Mag;
+static MagArray_t *MagPool        = NULL;   // old-time magnetic[] arrays released during this step
+static int         NMagPool       = 0;
+#endif
+
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  Flu_SingleSg_Begin
+// Description :  Start the single-sandglass mode (OPT__SINGLE_SANDGLASS) on the target level
+//
+// Note        :  1. Invoked by Flu_AdvanceDt() before the fluid solver
+//                2. Only the levels without any finer patch are eligible (i.e., lv == TOP_LEVEL or NPatchTotal[lv+1] == 0)
+//                   since the old-time data are otherwise required for the temporal interpolation of the ghost zones
+//                   on lv+1, even in the shared time-step integration
+//                3. For the eligible levels, the arrays of the old sandglass (i.e., FluSg[lv] and MagSg[lv]) are
+//                   released as soon as all patch groups requiring them as ghost zones have been prepared
+//                   (see Flu_SingleSg_Prepared()), and the released arrays are recycled to store the updated data
+//                   --> Only the patch groups within the current batch of the fluid solver are stored in both sandglasses
+//                4. For the ineligible levels, allocate the new sandglass of all patches since it may have been
+//                   released in the previous step
+//
+// Parameter   :  lv         : Target refinement level
+//                SaveSg_Flu : Sandglass to store the updated fluid data
+//                SaveSg_Mag : Sandglass to store the updated B field (for MHD only)
+//-------------------------------------------------------------------------------------------------------
+void Flu_SingleSg_Begin( const int lv, const int SaveSg_Flu, const int SaveSg_Mag )
+{
+
+   if ( !OPT__SINGLE_SANDGLASS )    return;
+
+// check
+   if ( SingleSg_Lv != -1 )
+      Aux_Error( ERROR_INFO, "single-sandglass mode has already been started on level %d !!\n", SingleSg_Lv );
+
+   const bool Eligible = ( lv == TOP_LEVEL  ||  NPatchTotal[lv+1] == 0 );
+   const int  NReal    = amr->NPatchComma[lv][1];
+
+
+// 1. allocate the new sandglass of buffer patches (and also real patches for the ineligible levels)
+// --> buffer patches are not released until Flu_SingleSg_End() since they are not updated by the fluid solver
+#  pragma omp parallel for schedule( runtime )
+   for (int PID=( Eligible ? NReal : 0 ); PID<amr->NPatchComma[lv][27]; PID++)
+   {
+      amr->patch[SaveSg_Flu][lv][PID]->hnew();
+#     ifdef MHD
+      amr->patch[SaveSg_Mag][lv][PID]->mnew();
+#     endif
+   }
+
+   if ( !Eligible )  return;
+
+
+// 2. record the number of patch groups reading the old data of each patch group
+   SingleSg_Lv         = lv;
+   SingleSg_OldSg_Flu  = amr->FluSg[lv];
+   SingleSg_SaveSg_Flu = SaveSg_Flu;
+   NUnprepared         = new int        [ NReal/8 ];
+   FluPool             = new FluArray_t [ NReal   ];
+   NFluPool            = 0;
+#  ifdef MHD
+   SingleSg_OldSg_Mag  = amr->MagSg[lv];
+   SingleSg_SaveSg_Mag = SaveSg_Mag;
+   MagPool             = new MagArray_t [ NReal   ];
+   NMagPool            = 0;
+#  endif
+
+#  pragma omp parallel
+   {
+      int NeighborPID0[27];
+
+#     pragma omp for schedule( runtime )
+      for (int PID0=0; PID0<NReal; PID0+=8)
+         NUnprepared[ PID0/8 ] = GetNeighborPG( lv, PID0, NeighborPID0 );
+   }
+
+} // FUNCTION : Flu_SingleSg_Begin
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  Flu_SingleSg_Prepared
+// Description :  Release the old-time data no longer required and allocate the new sandglass of the
+//                prepared patch groups
+//
+// Note        :  1. Invoked by Flu_Prepare() after the input data of all target patch groups have been prepared
+//                2. Do nothing if the single-sandglass mode is not active on the target level
+//
+// Parameter   :  lv        : Target refinement level
+//                NPG       : Number of patch groups prepared
+//                PID0_List : List recording the patch indices with LocalID==0 prepared
+//-------------------------------------------------------------------------------------------------------
+void Flu_SingleSg_Prepared( const int lv, const int NPG, const int *PID0_List )
+{
+
+   if ( SingleSg_Lv != lv )   return;
+
+   int NeighborPID0[27], NNeighbor;
+
+// 1. release the old data of the patch groups whose neighbors have all been prepared
+   for (int t=0; t<NPG; t++)
+   {
+      NNeighbor = GetNeighborPG( lv, PID0_List[t], NeighborPID0 );
+
+      for (int n=0; n<NNeighbor; n++)
+      {
+         if ( --NUnprepared[ NeighborPID0[n]/8 ] == 0 )  ReleaseOldSg( lv, NeighborPID0[n] );
+      }
+   }
+
+// 2. store the updated data of the prepared patch groups in the released arrays
+   for (int t=0; t<NPG; t++)
+   for (int PID=PID0_List[t]; PID<PID0_List[t]+8; PID++)
+      AllocateSaveSg( lv, PID );
+
+} // FUNCTION : Flu_SingleSg_Prepared
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  Flu_SingleSg_End
+// Description :  End the single-sandglass mode on the target level
+//
+// Note        :  1. Invoked by Flu_AdvanceDt() after the fluid solver
+//                2. Free the remaining old-time arrays (including those of buffer patches) and the recycled
+//                   arrays not used in this step
+//                3. Invalidate the physical time of the old sandglass so that any further attempt of temporal
+//                   interpolation on this level will fail in SetTempIntPara()
+//
+// Parameter   :  lv : Target refinement level
+//-------------------------------------------------------------------------------------------------------
+void Flu_SingleSg_End( const int lv )
+{
+
+   if ( SingleSg_Lv != lv )   return;
+
+// check
+#  ifdef GAMER_DEBUG
+   for (int PID0=0; PID0<amr->NPatchComma[lv][1]; PID0+=8)
+      if ( NUnprepared[ PID0/8 ] != 0 )
+         Aux_Error( ERROR_INFO, "patch group (lv %d, PID0 %d) has %d unprepared neighbors !!\n",
+                    lv, PID0, NUnprepared[ PID0/8 ] );
+#  endif
+
+
+#  pragma omp parallel for schedule( runtime )
+   for (int PID=0; PID<amr->NPatchComma[lv][27]; PID++)
+   {
+      delete [] amr->patch[SingleSg_OldSg_Flu][lv][PID]->fluid;
+      amr->patch[SingleSg_OldSg_Flu][lv][PID]->fluid = NULL;
+
+#     ifdef MHD
+      delete [] amr->patch[SingleSg_OldSg_Mag][lv][PID]->magnetic;
+      amr->patch[SingleSg_OldSg_Mag][lv][PID]->magnetic = NULL;
+#     endif
+   }
+
+   for (int t=0; t<NFluPool; t++)   delete [] FluPool[t];
+#  ifdef MHD
+   for (int t=0; t<NMagPool; t++)   delete [] MagPool[t];
+#  endif
+
+   amr->FluSgTime[lv][SingleSg_OldSg_Flu] = -1.0;
+#  ifdef MHD
+   amr->MagSgTime[lv][SingleSg_OldSg_Mag] = -1.0;
+#  endif
+
+
+   delete [] NUnprepared;
+   delete [] FluPool;
+   NUnprepared = NULL;
+   FluPool     = NULL;
+   NFluPool    = 0;
+#  ifdef MHD
+   delete [] MagPool;
+   MagPool     = NULL;
+   NMagPool    = 0;
+#  endif
+   SingleSg_Lv = -1;
+
+} // FUNCTION : Flu_SingleSg_End
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  GetNeighborPG
+// Description :  Get the real patch groups whose data are accessed when preparing the ghost zones of the
+//                target patch group
+//
+// Note        :  1. Include the target patch group itself
+//                2. Buffer patches are excluded since they are never released by ReleaseOldSg()
+//                3. Since the sibling relation is symmetric, the same list also gives the patch groups
+//                   reading the data of the target patch group
+//
+// Parameter   :  lv           : Target refinement level
+//                PID0         : Patch index with LocalID==0 of the target patch group
+//                NeighborPID0 : Array to store the patch indices with LocalID==0 of the neighboring patch groups
+//
+// Return      :  Number of neighboring patch groups (1 ~ 27) and NeighborPID0[]
+//-------------------------------------------------------------------------------------------------------
+int GetNeighborPG( const int lv, const int PID0, int NeighborPID0[] )
+{
+
+   int NNeighbor = 0;
+
+   NeighborPID0[ NNeighbor ++ ] = PID0;
+
+   for (int LocalID=0; LocalID<8; LocalID++)
+   for (int s=0; s<26; s++)
+   {
+      const int SibPID = amr->patch[0][lv][PID0+LocalID]->sibling[s];
+
+//    skip non-existing siblings, non-periodic boundaries, and buffer patches
+      if ( SibPID < 0  ||  SibPID >= amr->NPatchComma[lv][1] )    continue;
+
+      const int SibPID0 = SibPID - SibPID%8;
+      bool      Found   = false;
+
+      for (int n=0; n<NNeighbor; n++)
+      {
+         if ( NeighborPID0[n] == SibPID0 )
+         {
+            Found = true;
+            break;
+         }
+      }
+
+      if ( !Found )  NeighborPID0[ NNeighbor ++ ] = SibPID0;
+   }
+
+   return NNeighbor;
+
+} // FUNCTION : GetNeighborPG
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  ReleaseOldSg
+// Description :  Move the old-time arrays of the target patch group to the recycling pools
+//
+// Parameter   :  lv   : Target refinement level
+//                PID0 : Patch index with LocalID==0 of the target patch group
+//-------------------------------------------------------------------------------------------------------
+void ReleaseOldSg( const int lv, const int PID0 )
+{
+
+   for (int PID=PID0; PID<PID0+8; PID++)
+   {
+      patch_t *FluPatch = amr->patch[SingleSg_OldSg_Flu][lv][PID];
+
+      if ( FluPatch->fluid != NULL )
+      {
+         FluPool[ NFluPool ++ ] = FluPatch->fluid;
+         FluPatch->fluid        = NULL;
+      }
+
+#     ifdef MHD
+      patch_t *MagPatch = amr->patch[SingleSg_OldSg_Mag][lv][PID];
+
+      if ( MagPatch->magnetic != NULL )
+      {
+         MagPool[ NMagPool ++ ] = MagPatch->magnetic;
+         MagPatch->magnetic     = NULL;
+      }
+#     endif
+   }
+
+} // FUNCTION : ReleaseOldSg
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  AllocateSaveSg
+// Description :  Allocate the new sandglass of the target patch, reusing the released arrays if possible
+//
+// Parameter   :  lv  : Target refinement level
+//                PID : Target patch index
+//-------------------------------------------------------------------------------------------------------
+void AllocateSaveSg( const int lv, const int PID )
+{
+
+   patch_t *FluPatch = amr->patch[SingleSg_SaveSg_Flu][lv][PID];
+
+   if ( FluPatch->fluid == NULL )
+   {
+      if ( NFluPool > 0 )  FluPatch->fluid = FluPool[ -- NFluPool ];
+      else                 FluPatch->hnew();
+   }
+
+#  ifdef MHD
+   patch_t *MagPatch = amr->patch[SingleSg_SaveSg_Mag][lv][PID];
+
+   if ( MagPatch->magnetic == NULL )
+   {
+      if ( NMagPool > 0 )  MagPatch->magnetic = MagPool[ -- NMagPool ];
+      else                 MagPatch->mnew();
+   }
+#  endif
+
+} // FUNCTION : AllocateSaveSg
@@ -0,0 +1,449 @@
+#include "GAMER.h"
+
+#ifdef SUPPORT_FLU_SUPER_BLOCK
+
+
+
+// defined in CPU_FluidSolver_SuperBlock.cpp
+void CPU_FluidSolver_SuperBlock( const real   Flu_Array_In [][NCOMP_TOTAL][ CUBE(FLU_SB_NXT) ],
+                                       real   Flu_Array_Out[][NCOMP_TOTAL][ CUBE(FLU_SB_PS2) ],
+                                       char   DE_Array_Out [][ CUBE(FLU_SB_PS2) ],
+                                       real   Flux_Array   [][9][NCOMP_TOTAL][ SQR(FLU_SB_PS2) ],
+                                 const double Corner_Array [][3],
+                                 const real   Pot_Array_USG[][ CUBE(USG_SB_NXT_F) ],
+                                 const int NBlock, const real dt, const real dh, const bool StoreFlux,
+                                 const LR_Limiter_t LR_Limiter, const real MinMod_Coeff, const double Time,
+                                 const bool UsePot, const OptExtAcc_t ExtAcc,
+                                 const real MinDens, const real MinPres, const real MinEint,
+                                 const real DualEnergySwitch, const bool NormPassive, const int NNorm,
+                                 const int NormIdx[], const bool JeansMinPres, const real JeansMinPres_Coeff,
+                                 const bool FuseSrc, const double TimeNew, const int SlabSize );
+void CPU_FluidSolver_SuperBlock_MemAllocate( const int NThread );
+void CPU_FluidSolver_SuperBlock_MemFree();
+
+static int  FindSuperBlock( const int lv, const int NPG, const int *PID0_List, int *SB_PID0_List );
+static void Assemble( const int NBlock );
+static void Scatter( const int NBlock );
+
+
+// super-block arrays
+static int      SB_NBlock_Max    = 0;
+static real   (*SB_Flu_Array_In )[FLU_NIN ][ CUBE(FLU_SB_NXT) ]      = NULL;
+static real   (*SB_Flu_Array_Out)[FLU_NOUT][ CUBE(FLU_SB_PS2) ]      = NULL;
+static char   (*SB_DE_Array_Out )[ CUBE(FLU_SB_PS2) ]                = NULL;
+static real   (*SB_Flux_Array   )[9][NFLUX_TOTAL][ SQR(FLU_SB_PS2) ] = NULL;
+static real   (*SB_Pot_Array_USG)[ CUBE(USG_SB_NXT_F) ]              = NULL;
+static double (*SB_Corner_Array )[3]                                 = NULL;
+
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  Flu_SuperBlock
+// Description :  Advance the patch groups forming super-blocks of 2x2x2 patch groups
+//
+// Note        :  1. Invoked by InvokeSolver() when OPT__FLU_SUPER_BLOCK is on
+//                2. Patch groups sharing the same super-block are solved together by CPU_FluidSolver_SuperBlock()
+//                   --> They share the same ghost zones, which reduces the cost of data reconstruction and
+//                       Riemann solvers in the ghost zones by a factor of ~2
+//                3. Input data are still prepared by Flu_Prepare() for individual patch groups and then assembled
+//                   into super-blocks. Likewise, the updated data are scattered back to individual patch groups
+//                   and stored by Flu_Close().
+//                   --> All operations in Flu_Close() (e.g., flux fix-up and correcting unphysical cells) work
+//                       exactly the same as the regular solver
+//                4. A super-block is used only if
+//                   (1) all its 8 patch groups are in PID0_List (i.e., on this rank) and aligned at multiples of
+//                       two patch groups
+//                   (2) no patch requires the coarse-fine fluxes between the two patches in the same patch group
+//                       --> The super-block solver only stores the fluxes across the patch-group boundaries
+//                5. Patch groups advanced by this function are removed from PID0_List
+//                   --> The remaining patch groups should be advanced by the regular solver
+//                6. Use the host arrays of ArrayID=0 as buffers
+//                   --> Must not be called during InvokeSolver()'s own preparation/solver/closing steps
+//
+// Parameter   :  lv         : Target refinement level
+//                TimeNew    : Target physical time to reach (for SRC_FUSE_FLUID)
+//                TimeOld    : Physical time before update
+//                dt         : Time interval to advance solution
+//                SaveSg_Flu : Sandglass to store the updated fluid data
+//                SaveSg_Mag : Sandglass to store the updated B field (useless for now)
+//                NPG        : Number of patch groups in PID0_List
+//                PID0_List  : List recording the patch indices with LocalID==0 to be updated
+//                             --> Will be overwritten by the patch groups not advanced by this function
+//
+// Return      :  Number of patch groups remaining in PID0_List
+//-------------------------------------------------------------------------------------------------------
+int Flu_SuperBlock( const int lv, const double TimeNew, const double TimeOld, const double dt,
+                    const int SaveSg_Flu, const int SaveSg_Mag, const int NPG, int *PID0_List )
+{
+
+   if ( NPG < 8 )    return NPG;
+
+   TRACE_SCOPE( "Flu_SuperBlock", lv );
+
+
+// check
+   if ( SB_Flu_Array_In == NULL )   Aux_Error( ERROR_INFO, "super-block arrays have not been allocated !!\n" );
+
+
+// define useless variables in different builds
+#  ifndef GRAVITY
+   const bool        OPT__SELF_GRAVITY = false;
+   const OptExtPot_t OPT__EXT_POT      = EXT_POT_NONE;
+   const OptExtAcc_t OPT__EXT_ACC      = EXT_ACC_NONE;
+#  endif
+#  ifndef DUAL_ENERGY
+   const double DUAL_ENERGY_SWITCH = NULL_REAL;
+   char (*h_DE_Array_F_Out[2])[ CUBE(PS2) ]        = { NULL, NULL };
+#  endif
+#  ifndef UNSPLIT_GRAVITY
+   real (*h_Pot_Array_USG_F[2])[ CUBE(USG_NXT_F) ] = { NULL, NULL };
+#  endif
+#  ifdef GRAVITY
+   const real JeansMinPres_Coeff = ( JEANS_MIN_PRES ) ?
+                                   NEWTON_G*SQR(JEANS_MIN_PRES_NCELL*amr->dh[JEANS_MIN_PRES_LEVEL])/(GAMMA*M_PI) : NULL_REAL;
+#  else
+   const bool JEANS_MIN_PRES     = false;
+   const real JeansMinPres_Coeff = NULL_REAL;
+#  endif
+
+
+// 1. find the super-blocks
+   int *SB_PID0_List = new int [NPG];
+   const int NBlock  = FindSuperBlock( lv, NPG, PID0_List, SB_PID0_List );
+
+
+// 2. advance all super-blocks
+   for (int Disp=0; Disp<NBlock; Disp+=SB_NBlock_Max)
+   {
+      const int  NB         = ( SB_NBlock_Max < NBlock-Disp ) ? SB_NBlock_Max : NBlock-Disp;
+      const int  NPG_Batch  = 8*NB;
+      const int *PID0_Batch = SB_PID0_List + 8*Disp;
+
+      Flu_Prepare( lv, TimeOld, h_Flu_Array_F_In[0], NULL, h_Pot_Array_USG_F[0], h_Corner_Array_F[0],
+                   NPG_Batch, PID0_Batch );
+
+      Assemble( NB );
+
+      CPU_FluidSolver_SuperBlock( SB_Flu_Array_In, SB_Flu_Array_Out, SB_DE_Array_Out, SB_Flux_Array,
+                                  SB_Corner_Array, SB_Pot_Array_USG, NB, dt, amr->dh[lv], OPT__FIXUP_FLUX,
+                                  OPT__LR_LIMITER, MINMOD_COEFF, TimeOld, (OPT__SELF_GRAVITY || OPT__EXT_POT),
+                                  OPT__EXT_ACC, MIN_DENS, MIN_PRES, MIN_EINT, DUAL_ENERGY_SWITCH,
+                                  OPT__NORMALIZE_PASSIVE, PassiveNorm_NVar, PassiveNorm_VarIdx,
+                                  JEANS_MIN_PRES, JeansMinPres_Coeff, SRC_FUSE_FLUID, TimeNew,
+                                  OPT__FLU_SLAB );
+
+      Scatter( NB );
+
+      Flu_Close( lv, SaveSg_Flu, SaveSg_Mag, h_Flux_Array[0], NULL, h_Flu_Array_F_Out[0], NULL,
+                 h_DE_Array_F_Out[0], NPG_Batch, PID0_Batch, h_Flu_Array_F_In[0], NULL, dt, TimeNew, TimeOld );
+   } // for (int Disp=0; Disp<NBlock; Disp+=SB_NBlock_Max)
+
+
+// 3. remove the advanced patch groups from PID0_List
+   int NPG_Left = NPG;
+
+   if ( NBlock > 0 )
+   {
+      bool *Advanced = new bool [ amr->NPatchComma[lv][1]/8 ];
+
+      for (int t=0; t<NPG; t++)           Advanced[ PID0_List[t]/8 ]    = false;
+      for (int t=0; t<8*NBlock; t++)      Advanced[ SB_PID0_List[t]/8 ] = true;
+
+      NPG_Left = 0;
+      for (int t=0; t<NPG; t++)
+         if ( ! Advanced[ PID0_List[t]/8 ] )    PID0_List[ NPG_Left ++ ] = PID0_List[t];
+
+      delete [] Advanced;
+   }
+
+   delete [] SB_PID0_List;
+
+
+   return NPG_Left;
+
+} // FUNCTION : Flu_SuperBlock
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  FindSuperBlock
+// Description :  Find the super-blocks that can be advanced by CPU_FluidSolver_SuperBlock()
+//
+// Note        :  1. Invoked by Flu_SuperBlock()
+//                2. See the note 4 of Flu_SuperBlock() for the criteria of super-blocks
+//                3. The 8 patch groups of each super-block are stored in SB_PID0_List[] in the order of
+//                   LocalPG = px + 2*py + 4*pz, where px/py/pz = 0/1 are the patch-group positions in the super-block
+//
+// Parameter   :  lv           : Target refinement level
+//                NPG          : Number of patch groups in PID0_List
+//                PID0_List    : List recording the patch indices with LocalID==0
+//                SB_PID0_List : Array to store the patch indices with LocalID==0 of all super-blocks
+//
+// Return      :  Number of super-blocks found and SB_PID0_List[]
+//-------------------------------------------------------------------------------------------------------
+int FindSuperBlock( const int lv, const int NPG, const int *PID0_List, int *SB_PID0_List )
+{
+
+   const int PGScale = PS2*amr->scale[lv];
+   long NSB[3];
+
+   for (int d=0; d<3; d++)    NSB[d] = amr->BoxScale[d]/( 2*PGScale ) + 1;
+
+
+// 1. sort patch groups by their super-block indices
+   long *SB_Key = new long [NPG];
+   int  *SB_Idx = new int  [NPG];
+
+   for (int t=0; t<NPG; t++)
+   {
+      const int *Corner = amr->patch[0][lv][ PID0_List[t] ]->corner;
+
+      SB_Key[t] = ( Corner[0]/PGScale/2 ) + NSB[0]*( ( Corner[1]/PGScale/2 ) + NSB[1]*( Corner[2]/PGScale/2 ) );
+   }
+
+   Mis_Heapsort( NPG, SB_Key, SB_Idx );
+
+
+// 2. collect the super-blocks with all 8 patch groups
+   int NBlock = 0;
+
+   for (int t=0; t<NPG-7; )
+   {
+      if ( SB_Key[t] != SB_Key[t+7] )
+      {
+         t ++;
+         continue;
+      }
+
+      int *SB_PID0 = SB_PID0_List + 8*NBlock;
+      bool Valid   = true;
+
+      for (int s=0; s<8; s++)
+      {
+         const int  PID0    = PID0_List[ SB_Idx[t+s] ];
+         const int *Corner  = amr->patch[0][lv][PID0]->corner;
+         const int  LocalPG = ( Corner[0]/PGScale )%2 + 2*( ( Corner[1]/PGScale )%2 ) + 4*( ( Corner[2]/PGScale )%2 );
+
+         SB_PID0[LocalPG] = PID0;
+
+//       check whether any patch requires the coarse-fine fluxes inside the patch group
+         for (int LocalID=0; LocalID<8; LocalID++)
+         {
+            const patch_t *Patch = amr->patch[0][lv][ PID0 + LocalID ];
+
+            for (int f=0; f<6; f++)
+            {
+               const int  Pos      = TABLE_02( LocalID, 'x'+f/2, 0, 1 );
+               const bool Internal = ( f%2 == 0 ) ? ( Pos == 1 ) : ( Pos == 0 );
+
+               if ( Internal  &&  Patch->flux[f] != NULL )  Valid = false;
+            }
+         }
+      } // for (int s=0; s<8; s++)
+
+      if ( Valid )   NBlock ++;
+
+      t += 8;
+   } // for (int t=0; t<NPG-7; )
+
+
+   delete [] SB_Key;
+   delete [] SB_Idx;
+
+   return NBlock;
+
+} // FUNCTION : FindSuperBlock
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  Assemble
+// Description :  Assemble the input arrays of super-blocks from those of individual patch groups
+//
+// Note        :  1. Invoked by Flu_SuperBlock()
+//                2. Each cell is taken from the patch group whose interior is closest to it
+//                   --> Overlapping ghost zones of adjacent patch groups are identical anyway
+//
+// Parameter   :  NBlock : Number of super-blocks
+//-------------------------------------------------------------------------------------------------------
+void Assemble( const int NBlock )
+{
+
+#  pragma omp parallel for schedule( runtime )
+   for (int b=0; b<NBlock; b++)
+   {
+//    fluid
+      for (int v=0; v<FLU_NIN; v++)
+      for (int k=0; k<FLU_SB_NXT; k++)    {  const int pz = ( k < FLU_GHOST_SIZE+PS2 ) ? 0 : 1;  const int kk = k - pz*PS2;
+      for (int j=0; j<FLU_SB_NXT; j++)    {  const int py = ( j < FLU_GHOST_SIZE+PS2 ) ? 0 : 1;  const int jj = j - py*PS2;
+      for (int i=0; i<FLU_SB_NXT; i++)    {  const int px = ( i < FLU_GHOST_SIZE+PS2 ) ? 0 : 1;  const int ii = i - px*PS2;
+
+         SB_Flu_Array_In[b][v][ IDX321(i,j,k,FLU_SB_NXT,FLU_SB_NXT) ]
+            = h_Flu_Array_F_In[0][ 8*b + px + 2*py + 4*pz ][v][ IDX321(ii,jj,kk,FLU_NXT,FLU_NXT) ];
+      }}}
+
+#     ifdef UNSPLIT_GRAVITY
+//    potential
+      if ( OPT__SELF_GRAVITY  ||  OPT__EXT_POT )
+      {
+         for (int k=0; k<USG_SB_NXT_F; k++)  {  const int pz = ( k < USG_GHOST_SIZE_F+PS2 ) ? 0 : 1;  const int kk = k - pz*PS2;
+         for (int j=0; j<USG_SB_NXT_F; j++)  {  const int py = ( j < USG_GHOST_SIZE_F+PS2 ) ? 0 : 1;  const int jj = j - py*PS2;
+         for (int i=0; i<USG_SB_NXT_F; i++)  {  const int px = ( i < USG_GHOST_SIZE_F+PS2 ) ? 0 : 1;  const int ii = i - px*PS2;
+
+            SB_Pot_Array_USG[b][ IDX321(i,j,k,USG_SB_NXT_F,USG_SB_NXT_F) ]
+               = h_Pot_Array_USG_F[0][ 8*b + px + 2*py + 4*pz ][ IDX321(ii,jj,kk,USG_NXT_F,USG_NXT_F) ];
+         }}}
+      }
+#     endif
+
+//    corner (i.e., the first patch group)
+#     ifdef UNSPLIT_GRAVITY
+      if ( OPT__EXT_ACC  ||  SRC_FUSE_FLUID )
+#     else
+      if ( SRC_FUSE_FLUID )
+#     endif
+         for (int d=0; d<3; d++)    SB_Corner_Array[b][d] = h_Corner_Array_F[0][ 8*b ][d];
+   } // for (int b=0; b<NBlock; b++)
+
+} // FUNCTION : Assemble
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  Scatter
+// Description :  Scatter the output arrays of super-blocks to those of individual patch groups
+//
+// Note        :  1. Invoked by Flu_SuperBlock()
+//                2. Only the fluxes across the patch-group boundaries (i.e., h_Flux_Array[][0/2/3/5/6/8]) are set
+//                   --> Fluxes between the two patches in the same patch group (i.e., h_Flux_Array[][1/4/7]) are
+//                       left undefined, which is guaranteed to be unused by FindSuperBlock()
+//
+// Parameter   :  NBlock : Number of super-blocks
+//-------------------------------------------------------------------------------------------------------
+void Scatter( const int NBlock )
+{
+
+#  pragma omp parallel for schedule( runtime )
+   for (int TID=0; TID<8*NBlock; TID++)
+   {
+      const int b       = TID/8;
+      const int LocalPG = TID%8;
+      const int P[3]    = { LocalPG%2, (LocalPG/2)%2, LocalPG/4 };
+      const int Disp    = IDX321( P[0]*PS2, P[1]*PS2, P[2]*PS2, FLU_SB_PS2, FLU_SB_PS2 );
+
+//    fluid and dual-energy status
+      for (int k=0; k<PS2; k++)
+      for (int j=0; j<PS2; j++)
+      for (int i=0; i<PS2; i++)
+      {
+         const int idx_pg = IDX321( i, j, k, PS2, PS2 );
+         const int idx_sb = IDX321( i, j, k, FLU_SB_PS2, FLU_SB_PS2 ) + Disp;
+
+         for (int v=0; v<FLU_NOUT; v++)   h_Flu_Array_F_Out[0][TID][v][idx_pg] = SB_Flu_Array_Out[b][v][idx_sb];
+
+#        ifdef DUAL_ENERGY
+         h_DE_Array_F_Out[0][TID][idx_pg] = SB_DE_Array_Out[b][idx_sb];
+#        endif
+      }
+
+//    fluxes across the patch-group boundaries
+      if ( OPT__FIXUP_FLUX )
+      {
+         for (int d=0; d<3; d++)
+         {
+//          transverse directions of the flux planes (see Hydro_ComputeFlux())
+            const int dm = ( d == 2 ) ? 1 : 2;
+            const int dn = ( d == 0 ) ? 1 : 0;
+
+            for (int s=0; s<2; s++)
+            {
+               const int Face_PG = 3*d + 2*s;
+               const int Face_SB = 3*d + P[d] + s;
+
+               for (int m=0; m<PS2; m++)
+               for (int n=0; n<PS2; n++)
+               {
+                  const int idx_pg = m*PS2 + n;
+                  const int idx_sb = ( m + P[dm]*PS2 )*FLU_SB_PS2 + ( n + P[dn]*PS2 );
+
+                  for (int v=0; v<NFLUX_TOTAL; v++)
+                     h_Flux_Array[0][TID][Face_PG][v][idx_pg] = SB_Flux_Array[b][Face_SB][v][idx_sb];
+               }
+            }
+         }
+      } // if ( OPT__FIXUP_FLUX )
+   } // for (int TID=0; TID<8*NBlock; TID++)
+
+} // FUNCTION : Scatter
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  Flu_SuperBlock_MemAllocate
+// Description :  Allocate memory for the super-block solver
+//
+// Note        :  1. Invoked by Init_MemAllocate_Fluid() when OPT__FLU_SUPER_BLOCK is on
+//                2. Each batch of super-blocks uses the same host arrays as the regular solver and thus contains
+//                   at most Flu_NPatchGroup/8 super-blocks
+//
+// Parameter   :  Flu_NPatchGroup : Maximum number of patch groups in the regular fluid solver
+//-------------------------------------------------------------------------------------------------------
+void Flu_SuperBlock_MemAllocate( const int Flu_NPatchGroup )
+{
+
+   SB_NBlock_Max = Flu_NPatchGroup/8;
+
+   if ( SB_NBlock_Max < 1 )
+      Aux_Error( ERROR_INFO, "Flu_NPatchGroup (%d) < 8 for OPT__FLU_SUPER_BLOCK !!\n", Flu_NPatchGroup );
+
+   SB_Flu_Array_In  = new real [SB_NBlock_Max][FLU_NIN ][ CUBE(FLU_SB_NXT) ];
+   SB_Flu_Array_Out = new real [SB_NBlock_Max][FLU_NOUT][ CUBE(FLU_SB_PS2) ];
+
+   if ( amr->WithFlux )
+   SB_Flux_Array    = new real [SB_NBlock_Max][9][NFLUX_TOTAL][ SQR(FLU_SB_PS2) ];
+
+#  ifdef DUAL_ENERGY
+   SB_DE_Array_Out  = new char [SB_NBlock_Max][ CUBE(FLU_SB_PS2) ];
+#  endif
+
+#  ifdef UNSPLIT_GRAVITY
+   SB_Pot_Array_USG = new real [SB_NBlock_Max][ CUBE(USG_SB_NXT_F) ];
+
+   if ( OPT__EXT_ACC  ||  SRC_FUSE_FLUID )
+#  else
+   if ( SRC_FUSE_FLUID )
+#  endif
+   SB_Corner_Array  = new double [SB_NBlock_Max][3];
+
+   CPU_FluidSolver_SuperBlock_MemAllocate( OMP_NTHREAD );
+
+} // FUNCTION : Flu_SuperBlock_MemAllocate
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  Flu_SuperBlock_MemFree
+// Description :  Free memory allocated by Flu_SuperBlock_MemAllocate()
+//
+// Note        :  Invoked by End_MemFree_Fluid()
+//-------------------------------------------------------------------------------------------------------
+void Flu_SuperBlock_MemFree()
+{
+
+   delete [] SB_Flu_Array_In;    SB_Flu_Array_In  = NULL;
+   delete [] SB_Flu_Array_Out;   SB_Flu_Array_Out = NULL;
+   delete [] SB_Flux_Array;      SB_Flux_Array    = NULL;
+   delete [] SB_DE_Array_Out;    SB_DE_Array_Out  = NULL;
+   delete [] SB_Pot_Array_USG;   SB_Pot_Array_USG = NULL;
+   delete [] SB_Corner_Array;    SB_Corner_Array  = NULL;
+
+   SB_NBlock_Max = 0;
+
+   CPU_FluidSolver_SuperBlock_MemFree();
+
+} // FUNCTION : Flu_SuperBlock_MemFree
+
+
+
+#endif // #ifdef SUPPORT_FLU_SUPER_BLOCK
@@ -76,7 +76,7 @@ void Grackle_Close( const int lv, const int SaveSg, const real h_Che_Array[], co
 #  ifdef DUAL_ENERGY
    real Pres;
 #  endif
-   real (*fluid)[PS1][PS1][PS1]=NULL;
+   real_store (*fluid)[PS1][PS1][PS1]=NULL;
 
    const real *Ptr_Dens=NULL, *Ptr_sEint=NULL, *Ptr_Ent=NULL, *Ptr_e=NULL, *Ptr_HI=NULL, *Ptr_HII=NULL;
    const real *Ptr_HeI=NULL, *Ptr_HeII=NULL, *Ptr_HeIII=NULL, *Ptr_HM=NULL, *Ptr_H2I=NULL, *Ptr_H2II=NULL;
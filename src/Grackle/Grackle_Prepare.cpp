@@ -130,7 +130,7 @@ void Grackle_Prepare( const int lv, real h_Che_Array[], const int NPG, const int
 #  else
    real Px, Py, Pz, Emag=NULL_REAL;
 #  endif // #ifdef DUAL_ENERGY ... else ...
-   real (*fluid)[PS1][PS1][PS1]=NULL;
+   real_store (*fluid)[PS1][PS1][PS1]=NULL;
 
    real *Ptr_Dens=NULL, *Ptr_sEint=NULL, *Ptr_Ent=NULL, *Ptr_e=NULL, *Ptr_HI=NULL, *Ptr_HII=NULL;
    real *Ptr_HeI=NULL, *Ptr_HeII=NULL, *Ptr_HeIII=NULL, *Ptr_HM=NULL, *Ptr_H2I=NULL, *Ptr_H2II=NULL;
@@ -21,6 +21,8 @@ void End_GAMER()
 
 #  ifdef TIMING
    Aux_DeleteTimer();
+   Aux_Trace_End();
+   Aux_PerfCounter_End();
 #  endif
 
    End_MemFree();
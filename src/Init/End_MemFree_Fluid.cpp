@@ -74,6 +74,10 @@ void End_MemFree_Fluid()
    SrcTerms.Dlep_Profile_RadiusDevPtr = NULL;
 #  endif
 
+#  ifdef SUPPORT_FLU_SUPER_BLOCK
+   Flu_SuperBlock_MemFree();
+#  endif
+
 } // FUNCTION : End_MemFree_Fluid
 
 
@@ -13,25 +13,34 @@ void Init_BaseLevel()
    const int NPatch[3] = { NX0[0]/PATCH_SIZE, NX0[1]/PATCH_SIZE, NX0[2]/PATCH_SIZE };
    const int scale0    = amr->scale[0];
    const int Width     = PATCH_SIZE*scale0;
+   const int NPG[3]    = { NPatch[0]/2, NPatch[1]/2, NPatch[2]/2 };
+   const int NPG_All   = NPG[0]*NPG[1]*NPG[2];
 
-   int Cr[3];
+   if ( amr->num[0]+8*NPG_All > MAX_PATCH )
+      Aux_Error( ERROR_INFO, "exceed MAX_PATCH (%d) => please reset it in the Makefile !!\n", MAX_PATCH );
 
 
 // allocate the real base-level patches
-   for (int Pz=0; Pz<NPatch[2]; Pz+=2)    {  Cr[2] = MPI_Rank_X[2]*NX0[2]*scale0 + Pz*PATCH_SIZE*scale0;
-   for (int Py=0; Py<NPatch[1]; Py+=2)    {  Cr[1] = MPI_Rank_X[1]*NX0[1]*scale0 + Py*PATCH_SIZE*scale0;
-   for (int Px=0; Px<NPatch[0]; Px+=2)    {  Cr[0] = MPI_Rank_X[0]*NX0[0]*scale0 + Px*PATCH_SIZE*scale0;
-
-      amr->pnew( 0, Cr[0],       Cr[1],       Cr[2],       -1, true, true, true );
-      amr->pnew( 0, Cr[0]+Width, Cr[1],       Cr[2],       -1, true, true, true );
-      amr->pnew( 0, Cr[0],       Cr[1]+Width, Cr[2],       -1, true, true, true );
-      amr->pnew( 0, Cr[0],       Cr[1],       Cr[2]+Width, -1, true, true, true );
-      amr->pnew( 0, Cr[0]+Width, Cr[1]+Width, Cr[2],       -1, true, true, true );
-      amr->pnew( 0, Cr[0],       Cr[1]+Width, Cr[2]+Width, -1, true, true, true );
-      amr->pnew( 0, Cr[0]+Width, Cr[1],       Cr[2]+Width, -1, true, true, true );
-      amr->pnew( 0, Cr[0]+Width, Cr[1]+Width, Cr[2]+Width, -1, true, true, true );
-
-   }}}
+// --> patch IDs are computed from the patch group indices so that patches can be allocated in parallel
+#  pragma omp parallel for schedule( static )
+   for (int PG=0; PG<NPG_All; PG++)
+   {
+      const int i     = PG%NPG[0];
+      const int j     = PG/NPG[0]%NPG[1];
+      const int k     = PG/NPG[0]/NPG[1];
+      const int PID0  = amr->num[0] + 8*PG;
+      const int Cr[3] = { MPI_Rank_X[0]*NX0[0]*scale0 + 2*i*PATCH_SIZE*scale0,
+                          MPI_Rank_X[1]*NX0[1]*scale0 + 2*j*PATCH_SIZE*scale0,
+                          MPI_Rank_X[2]*NX0[2]*scale0 + 2*k*PATCH_SIZE*scale0 };
+
+      for (int LocalID=0; LocalID<8; LocalID++)
+         amr->pnew_PID( 0, PID0+LocalID, Cr[0]+TABLE_02( LocalID, 'x', 0, Width ),
+                                         Cr[1]+TABLE_02( LocalID, 'y', 0, Width ),
+                                         Cr[2]+TABLE_02( LocalID, 'z', 0, Width ),
+                        -1, true, true, true );
+   }
+
+   amr->num[0] += 8*NPG_All;
 
    for (int m=1; m<28; m++)   amr->NPatchComma[0][m] = amr->num[0];
 
@@ -139,8 +139,9 @@ void Init_ByFile()
    const bool   ResetLB_Yes      = true;
    const bool   ResetLB_No       = false;
    const int    AllLv            = -1;
+   const bool   Incremental_No   = false;
 
-   LB_Init_LoadBalance( Redistribute_No, ParWeight_Zero, ResetLB_No, AllLv );
+   LB_Init_LoadBalance( Redistribute_No, ParWeight_Zero, ResetLB_No, AllLv, Incremental_No );
 
 #  else // for SERIAL
 
@@ -201,7 +202,7 @@ void Init_ByFile()
 // 5. optimize load-balancing to take into account particle weighting
 #  if ( defined PARTICLE  &&  defined LOAD_BALANCE )
    if ( amr->LB->Par_Weight > 0.0 )
-      LB_Init_LoadBalance( Redistribute_Yes, amr->LB->Par_Weight, ResetLB_Yes, AllLv );
+      LB_Init_LoadBalance( Redistribute_Yes, amr->LB->Par_Weight, ResetLB_Yes, AllLv, Incremental_No );
 #  endif
 
 
@@ -235,7 +236,7 @@ void Init_ByFile()
       Buf_GetBufferData( lv+1, amr->FluSg[lv+1], amr->MagSg[lv+1], NULL_INT, DATA_AFTER_REFINE,
                          _TOTAL, _MAG, Flu_ParaBuf, USELB_YES );
 
-      LB_Init_LoadBalance( Redistribute_Yes, Par_Weight, ResetLB_Yes, lv+1 );
+      LB_Init_LoadBalance( Redistribute_Yes, Par_Weight, ResetLB_Yes, lv+1, Incremental_No );
 #     endif
 
       if ( MPI_Rank == 0 )    Aux_Message( stdout, "done\n" );
@@ -261,7 +262,7 @@ void Init_ByFile()
       Buf_GetBufferData( lv+1, amr->FluSg[lv+1], amr->MagSg[lv+1], NULL_INT, DATA_AFTER_REFINE,
                          _TOTAL, _MAG, Flu_ParaBuf, USELB_YES );
 
-      LB_Init_LoadBalance( Redistribute_Yes, Par_Weight, ResetLB_Yes, lv+1 );
+      LB_Init_LoadBalance( Redistribute_Yes, Par_Weight, ResetLB_Yes, lv+1, Incremental_No );
 #     endif
 
       if ( MPI_Rank == 0 )    Aux_Message( stdout, "done\n" );
@@ -1,6 +1,7 @@
 #include "GAMER.h"
 
 void Init_ByFunction_AssignData( const int lv );
+void Init_ByFunction_ShowTiming( const int NStage, const char *StageName[], Timer_t *Timer[][NLEVEL] );
 
 
 
@@ -10,6 +11,8 @@ void Init_ByFunction_AssignData( const int lv );
 // Description :  Set up the initial condition by invoking Init_ByFunction_AssignData()
 //
 // Note        :  1. Invoke the alternative function LB_Init_ByFunction() when LOAD_BALANCE is adopted
+//                2. Elapsed time of each stage on each level is reported by Init_ByFunction_ShowTiming()
+//                   when TIMING is on
 //-------------------------------------------------------------------------------------------------------
 void Init_ByFunction()
 {
@@ -24,27 +27,40 @@ void Init_ByFunction()
    if ( MPI_Rank == 0 )    Aux_Message( stdout, "%s ...\n", __FUNCTION__ );
 
 
+// timers of different start-up stages
+// --> flagging and refinement are recorded on the level being created and restriction on the coarse level
+// --> stages = [ Refine, Flag, Assign, Buffer, Restrict ]
+   const int NStage = 5;
+
+   Timer_t *Timer[NStage][NLEVEL];
+
+   for (int s=0; s<NStage; s++)
+   for (int lv=0; lv<NLEVEL; lv++)     Timer[s][lv] = new Timer_t;
+
+
 // construct levels 0 ~ NLEVEL-1
    for (int lv=0; lv<NLEVEL; lv++)
    {
       if ( MPI_Rank == 0 )    Aux_Message( stdout, "   Constructing level %d ... ", lv );
 
       if ( lv == 0 )
-      Init_BaseLevel();
+      TIMING_FUNC(   Init_BaseLevel(),                   Timer[0][lv],   TIMER_ON   );
 
-      Init_ByFunction_AssignData( lv );
+      TIMING_FUNC(   Init_ByFunction_AssignData( lv ),   Timer[2][lv],   TIMER_ON   );
 
-      Buf_GetBufferData( lv, amr->FluSg[lv], amr->MagSg[lv], NULL_INT, DATA_GENERAL, _TOTAL, _MAG, Flu_ParaBuf, USELB_NO );
+      TIMING_FUNC(   Buf_GetBufferData( lv, amr->FluSg[lv], amr->MagSg[lv], NULL_INT, DATA_GENERAL, _TOTAL, _MAG,
+                                        Flu_ParaBuf, USELB_NO ),
+                     Timer[3][lv],   TIMER_ON   );
 
       if ( lv != TOP_LEVEL )
       {
-         Flag_Real( lv, USELB_NO );
+         TIMING_FUNC(   Flag_Real( lv, USELB_NO ),        Timer[1][lv+1],   TIMER_ON   );
 
-         MPI_ExchangeBoundaryFlag( lv );
+         TIMING_FUNC(   MPI_ExchangeBoundaryFlag( lv ),   Timer[1][lv+1],   TIMER_ON   );
 
-         Flag_Buffer( lv );
+         TIMING_FUNC(   Flag_Buffer( lv ),                Timer[1][lv+1],   TIMER_ON   );
 
-         Init_Refine( lv );
+         TIMING_FUNC(   Init_Refine( lv ),                Timer[0][lv+1],   TIMER_ON   );
       }
 
       if ( MPI_Rank == 0 )    Aux_Message( stdout, "done\n" );
@@ -57,9 +73,13 @@ void Init_ByFunction()
    {
       for (int lv=TOP_LEVEL-1; lv>=0; lv--)
       {
-         Flu_FixUp_Restrict( lv, amr->FluSg[lv+1], amr->FluSg[lv], amr->MagSg[lv+1], amr->MagSg[lv], NULL_INT, NULL_INT, _TOTAL, _MAG );
+         TIMING_FUNC(   Flu_FixUp_Restrict( lv, amr->FluSg[lv+1], amr->FluSg[lv], amr->MagSg[lv+1], amr->MagSg[lv],
+                                            NULL_INT, NULL_INT, _TOTAL, _MAG ),
+                        Timer[4][lv],   TIMER_ON   );
 
-         Buf_GetBufferData( lv, amr->FluSg[lv], amr->MagSg[lv], NULL_INT, DATA_GENERAL, _TOTAL, _MAG, Flu_ParaBuf, USELB_NO );
+         TIMING_FUNC(   Buf_GetBufferData( lv, amr->FluSg[lv], amr->MagSg[lv], NULL_INT, DATA_GENERAL, _TOTAL, _MAG,
+                                           Flu_ParaBuf, USELB_NO ),
+                        Timer[4][lv],   TIMER_ON   );
       } // for (int lv=NLEVEL-2; lv>=0; lv--)
    } // if ( OPT__INIT_RESTRICT )
 
@@ -68,6 +88,17 @@ void Init_ByFunction()
    for (int lv=0; lv<NLEVEL; lv++)     Mis_GetTotalPatchNumber( lv );
 
 
+// report the start-up timing
+#  ifdef TIMING
+   const char *StageName[NStage] = { "Refine", "Flag", "Assign", "Buffer", "Restrict" };
+
+   Init_ByFunction_ShowTiming( NStage, StageName, Timer );
+#  endif
+
+   for (int s=0; s<NStage; s++)
+   for (int lv=0; lv<NLEVEL; lv++)     delete Timer[s][lv];
+
+
    if ( MPI_Rank == 0 )    Aux_Message( stdout, "%s ... done\n", __FUNCTION__ );
 
 } // FUNCTION : Init_ByFunction
@@ -96,3 +127,69 @@ void Init_ByFunction_AssignData( const int lv )
 #  endif // MODEL
 
 } // FUNCTION : Init_ByFunction_AssignData
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  Init_ByFunction_ShowTiming
+// Description :  Show the elapsed time of each start-up stage on each level
+//
+// Note        :  1. Invoked by Init_ByFunction() and LB_Init_ByFunction()
+//                2. Show the maximum elapsed time among all MPI ranks
+//                3. All ranks must invoke this function
+//
+// Parameter   :  NStage    : Number of start-up stages
+//                StageName : Name of each stage
+//                Timer     : Timers of each stage on each level
+//-------------------------------------------------------------------------------------------------------
+void Init_ByFunction_ShowTiming( const int NStage, const char *StageName[], Timer_t *Timer[][NLEVEL] )
+{
+
+   double *Time_ThisRank = new double [NStage*NLEVEL];
+   double *Time_Max      = new double [NStage*NLEVEL];
+
+   for (int s=0; s<NStage; s++)
+   for (int lv=0; lv<NLEVEL; lv++)     Time_ThisRank[ s*NLEVEL + lv ] = Timer[s][lv]->GetValue();
+
+   MPI_Reduce( Time_ThisRank, Time_Max, NStage*NLEVEL, MPI_DOUBLE, MPI_MAX, 0, MPI_COMM_WORLD );
+
+
+   if ( MPI_Rank == 0 )
+   {
+      double Sum_Stage, Sum_All=0.0;
+
+      Aux_Message( stdout, "   Start-up timing (maximum among all ranks, in seconds):\n" );
+      Aux_Message( stdout, "   %5s", "Level" );
+      for (int s=0; s<NStage; s++)     Aux_Message( stdout, " %10s", StageName[s] );
+      Aux_Message( stdout, " %10s\n", "Sum" );
+
+      for (int lv=0; lv<NLEVEL; lv++)
+      {
+         Sum_Stage = 0.0;
+
+         Aux_Message( stdout, "   %5d", lv );
+         for (int s=0; s<NStage; s++)
+         {
+            Aux_Message( stdout, " %10.3f", Time_Max[ s*NLEVEL + lv ] );
+            Sum_Stage += Time_Max[ s*NLEVEL + lv ];
+         }
+         Aux_Message( stdout, " %10.3f\n", Sum_Stage );
+      }
+
+      Aux_Message( stdout, "   %5s", "Sum" );
+      for (int s=0; s<NStage; s++)
+      {
+         Sum_Stage = 0.0;
+         for (int lv=0; lv<NLEVEL; lv++)  Sum_Stage += Time_Max[ s*NLEVEL + lv ];
+
+         Aux_Message( stdout, " %10.3f", Sum_Stage );
+         Sum_All += Sum_Stage;
+      }
+      Aux_Message( stdout, " %10.3f\n", Sum_All );
+   } // if ( MPI_Rank == 0 )
+
+
+   delete [] Time_ThisRank;
+   delete [] Time_Max;
+
+} // FUNCTION : Init_ByFunction_ShowTiming
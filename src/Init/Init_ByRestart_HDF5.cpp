@@ -921,15 +921,21 @@ void Init_ByRestart_HDF5( const char *FileName )
    const bool   ResetLB_Yes      = true;
    const bool   ResetLB_No       = false;
    const int    AllLv            = -1;
+   const bool   Incremental_No   = false;
 
-   LB_Init_LoadBalance( Redistribute_No, ParWeight_Zero, ResetLB_No, AllLv );
+   LB_Init_LoadBalance( Redistribute_No, ParWeight_Zero, ResetLB_No, AllLv, Incremental_No );
 
 // redistribute patches again if we want to take into account the load-balance weighting of particles
+// or to partition all levels jointly (OPT__LB_ALL_LEVEL)
 #  ifdef PARTICLE
-   if ( amr->LB->Par_Weight > 0.0 )
-   LB_Init_LoadBalance( Redistribute_Yes, amr->LB->Par_Weight, ResetLB_Yes, AllLv );
+   const double ParWeight        = amr->LB->Par_Weight;
+#  else
+   const double ParWeight        = 0.0;
 #  endif
 
+   if ( ParWeight > 0.0  ||  OPT__LB_ALL_LEVEL )
+   LB_Init_LoadBalance( Redistribute_Yes, ParWeight, ResetLB_Yes, AllLv, Incremental_No );
+
 
 
 // 5-2. complete all levels for the case without LOAD_BALANCE
@@ -1227,9 +1233,10 @@ void LoadOnePatch( const hid_t H5_FileID, const int lv, const int GID, const boo
 
 // load cell-centered intrinsic variables from disk
 // --> excluding all derived variables such as gravitational potential and cell-centered B field
+// --> HDF5 converts the data to real_store automatically when MIXED_PRECISION is on
    for (int v=0; v<NCOMP_TOTAL; v++)
    {
-      H5_Status = H5Dread( H5_SetID_Field[v], H5T_GAMER_REAL, H5_MemID_Field, H5_SpaceID_Field, H5P_DEFAULT,
+      H5_Status = H5Dread( H5_SetID_Field[v], H5T_GAMER_REAL_STORE, H5_MemID_Field, H5_SpaceID_Field, H5P_DEFAULT,
                            amr->patch[ amr->FluSg[lv] ][lv][PID]->fluid[v] );
       if ( H5_Status < 0 )
          Aux_Error( ERROR_INFO, "failed to load a field variable (lv %d, GID %d, v %d) !!\n", lv, GID, v );
@@ -1254,7 +1261,7 @@ void LoadOnePatch( const hid_t H5_FileID, const int lv, const int GID, const boo
       if ( H5_Status < 0 )   Aux_Error( ERROR_INFO, "failed to create a hyperslab for the magnetic field %d !!\n", v );
 
 //    load data
-      H5_Status = H5Dread( H5_SetID_FCMag[v], H5T_GAMER_REAL, H5_MemID_FCMag[v], H5_SpaceID_FCMag[v], H5P_DEFAULT,
+      H5_Status = H5Dread( H5_SetID_FCMag[v], H5T_GAMER_REAL_STORE, H5_MemID_FCMag[v], H5_SpaceID_FCMag[v], H5P_DEFAULT,
                            amr->patch[ amr->MagSg[lv] ][lv][PID]->magnetic[v] );
       if ( H5_Status < 0 )
          Aux_Error( ERROR_INFO, "failed to load magnetic field (lv %d, GID %d, v %d) !!\n", lv, GID, v );
@@ -1410,6 +1417,7 @@ void Check_Makefile( const char *FileName, const int FormatVersion )
    LoadField( "Timing",                 &RS.Timing,                 SID, TID, NonFatal, &RT.Timing,                 1, NonFatal );
    LoadField( "TimingSolver",           &RS.TimingSolver,           SID, TID, NonFatal, &RT.TimingSolver,           1, NonFatal );
    LoadField( "Float8",                 &RS.Float8,                 SID, TID, NonFatal, &RT.Float8,                 1, NonFatal );
+   LoadField( "MixedPrecision",         &RS.MixedPrecision,         SID, TID, NonFatal, &RT.MixedPrecision,         1, NonFatal );
    LoadField( "Serial",                 &RS.Serial,                 SID, TID, NonFatal, &RT.Serial,                 1, NonFatal );
    LoadField( "LoadBalance",            &RS.LoadBalance,            SID, TID, NonFatal, &RT.LoadBalance,            1, NonFatal );
    LoadField( "OverlapMPI",             &RS.OverlapMPI,             SID, TID, NonFatal, &RT.OverlapMPI,             1, NonFatal );
@@ -1630,6 +1638,7 @@ void Check_SymConst( const char *FileName, const int FormatVersion )
    LoadField( "Src_NAuxDlep",         &RS.Src_NAuxDlep,         SID, TID, NonFatal, &RT.Src_NAuxDlep,          1, NonFatal );
    LoadField( "Src_DlepProfNVar",     &RS.Src_DlepProfNVar,     SID, TID, NonFatal, &RT.Src_DlepProfNVar,      1, NonFatal );
    LoadField( "Src_DlepProfNBinMax",  &RS.Src_DlepProfNBinMax,  SID, TID, NonFatal, &RT.Src_DlepProfNBinMax,   1, NonFatal );
+   LoadField( "Src_NAuxCool",         &RS.Src_NAuxCool,         SID, TID, NonFatal, &RT.Src_NAuxCool,          1, NonFatal );
    LoadField( "Src_NAuxUser",         &RS.Src_NAuxUser,         SID, TID, NonFatal, &RT.Src_NAuxUser,          1, NonFatal );
 
 
@@ -1766,6 +1775,7 @@ void Check_InputPara( const char *FileName, const int FormatVersion )
    LoadField( "AutoReduceDt",            &RS.AutoReduceDt,            SID, TID, NonFatal, &RT.AutoReduceDt,             1, NonFatal );
    LoadField( "AutoReduceDtFactor",      &RS.AutoReduceDtFactor,      SID, TID, NonFatal, &RT.AutoReduceDtFactor,       1, NonFatal );
    LoadField( "AutoReduceDtFactorMin",   &RS.AutoReduceDtFactorMin,   SID, TID, NonFatal, &RT.AutoReduceDtFactorMin,    1, NonFatal );
+   LoadField( "AutoReduceDtLocal",       &RS.AutoReduceDtLocal,       SID, TID, NonFatal, &RT.AutoReduceDtLocal,        1, NonFatal );
 
 
 // domain refinement
@@ -1809,6 +1819,7 @@ void Check_InputPara( const char *FileName, const int FormatVersion )
 #  endif
    LoadField( "Opt__ReuseMemory",        &RS.Opt__ReuseMemory,        SID, TID, NonFatal, &RT.Opt__ReuseMemory,         1, NonFatal );
    LoadField( "Opt__MemoryPool",         &RS.Opt__MemoryPool,         SID, TID, NonFatal, &RT.Opt__MemoryPool,          1, NonFatal );
+   LoadField( "Opt__SingleSandglass",    &RS.Opt__SingleSandglass,    SID, TID, NonFatal, &RT.Opt__SingleSandglass,     1, NonFatal );
 
 // load balance
 #  ifdef LOAD_BALANCE
@@ -1817,6 +1828,10 @@ void Check_InputPara( const char *FileName, const int FormatVersion )
    LoadField( "LB_Par_Weight",           &RS.LB_Par_Weight,           SID, TID, NonFatal, &RT.LB_Par_Weight,            1, NonFatal );
 #  endif
    LoadField( "Opt__RecordLoadBalance",  &RS.Opt__RecordLoadBalance,  SID, TID, NonFatal, &RT.Opt__RecordLoadBalance,   1, NonFatal );
+   LoadField( "Opt__LB_AllLevel",        &RS.Opt__LB_AllLevel,        SID, TID, NonFatal, &RT.Opt__LB_AllLevel,         1, NonFatal );
+   LoadField( "Opt__LB_Incremental",     &RS.Opt__LB_Incremental,     SID, TID, NonFatal, &RT.Opt__LB_Incremental,      1, NonFatal );
+   LoadField( "Opt__LB_IncMaxShift",     &RS.Opt__LB_IncMaxShift,     SID, TID, NonFatal, &RT.Opt__LB_IncMaxShift,      1, NonFatal );
+   LoadField( "Opt__LB_SparseComm",      &RS.Opt__LB_SparseComm,      SID, TID, NonFatal, &RT.Opt__LB_SparseComm,       1, NonFatal );
 #  endif
    LoadField( "Opt__MinimizeMPIBarrier", &RS.Opt__MinimizeMPIBarrier, SID, TID, NonFatal, &RT.Opt__MinimizeMPIBarrier,  1, NonFatal );
 
@@ -1825,10 +1840,23 @@ void Check_InputPara( const char *FileName, const int FormatVersion )
    LoadField( "Gamma",                   &RS.Gamma,                   SID, TID, NonFatal, &RT.Gamma,                    1, NonFatal );
    LoadField( "MolecularWeight",         &RS.MolecularWeight,         SID, TID, NonFatal, &RT.MolecularWeight,          1, NonFatal );
    LoadField( "IsoTemp",                 &RS.IsoTemp,                 SID, TID, NonFatal, &RT.IsoTemp,                  1, NonFatal );
+   LoadField( "EoSTab_Name",             &RS.EoSTab_Name,             SID, TID, NonFatal,  RT.EoSTab_Name,              1, NonFatal );
+   LoadField( "EoSTab_NDens",            &RS.EoSTab_NDens,            SID, TID, NonFatal, &RT.EoSTab_NDens,             1, NonFatal );
+   LoadField( "EoSTab_NSEint",           &RS.EoSTab_NSEint,           SID, TID, NonFatal, &RT.EoSTab_NSEint,            1, NonFatal );
+   LoadField( "EoSTab_NYe",              &RS.EoSTab_NYe,              SID, TID, NonFatal, &RT.EoSTab_NYe,               1, NonFatal );
+   LoadField( "EoSTab_NPres",            &RS.EoSTab_NPres,            SID, TID, NonFatal, &RT.EoSTab_NPres,             1, NonFatal );
+   LoadField( "EoSTab_LogDens_Min",      &RS.EoSTab_LogDens_Min,      SID, TID, NonFatal, &RT.EoSTab_LogDens_Min,       1, NonFatal );
+   LoadField( "EoSTab_LogDens_Max",      &RS.EoSTab_LogDens_Max,      SID, TID, NonFatal, &RT.EoSTab_LogDens_Max,       1, NonFatal );
+   LoadField( "EoSTab_LogSEint_Min",     &RS.EoSTab_LogSEint_Min,     SID, TID, NonFatal, &RT.EoSTab_LogSEint_Min,      1, NonFatal );
+   LoadField( "EoSTab_LogSEint_Max",     &RS.EoSTab_LogSEint_Max,     SID, TID, NonFatal, &RT.EoSTab_LogSEint_Max,      1, NonFatal );
+   LoadField( "EoSTab_Ye_Min",           &RS.EoSTab_Ye_Min,           SID, TID, NonFatal, &RT.EoSTab_Ye_Min,            1, NonFatal );
+   LoadField( "EoSTab_Ye_Max",           &RS.EoSTab_Ye_Max,           SID, TID, NonFatal, &RT.EoSTab_Ye_Max,            1, NonFatal );
    LoadField( "MinMod_Coeff",            &RS.MinMod_Coeff,            SID, TID, NonFatal, &RT.MinMod_Coeff,             1, NonFatal );
    LoadField( "Opt__LR_Limiter",         &RS.Opt__LR_Limiter,         SID, TID, NonFatal, &RT.Opt__LR_Limiter,          1, NonFatal );
    LoadField( "Opt__1stFluxCorr",        &RS.Opt__1stFluxCorr,        SID, TID, NonFatal, &RT.Opt__1stFluxCorr,         1, NonFatal );
    LoadField( "Opt__1stFluxCorrScheme",  &RS.Opt__1stFluxCorrScheme,  SID, TID, NonFatal, &RT.Opt__1stFluxCorrScheme,   1, NonFatal );
+   LoadField( "Opt__FluSuperBlock",      &RS.Opt__FluSuperBlock,      SID, TID, NonFatal, &RT.Opt__FluSuperBlock,       1, NonFatal );
+   LoadField( "Opt__FluSlab",            &RS.Opt__FluSlab,            SID, TID, NonFatal, &RT.Opt__FluSlab,             1, NonFatal );
 #  endif
 
 // ELBDM solvers
@@ -1899,7 +1927,14 @@ void Check_InputPara( const char *FileName, const int FormatVersion )
 
 // source terms
    LoadField( "Src_Deleptonization",     &RS.Src_Deleptonization,     SID, TID, NonFatal, &RT.Src_Deleptonization,      1, NonFatal );
+#  if ( MODEL == HYDRO )
+   LoadField( "Src_Cooling",             &RS.Src_Cooling,             SID, TID, NonFatal, &RT.Src_Cooling,              1, NonFatal );
+   LoadField( "Src_Cooling_Table",       &RS.Src_Cooling_Table,       SID, TID, NonFatal,  RT.Src_Cooling_Table,        1, NonFatal );
+   LoadField( "Src_Cooling_Redshift",    &RS.Src_Cooling_Redshift,    SID, TID, NonFatal, &RT.Src_Cooling_Redshift,     1, NonFatal );
+   LoadField( "Src_Cooling_Metal",       &RS.Src_Cooling_Metal,       SID, TID, NonFatal, &RT.Src_Cooling_Metal,        1, NonFatal );
+#  endif
    LoadField( "Src_User",                &RS.Src_User,                SID, TID, NonFatal, &RT.Src_User,                 1, NonFatal );
+   LoadField( "Src_FuseFluid",           &RS.Src_FuseFluid,           SID, TID, NonFatal, &RT.Src_FuseFluid,            1, NonFatal );
    LoadField( "Src_GPU_NPGroup",         &RS.Src_GPU_NPGroup,         SID, TID, NonFatal, &RT.Src_GPU_NPGroup,          1, NonFatal );
 
 // Grackle
@@ -2007,6 +2042,10 @@ void Check_InputPara( const char *FileName, const int FormatVersion )
    LoadField( "Opt__TimingBarrier",      &RS.Opt__TimingBarrier,      SID, TID, NonFatal, &RT.Opt__TimingBarrier,       1, NonFatal );
    LoadField( "Opt__TimingBalance",      &RS.Opt__TimingBalance,      SID, TID, NonFatal, &RT.Opt__TimingBalance,       1, NonFatal );
    LoadField( "Opt__TimingMPI",          &RS.Opt__TimingMPI,          SID, TID, NonFatal, &RT.Opt__TimingMPI,           1, NonFatal );
+   LoadField( "Opt__TimingTrace",        &RS.Opt__TimingTrace,        SID, TID, NonFatal, &RT.Opt__TimingTrace,         1, NonFatal );
+   LoadField( "Opt__TimingTrace_NEvent", &RS.Opt__TimingTrace_NEvent, SID, TID, NonFatal, &RT.Opt__TimingTrace_NEvent,  1, NonFatal );
+   LoadField( "Opt__TimingPerf",         &RS.Opt__TimingPerf,         SID, TID, NonFatal, &RT.Opt__TimingPerf,          1, NonFatal );
+   LoadField( "Opt__TimingPerf_Raw",     &RS.Opt__TimingPerf_Raw,     SID, TID, NonFatal, &RT.Opt__TimingPerf_Raw,      1, NonFatal );
    LoadField( "Opt__RecordNote",         &RS.Opt__RecordNote,         SID, TID, NonFatal, &RT.Opt__RecordNote,          1, NonFatal );
    LoadField( "Opt__RecordUnphy",        &RS.Opt__RecordUnphy,        SID, TID, NonFatal, &RT.Opt__RecordUnphy,         1, NonFatal );
    LoadField( "Opt__RecordMemory",       &RS.Opt__RecordMemory,       SID, TID, NonFatal, &RT.Opt__RecordMemory,        1, NonFatal );
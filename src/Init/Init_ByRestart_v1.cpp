@@ -481,8 +481,9 @@ void Init_ByRestart_v1( const char FileName[] )
    const bool   ResetLB_Yes      = true;
    const bool   ResetLB_No       = false;
    const int    AllLv            = -1;
+   const bool   Incremental_No   = false;
 
-   LB_Init_LoadBalance( Redistribute_No, ParWeight_Zero, ResetLB_No, AllLv );
+   LB_Init_LoadBalance( Redistribute_No, ParWeight_Zero, ResetLB_No, AllLv, Incremental_No );
 
 
 // fill up the data of non-leaf patches
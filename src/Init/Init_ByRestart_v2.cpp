@@ -58,6 +58,11 @@ void Init_ByRestart()
    if ( !Aux_CheckFileExist(FileName)  &&  MPI_Rank == 0 )
       Aux_Error( ERROR_INFO, "restart file \"%s\" does not exist !!\n", FileName );
 
+// the C-binary format stores the patch data in real instead of real_store
+#  ifdef MIXED_PRECISION
+   Aux_Error( ERROR_INFO, "MIXED_PRECISION only supports restarting from the HDF5 format !!\n" );
+#  endif
+
    MPI_Barrier( MPI_COMM_WORLD );
 
 
@@ -705,13 +710,14 @@ void Init_ByRestart()
    const bool   ResetLB_Yes      = true;
    const bool   ResetLB_No       = false;
    const int    AllLv            = -1;
+   const bool   Incremental_No   = false;
 
-   LB_Init_LoadBalance( Redistribute_No, ParWeight_Zero, ResetLB_No, AllLv );
+   LB_Init_LoadBalance( Redistribute_No, ParWeight_Zero, ResetLB_No, AllLv, Incremental_No );
 
 // redistribute patches again if we want to take into account the load-balance weighting of particles
 #  ifdef PARTICLE
    if ( amr->LB->Par_Weight > 0.0 )
-   LB_Init_LoadBalance( Redistribute_Yes, amr->LB->Par_Weight, ResetLB_Yes, AllLv );
+   LB_Init_LoadBalance( Redistribute_Yes, amr->LB->Par_Weight, ResetLB_Yes, AllLv, Incremental_No );
 #  endif
 
 
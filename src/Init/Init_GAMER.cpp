@@ -139,6 +139,8 @@ void Init_GAMER( int *argc, char ***argv )
 // initialize the timer function
 #  ifdef TIMING
    Aux_CreateTimer();
+   Aux_Trace_Init();
+   Aux_PerfCounter_Init();
 #  endif
 
 
@@ -121,6 +121,7 @@ void Init_Load_Parameter()
    ReadPara->Add( "AUTO_REDUCE_DT",             &AUTO_REDUCE_DT,                  true,            Useless_bool,  Useless_bool   );
    ReadPara->Add( "AUTO_REDUCE_DT_FACTOR",      &AUTO_REDUCE_DT_FACTOR,           0.8,             Eps_double,    1.0            );
    ReadPara->Add( "AUTO_REDUCE_DT_FACTOR_MIN",  &AUTO_REDUCE_DT_FACTOR_MIN,       0.1,             0.0,           1.0            );
+   ReadPara->Add( "AUTO_REDUCE_DT_LOCAL",       &AUTO_REDUCE_DT_LOCAL,            false,           Useless_bool,  Useless_bool   );
 
 
 // grid refinement
@@ -162,6 +163,7 @@ void Init_Load_Parameter()
 #  endif
    ReadPara->Add( "OPT__REUSE_MEMORY",          &OPT__REUSE_MEMORY,               2,               0,             2              );
    ReadPara->Add( "OPT__MEMORY_POOL",           &OPT__MEMORY_POOL,                false,           Useless_bool,  Useless_bool   );
+   ReadPara->Add( "OPT__SINGLE_SANDGLASS",      &OPT__SINGLE_SANDGLASS,           false,           Useless_bool,  Useless_bool   );
 
 
 // load balance
@@ -171,13 +173,24 @@ void Init_Load_Parameter()
    ReadPara->Add( "LB_INPUT__PAR_WEIGHT",       &LB_INPUT__PAR_WEIGHT,            0.0,             0.0,           NoMax_double   );
 #  endif
    ReadPara->Add( "OPT__RECORD_LOAD_BALANCE",   &OPT__RECORD_LOAD_BALANCE,        true,            Useless_bool,  Useless_bool   );
+   ReadPara->Add( "OPT__LB_ALL_LEVEL",          &OPT__LB_ALL_LEVEL,               false,           Useless_bool,  Useless_bool   );
+   ReadPara->Add( "OPT__LB_INCREMENTAL",        &OPT__LB_INCREMENTAL,             0,               0,             NoMax_int      );
+   ReadPara->Add( "OPT__LB_INC_MAX_SHIFT",      &OPT__LB_INC_MAX_SHIFT,           0.1,             Eps_double,    0.5            );
+   ReadPara->Add( "OPT__LB_SPARSE_COMM",        &OPT__LB_SPARSE_COMM,             true,            Useless_bool,  Useless_bool   );
 #  endif
    ReadPara->Add( "OPT__MINIMIZE_MPI_BARRIER",  &OPT__MINIMIZE_MPI_BARRIER,       true,            Useless_bool,  Useless_bool   );
 
 
 // source terms
    ReadPara->Add( "SRC_DELEPTONIZATION",        &SrcTerms.Deleptonization,        false,           Useless_bool,  Useless_bool   );
+   ReadPara->Add( "SRC_COOLING",                &SrcTerms.Cooling,                false,           Useless_bool,  Useless_bool   );
+#  if ( MODEL == HYDRO )
+   ReadPara->Add( "SRC_COOLING_TABLE",           SRC_COOLING_TABLE,               Useless_str,     Useless_str,   Useless_str    );
+   ReadPara->Add( "SRC_COOLING_REDSHIFT",       &SRC_COOLING_REDSHIFT,            0.0,             0.0,           NoMax_double   );
+   ReadPara->Add( "SRC_COOLING_METAL",          &SRC_COOLING_METAL,               0.0,             0.0,           1.0            );
+#  endif
    ReadPara->Add( "SRC_USER",                   &SrcTerms.User,                   false,           Useless_bool,  Useless_bool   );
+   ReadPara->Add( "SRC_FUSE_FLUID",             &SRC_FUSE_FLUID,                  false,           Useless_bool,  Useless_bool   );
    ReadPara->Add( "SRC_GPU_NPGROUP",            &SRC_GPU_NPGROUP,                -1,               NoMin_int,     NoMax_int      );
 
 
@@ -227,6 +240,20 @@ void Init_Load_Parameter()
    ReadPara->Add( "ISO_TEMP",                   &ISO_TEMP,                       -1.0,             Eps_double,    NoMax_double   );
 #  else
    ReadPara->Add( "ISO_TEMP",                   &ISO_TEMP,                       __DBL_MAX__,      NoMin_double,  NoMax_double   );
+#  endif
+// do not check the parameters of EoS table here --> do it in EoS_LoadTable_Tabular()
+#  if ( EOS == EOS_TABULAR )
+   ReadPara->Add( "EOS_TAB_NAME",                EOS_TAB_NAME,                    Useless_str,     Useless_str,   Useless_str    );
+   ReadPara->Add( "EOS_TAB_NDENS",              &EOS_TAB_NDENS,                  -1,               NoMin_int,     NoMax_int      );
+   ReadPara->Add( "EOS_TAB_NSEINT",             &EOS_TAB_NSEINT,                 -1,               NoMin_int,     NoMax_int      );
+   ReadPara->Add( "EOS_TAB_NYE",                &EOS_TAB_NYE,                     1,               NoMin_int,     NoMax_int      );
+   ReadPara->Add( "EOS_TAB_NPRES",              &EOS_TAB_NPRES,                  -1,               NoMin_int,     NoMax_int      );
+   ReadPara->Add( "EOS_TAB_LOGDENS_MIN",        &EOS_TAB_LOGDENS_MIN,             NoDef_double,    NoMin_double,  NoMax_double   );
+   ReadPara->Add( "EOS_TAB_LOGDENS_MAX",        &EOS_TAB_LOGDENS_MAX,             NoDef_double,    NoMin_double,  NoMax_double   );
+   ReadPara->Add( "EOS_TAB_LOGSEINT_MIN",       &EOS_TAB_LOGSEINT_MIN,            NoDef_double,    NoMin_double,  NoMax_double   );
+   ReadPara->Add( "EOS_TAB_LOGSEINT_MAX",       &EOS_TAB_LOGSEINT_MAX,            NoDef_double,    NoMin_double,  NoMax_double   );
+   ReadPara->Add( "EOS_TAB_YE_MIN",             &EOS_TAB_YE_MIN,                  0.0,             NoMin_double,  NoMax_double   );
+   ReadPara->Add( "EOS_TAB_YE_MAX",             &EOS_TAB_YE_MAX,                  1.0,             NoMin_double,  NoMax_double   );
 #  endif
    ReadPara->Add( "MINMOD_COEFF",               &MINMOD_COEFF,                    1.5,             1.0,           2.0            );
    ReadPara->Add( "OPT__LR_LIMITER",            &OPT__LR_LIMITER,                 VL_GMINMOD,      0,             5              );
@@ -236,6 +263,8 @@ void Init_Load_Parameter()
 #  else
    ReadPara->Add( "OPT__1ST_FLUX_CORR_SCHEME",  &OPT__1ST_FLUX_CORR_SCHEME,   RSOLVER_1ST_DEFAULT, NoMin_int,     3              );
 #  endif
+   ReadPara->Add( "OPT__FLU_SUPER_BLOCK",       &OPT__FLU_SUPER_BLOCK,            false,           Useless_bool,  Useless_bool   );
+   ReadPara->Add( "OPT__FLU_SLAB",              &OPT__FLU_SLAB,                   0,               0,             NoMax_int      );
 #  ifdef DUAL_ENERGY
    ReadPara->Add( "DUAL_ENERGY_SWITCH",         &DUAL_ENERGY_SWITCH,              2.0e-2,          0.0,           NoMax_double   );
 #  endif
@@ -412,6 +441,10 @@ void Init_Load_Parameter()
    ReadPara->Add( "OPT__TIMING_BARRIER",        &OPT__TIMING_BARRIER,            -1,               NoMin_int,     NoMax_int      );
    ReadPara->Add( "OPT__TIMING_BALANCE",        &OPT__TIMING_BALANCE,             false,           Useless_bool,  Useless_bool   );
    ReadPara->Add( "OPT__TIMING_MPI",            &OPT__TIMING_MPI,                 false,           Useless_bool,  Useless_bool   );
+   ReadPara->Add( "OPT__TIMING_TRACE",          &OPT__TIMING_TRACE,               false,           Useless_bool,  Useless_bool   );
+   ReadPara->Add( "OPT__TIMING_TRACE_NEVENT",   &OPT__TIMING_TRACE_NEVENT,        65536,           1,             NoMax_int      );
+   ReadPara->Add( "OPT__TIMING_PERF",           &OPT__TIMING_PERF,                false,           Useless_bool,  Useless_bool   );
+   ReadPara->Add( "OPT__TIMING_PERF_RAW",       &OPT__TIMING_PERF_RAW,            0L,              0L,            NoMax_long     );
    ReadPara->Add( "OPT__RECORD_NOTE",           &OPT__RECORD_NOTE,                true,            Useless_bool,  Useless_bool   );
    ReadPara->Add( "OPT__RECORD_UNPHY",          &OPT__RECORD_UNPHY,               true,            Useless_bool,  Useless_bool   );
    ReadPara->Add( "OPT__RECORD_MEMORY",         &OPT__RECORD_MEMORY,              true,            Useless_bool,  Useless_bool   );
@@ -47,9 +47,11 @@ void Init_MemAllocate_Fluid( const int Flu_NPatchGroup, const int Pot_NPatchGrou
 #     ifdef UNSPLIT_GRAVITY
       h_Pot_Array_USG_F[t] = new real [Flu_NPatchGroup][ CUBE(USG_NXT_F) ];
 
-      if ( OPT__EXT_ACC )
-      h_Corner_Array_F [t] = new double [Flu_NPatchGroup][3];
+      if ( OPT__EXT_ACC  ||  SRC_FUSE_FLUID )
+#     else
+      if ( SRC_FUSE_FLUID )
 #     endif
+      h_Corner_Array_F [t] = new double [Flu_NPatchGroup][3];
 
       h_dt_Array_T     [t] = new real [dt_NPatch];
       h_Flu_Array_T    [t] = new real [Flu_NPatch][FLU_NIN_T][ CUBE(PS1) ];
@@ -68,7 +70,7 @@ void Init_MemAllocate_Fluid( const int Flu_NPatchGroup, const int Pot_NPatchGrou
       h_Mag_Array_T    [t] = new real [Flu_NPatch][NCOMP_MAG][ PS1P1*SQR(PS1) ];
 #     endif
 
-      if ( SrcTerms.Any ) {
+      if ( SrcTerms.Any  &&  !SRC_FUSE_FLUID ) {
       h_Flu_Array_S_In [t] = new real [Src_NPatch][FLU_NIN_S ][ CUBE(SRC_NXT)           ];
       h_Flu_Array_S_Out[t] = new real [Src_NPatch][FLU_NOUT_S][ CUBE(PS1)               ];
 #     ifdef MHD
@@ -104,6 +106,10 @@ void Init_MemAllocate_Fluid( const int Flu_NPatchGroup, const int Pot_NPatchGrou
    }
 #  endif
 
+#  ifdef SUPPORT_FLU_SUPER_BLOCK
+   if ( OPT__FLU_SUPER_BLOCK )   Flu_SuperBlock_MemAllocate( Flu_NPatchGroup );
+#  endif
+
 } // FUNCTION : Init_MemAllocate_Fluid
 
 
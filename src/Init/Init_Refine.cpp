@@ -19,7 +19,6 @@ void Init_Refine( const int lv )
 
    const int Width = PATCH_SIZE*amr->scale[lv+1];
    bool AllocData[8];         // allocate data or not
-   int *Cr;
 
    for (int m=0; m<27; m++)
    {
@@ -43,37 +42,50 @@ void Init_Refine( const int lv )
       }
 
 
+//    construct relation : father -> child
+//    --> son indices are determined in advance by a prefix sum so that child patches can be allocated in parallel
+      int NSon = 0;
+
       for (int PID=amr->NPatchComma[lv][m]; PID<amr->NPatchComma[lv][m+1]; PID++)
       {
          if ( amr->patch[0][lv][PID]->flag )
          {
-//          construct relation : father -> child
-            amr->patch[0][lv][PID]->son = amr->num[lv+1];
-
-
-//          allocate child patches and construct relation : child -> father
-            Cr = amr->patch[0][lv][PID]->corner;
+            amr->patch[0][lv][PID]->son = amr->num[lv+1] + NSon;
+            NSon += 8;
+         }
+      }
 
-            amr->pnew( lv+1, Cr[0],       Cr[1],       Cr[2],       PID, AllocData[0], AllocData[0], AllocData[0] );
-            amr->pnew( lv+1, Cr[0]+Width, Cr[1],       Cr[2],       PID, AllocData[1], AllocData[1], AllocData[1] );
-            amr->pnew( lv+1, Cr[0],       Cr[1]+Width, Cr[2],       PID, AllocData[2], AllocData[2], AllocData[2] );
-            amr->pnew( lv+1, Cr[0],       Cr[1],       Cr[2]+Width, PID, AllocData[3], AllocData[3], AllocData[3] );
-            amr->pnew( lv+1, Cr[0]+Width, Cr[1]+Width, Cr[2],       PID, AllocData[4], AllocData[4], AllocData[4] );
-            amr->pnew( lv+1, Cr[0],       Cr[1]+Width, Cr[2]+Width, PID, AllocData[5], AllocData[5], AllocData[5] );
-            amr->pnew( lv+1, Cr[0]+Width, Cr[1],       Cr[2]+Width, PID, AllocData[6], AllocData[6], AllocData[6] );
-            amr->pnew( lv+1, Cr[0]+Width, Cr[1]+Width, Cr[2]+Width, PID, AllocData[7], AllocData[7], AllocData[7] );
+      if ( amr->num[lv+1]+NSon > MAX_PATCH )
+         Aux_Error( ERROR_INFO, "exceed MAX_PATCH (%d) => please reset it in the Makefile !!\n", MAX_PATCH );
 
+//    allocate child patches and construct relation : child -> father
+#     pragma omp parallel for schedule( runtime )
+      for (int PID=amr->NPatchComma[lv][m]; PID<amr->NPatchComma[lv][m+1]; PID++)
+      {
+         if ( amr->patch[0][lv][PID]->flag )
+         {
+            const int *Cr      = amr->patch[0][lv][PID]->corner;
+            const int  SonPID0 = amr->patch[0][lv][PID]->son;
+
+            for (int LocalID=0; LocalID<8; LocalID++)
+               amr->pnew_PID( lv+1, SonPID0+LocalID, Cr[0]+TABLE_02( LocalID, 'x', 0, Width ),
+                                                     Cr[1]+TABLE_02( LocalID, 'y', 0, Width ),
+                                                     Cr[2]+TABLE_02( LocalID, 'z', 0, Width ),
+                              PID, AllocData[LocalID], AllocData[LocalID], AllocData[LocalID] );
+         }
+      }
 
-//          record the number of real/buffer patches along each sibling direction
-            amr->NPatchComma[lv+1][m+1] += 8;
+      amr->num[lv+1] += NSon;
 
+//    record the number of real/buffer patches along each sibling direction
+      amr->NPatchComma[lv+1][m+1] += NSon;
 
-//          pass particles from father to son
-#           ifdef PARTICLE
-            Par_PassParticle2Son_SinglePatch( lv, PID );
-#           endif
-         } // if ( amr->patch[0][lv][PID]->flag )
-      } // for (int PID=amr->NPatchComma[lv][s+1]; PID<amr->NPatchComma[lv][s+2]; PID++)
+//    pass particles from father to son
+//    --> must be done after allocating all son patches since it is not thread-safe
+#     ifdef PARTICLE
+      for (int PID=amr->NPatchComma[lv][m]; PID<amr->NPatchComma[lv][m+1]; PID++)
+         if ( amr->patch[0][lv][PID]->flag )    Par_PassParticle2Son_SinglePatch( lv, PID );
+#     endif
 
       for (int n=m+2; n<28; n++)    amr->NPatchComma[lv+1][n] = amr->num[lv+1];
 
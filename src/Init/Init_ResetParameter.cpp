@@ -728,6 +728,20 @@ void Init_ResetParameter()
 
       PRINT_WARNING( OPT__TIMING_MPI, FORMAT_INT, "since TIMING is disabled" );
    }
+
+   if ( OPT__TIMING_TRACE )
+   {
+      OPT__TIMING_TRACE = false;
+
+      PRINT_WARNING( OPT__TIMING_TRACE, FORMAT_INT, "since TIMING is disabled" );
+   }
+
+   if ( OPT__TIMING_PERF )
+   {
+      OPT__TIMING_PERF = false;
+
+      PRINT_WARNING( OPT__TIMING_PERF, FORMAT_INT, "since TIMING is disabled" );
+   }
 #  endif // #ifndef TIMING
 
 
@@ -829,6 +843,100 @@ void Init_ResetParameter()
    }
 
 
+// AUTO_REDUCE_DT_LOCAL requires AUTO_REDUCE_DT and the coarse-fine fluxes stored by OPT__FIXUP_FLUX
+// --> it also requires a hydro scheme that does not modify the input array (i.e., not RTVD) and does not support MHD yet
+   if ( AUTO_REDUCE_DT_LOCAL )
+   {
+#     if ( MODEL != HYDRO  ||  FLU_SCHEME == RTVD  ||  defined MHD )
+      AUTO_REDUCE_DT_LOCAL = false;
+
+      PRINT_WARNING( AUTO_REDUCE_DT_LOCAL, FORMAT_INT, "since it only supports HYDRO with MHM/MHM_RP/CTU and without MHD" );
+#     endif
+
+      if ( AUTO_REDUCE_DT_LOCAL  &&  !AUTO_REDUCE_DT )
+      {
+         AUTO_REDUCE_DT_LOCAL = false;
+
+         PRINT_WARNING( AUTO_REDUCE_DT_LOCAL, FORMAT_INT, "since AUTO_REDUCE_DT is disabled" );
+      }
+
+      if ( AUTO_REDUCE_DT_LOCAL  &&  !OPT__FIXUP_FLUX )
+      {
+         AUTO_REDUCE_DT_LOCAL = false;
+
+         PRINT_WARNING( AUTO_REDUCE_DT_LOCAL, FORMAT_INT, "since OPT__FIXUP_FLUX is disabled" );
+      }
+   }
+
+
+// OPT__FLU_SUPER_BLOCK is only supported by the CPU MHM/MHM_RP/CTU schemes without MHD
+// --> it also does not work with OPT__OVERLAP_MPI and requires FLU_GPU_NPGROUP >= 8
+#  if ( MODEL == HYDRO )
+   if ( OPT__FLU_SUPER_BLOCK )
+   {
+#     ifndef SUPPORT_FLU_SUPER_BLOCK
+      OPT__FLU_SUPER_BLOCK = false;
+
+      PRINT_WARNING( OPT__FLU_SUPER_BLOCK, FORMAT_INT, "since it only supports the CPU MHM/MHM_RP/CTU schemes without MHD" );
+#     endif
+
+      if ( OPT__FLU_SUPER_BLOCK  &&  OPT__OVERLAP_MPI )
+      {
+         OPT__FLU_SUPER_BLOCK = false;
+
+         PRINT_WARNING( OPT__FLU_SUPER_BLOCK, FORMAT_INT, "since OPT__OVERLAP_MPI is enabled" );
+      }
+
+      if ( OPT__FLU_SUPER_BLOCK  &&  FLU_GPU_NPGROUP < 8 )
+      {
+         OPT__FLU_SUPER_BLOCK = false;
+
+         PRINT_WARNING( OPT__FLU_SUPER_BLOCK, FORMAT_INT, "since FLU_GPU_NPGROUP < 8" );
+      }
+   }
+#  endif
+
+
+// OPT__FLU_SLAB is only supported by the CPU MHM/MHM_RP schemes without MHD
+#  if ( MODEL == HYDRO )
+#  if (  defined GPU  ||  defined MHD  ||  ( FLU_SCHEME != MHM && FLU_SCHEME != MHM_RP )  )
+   if ( OPT__FLU_SLAB > 0 )
+   {
+      OPT__FLU_SLAB = 0;
+
+      PRINT_WARNING( OPT__FLU_SLAB, FORMAT_INT, "since it only supports the CPU MHM/MHM_RP schemes without MHD" );
+   }
+#  endif
+#  endif
+
+
+// OPT__SINGLE_SANDGLASS does not work with the options requiring the old-time fluid data after the fluid solver
+// --> AUTO_REDUCE_DT (to redo the fluid solver), OPT__OVERLAP_MPI (to advance the patches in two separate passes),
+//     and UNSPLIT_GRAVITY (to prepare the old-time density and momentum for the gravity solver)
+   if ( OPT__SINGLE_SANDGLASS )
+   {
+#     ifdef UNSPLIT_GRAVITY
+      OPT__SINGLE_SANDGLASS = false;
+
+      PRINT_WARNING( OPT__SINGLE_SANDGLASS, FORMAT_INT, "since UNSPLIT_GRAVITY is enabled" );
+#     endif
+
+      if ( OPT__SINGLE_SANDGLASS  &&  AUTO_REDUCE_DT )
+      {
+         OPT__SINGLE_SANDGLASS = false;
+
+         PRINT_WARNING( OPT__SINGLE_SANDGLASS, FORMAT_INT, "since AUTO_REDUCE_DT is enabled" );
+      }
+
+      if ( OPT__SINGLE_SANDGLASS  &&  OPT__OVERLAP_MPI )
+      {
+         OPT__SINGLE_SANDGLASS = false;
+
+         PRINT_WARNING( OPT__SINGLE_SANDGLASS, FORMAT_INT, "since OPT__OVERLAP_MPI is enabled" );
+      }
+   }
+
+
 // FLAG_BUFFER_SIZE at the level MAX_LEVEL-1 and MAX_LEVEL-2
    if ( FLAG_BUFFER_SIZE_MAXM1_LV < 0 )
    {
@@ -1,5 +1,7 @@
 #include "GAMER.h"
 
+static void PG2Corner( const long PG, const int NPG_EachDim[], const int scale, int Cr[] );
+
 
 
 
@@ -28,21 +30,18 @@
 void Init_UniformGrid( const int lv, const bool FindHomePatchForPar )
 {
 
-   const int NPG_EachDim[3] = { (NX0_TOT[0]/PS2)*(1<<lv), (NX0_TOT[1]/PS2)*(1<<lv), (NX0_TOT[2]/PS2)*(1<<lv) };
-   const int scale          = amr->scale[lv];
-
-   int Cr[3];
+   const int  NPG_EachDim[3] = { (NX0_TOT[0]/PS2)*(1<<lv), (NX0_TOT[1]/PS2)*(1<<lv), (NX0_TOT[2]/PS2)*(1<<lv) };
+   const int  scale          = amr->scale[lv];
+   const long NPG_Total      = (long)NPG_EachDim[0]*(long)NPG_EachDim[1]*(long)NPG_EachDim[2];
 
 
 // 1. set up the load-balance cut points amr->LB->CutPoint[] on lv
 #  ifdef LOAD_BALANCE
    const bool   InputLBIdx0AndLoad_Yes = true;
    const double ParWeight_Zero         = 0.0;
-   const long   NPG_Total              = (long)NPG_EachDim[0]*(long)NPG_EachDim[1]*(long)NPG_EachDim[2];
 
    long   *LBIdx0_AllRank = NULL;
    double *Load_AllRank   = NULL;
-   int     counter;
 
 // 1.1 prepare LBIdx and load-balance weighting of each **patch group** for LB_SetCutPoint()
    if ( MPI_Rank == 0 )
@@ -50,18 +49,16 @@ void Init_UniformGrid( const int lv, const bool FindHomePatchForPar )
       LBIdx0_AllRank = new long   [NPG_Total];
       Load_AllRank   = new double [NPG_Total];
 
-      counter = 0;
-
-      for (int k=0; k<NPG_EachDim[2]; k++)   {  Cr[2] = k*PS2*scale;
-      for (int j=0; j<NPG_EachDim[1]; j++)   {  Cr[1] = j*PS2*scale;
-      for (int i=0; i<NPG_EachDim[0]; i++)   {  Cr[0] = i*PS2*scale;
-
-         LBIdx0_AllRank[counter]  = LB_Corner2Index( lv, Cr, CHECK_ON );
-         LBIdx0_AllRank[counter] -= LBIdx0_AllRank[counter] % 8;  // get the minimum LBIdx in each patch group
-         Load_AllRank  [counter]  = 8.0;                          // assuming all patches have the same weighting == 1.0
+#     pragma omp parallel for schedule( static )
+      for (long PG=0; PG<NPG_Total; PG++)
+      {
+         int Cr[3];
+         PG2Corner( PG, NPG_EachDim, scale, Cr );
 
-         counter ++;
-      }}}
+         LBIdx0_AllRank[PG]  = LB_Corner2Index( lv, Cr, CHECK_ON );
+         LBIdx0_AllRank[PG] -= LBIdx0_AllRank[PG] % 8;   // get the minimum LBIdx in each patch group
+         Load_AllRank  [PG]  = 8.0;                      // assuming all patches have the same weighting == 1.0
+      }
    }
 
 // 1.2 set CutPoint[]
@@ -81,26 +78,50 @@ void Init_UniformGrid( const int lv, const bool FindHomePatchForPar )
 // 2. allocate real patches on lv
    const int PScale = PS1*scale;
 
-   for (int k=0; k<NPG_EachDim[2]; k++)   {  Cr[2] = k*PS2*scale;
-   for (int j=0; j<NPG_EachDim[1]; j++)   {  Cr[1] = j*PS2*scale;
-   for (int i=0; i<NPG_EachDim[0]; i++)   {  Cr[0] = i*PS2*scale;
+// 2.1 find the patch groups at home
+   long *HomePG   = new long [NPG_Total];
+   long  NPG_Home = 0;
+
+#  ifdef LOAD_BALANCE
+#  pragma omp parallel for schedule( static )
+   for (long PG=0; PG<NPG_Total; PG++)
+   {
+      int Cr[3];
+      PG2Corner( PG, NPG_EachDim, scale, Cr );
 
-#     ifdef LOAD_BALANCE
       const long LBIdx0 = LB_Corner2Index( lv, Cr, CHECK_ON );
-      if (  LB_Index2Rank( lv, LBIdx0, CHECK_ON ) == MPI_Rank  )
-#     endif
-      {
-         amr->pnew( lv, Cr[0],        Cr[1],        Cr[2],        -1, true, true, true );
-         amr->pnew( lv, Cr[0]+PScale, Cr[1],        Cr[2],        -1, true, true, true );
-         amr->pnew( lv, Cr[0],        Cr[1]+PScale, Cr[2],        -1, true, true, true );
-         amr->pnew( lv, Cr[0],        Cr[1],        Cr[2]+PScale, -1, true, true, true );
-         amr->pnew( lv, Cr[0]+PScale, Cr[1]+PScale, Cr[2],        -1, true, true, true );
-         amr->pnew( lv, Cr[0],        Cr[1]+PScale, Cr[2]+PScale, -1, true, true, true );
-         amr->pnew( lv, Cr[0]+PScale, Cr[1],        Cr[2]+PScale, -1, true, true, true );
-         amr->pnew( lv, Cr[0]+PScale, Cr[1]+PScale, Cr[2]+PScale, -1, true, true, true );
-      }
+      HomePG[PG] = (  LB_Index2Rank( lv, LBIdx0, CHECK_ON ) == MPI_Rank  ) ? PG : -1;
+   }
+
+   for (long PG=0; PG<NPG_Total; PG++)
+      if ( HomePG[PG] != -1 )    HomePG[ NPG_Home ++ ] = HomePG[PG];
+
+#  else
+   for (long PG=0; PG<NPG_Total; PG++)    HomePG[ NPG_Home ++ ] = PG;
+#  endif
+
+   if ( amr->num[lv]+8*NPG_Home > MAX_PATCH )
+      Aux_Error( ERROR_INFO, "exceed MAX_PATCH (%d) => please reset it in the Makefile !!\n", MAX_PATCH );
 
-   }}}
+// 2.2 allocate patches in parallel
+// --> patch IDs follow the order of patch groups in HomePG[], which is the same as the serial version
+#  pragma omp parallel for schedule( static )
+   for (long t=0; t<NPG_Home; t++)
+   {
+      const int PID0 = amr->num[lv] + 8*t;
+      int Cr[3];
+      PG2Corner( HomePG[t], NPG_EachDim, scale, Cr );
+
+      for (int LocalID=0; LocalID<8; LocalID++)
+         amr->pnew_PID( lv, PID0+LocalID, Cr[0]+TABLE_02( LocalID, 'x', 0, PScale ),
+                                          Cr[1]+TABLE_02( LocalID, 'y', 0, PScale ),
+                                          Cr[2]+TABLE_02( LocalID, 'z', 0, PScale ),
+                        -1, true, true, true );
+   }
+
+   amr->num[lv] += 8*NPG_Home;
+
+   delete [] HomePG;
 
    for (int m=1; m<28; m++)   amr->NPatchComma[lv][m] = amr->num[lv];
 
@@ -115,3 +136,29 @@ void Init_UniformGrid( const int lv, const bool FindHomePatchForPar )
 #  endif
 
 } // FUNCTION : Init_UniformGrid
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  PG2Corner
+// Description :  Convert the 1D index of a patch group to the corner scale indices of its first patch
+//
+// Note        :  1. Patch groups are ordered as x -> y -> z
+//
+// Parameter   :  PG          : 1D index of the target patch group
+//                NPG_EachDim : Number of patch groups along each direction
+//                scale       : Grid scale of the target level (amr->scale[lv])
+//                Cr          : Corner scale indices to be returned
+//
+// Return      :  Cr[]
+//-------------------------------------------------------------------------------------------------------
+void PG2Corner( const long PG, const int NPG_EachDim[], const int scale, int Cr[] )
+{
+
+   const long NPG_XY = (long)NPG_EachDim[0]*(long)NPG_EachDim[1];
+
+   Cr[0] = (int)( PG%NPG_EachDim[0]        )*PS2*scale;
+   Cr[1] = (int)( PG%NPG_XY/NPG_EachDim[0] )*PS2*scale;
+   Cr[2] = (int)( PG/NPG_XY                )*PS2*scale;
+
+} // FUNCTION : PG2Corner
@@ -19,7 +19,10 @@
 //                       children patches
 //                       --> WLI estimated here will be different from both Record__PatchCount and
 //                           Record__ParticleCount. The latter only considers particles in the leaf patches
-//                4. Invoked by main() to determine whether we should redistribute all patches
+//                4. With OPT__LB_ALL_LEVEL, Load_Max is estimated as the maximum workload summed over all levels
+//                   in all ranks since LB_SetCutPoint_AllLevel() only balances the total workload of each rank
+//                   --> Otherwise WLI would exceed WLI_Max right after redistribution
+//                5. Invoked by main() to determine whether we should redistribute all patches
 //                   (by calling LB_Init_LoadBalance()) to improve the load balance
 //
 // Return      :  amr->LB->WLI
@@ -92,6 +95,19 @@ double LB_EstimateLoadImbalance()
          Load_Ave_AllLv += Load_Ave[lv];
       }
 
+      if ( OPT__LB_ALL_LEVEL )
+      {
+         Load_Max_AllLv = 0.0;
+
+         for (int r=0; r<MPI_NRank; r++)
+         {
+            double Load_ThisRank_AllLv = 0.0;
+            for (int lv=0; lv<NLEVEL; lv++)  Load_ThisRank_AllLv += Load_AllRank[r][lv];
+
+            Load_Max_AllLv = MAX( Load_Max_AllLv, Load_ThisRank_AllLv );
+         }
+      }
+
       amr->LB->WLI = ( Load_Max_AllLv - Load_Ave_AllLv ) / Load_Ave_AllLv;
 
 
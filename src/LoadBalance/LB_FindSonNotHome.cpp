@@ -52,8 +52,6 @@ void LB_FindSonNotHome( const int FaLv, const bool SearchAllFa, const int NInput
    const int  NFaPatch  = amr->num[FaLv];    // real + buffer patches
    const int  NTargetFa = ( SearchAllFa ) ? NFaPatch : NInput;
 
-   int FaPID;
-
 
 // 0. construct the target father patch list
 // ==========================================================================================
@@ -67,11 +65,9 @@ void LB_FindSonNotHome( const int FaLv, const bool SearchAllFa, const int NInput
 
 // 1 construct the query list for different ranks
 // ==========================================================================================
-   int   TRank, MemUnit_Query[MPI_NRank], MemSize_Query[MPI_NRank], NQuery[MPI_NRank];
-   int  *Cr, *FaPID_List[MPI_NRank], *FaPID_IdxTable[MPI_NRank];
-   long  LB_Idx;
+   int   MemUnit_Query[MPI_NRank], MemSize_Query[MPI_NRank], NQuery[MPI_NRank];
+   int  *FaPID_List[MPI_NRank], *FaPID_IdxTable[MPI_NRank];
    long *Query_Temp[MPI_NRank];
-   bool  Internal;
 
 // 1.1 set memory allocation unit
    for (int r=0; r<MPI_NRank; r++)
@@ -83,14 +79,22 @@ void LB_FindSonNotHome( const int FaLv, const bool SearchAllFa, const int NInput
       NQuery       [r] = 0;
    }
 
-// 1.2 construct the unsorted query list for different ranks
+// 1.2 get the son LB_Idx and target rank of all target father patches in parallel
+// --> TRank_List[t] = -1 : no query is required
+   int  *TRank_List = new int  [NTargetFa];
+   long *LBIdx_List = new long [NTargetFa];
+
+#  pragma omp parallel for schedule( runtime )
    for (int t=0; t<NTargetFa; t++)
    {
-      FaPID = TargetFaPID[t];
+      const int FaPID = TargetFaPID[t];
+
+      TRank_List[t] = -1;
 
       if ( amr->patch[0][FaLv][FaPID]->son <= -1 )
       {
-         Cr = amr->patch[0][FaLv][FaPID]->corner;
+         const int *Cr = amr->patch[0][FaLv][FaPID]->corner;
+         long LB_Idx;
 
 //###NOTE: faster version can only be applied to the Hilbert space-filling curve
 #        if ( LOAD_BALANCE == HILBERT )
@@ -107,8 +111,8 @@ void LB_FindSonNotHome( const int FaLv, const bool SearchAllFa, const int NInput
          }
 
 //       ignore internal patches in the same rank
-         TRank    = LB_Index2Rank( SonLv, LB_Idx, CHECK_ON );
-         Internal = true;
+         const int TRank    = LB_Index2Rank( SonLv, LB_Idx, CHECK_ON );
+         bool      Internal = true;
 
          for (int d=0; d<3; d++)
          {
@@ -136,30 +140,41 @@ void LB_FindSonNotHome( const int FaLv, const bool SearchAllFa, const int NInput
             continue;
          }
 
-//       allocate enough memory
-         if ( NQuery[TRank] >= MemSize_Query[TRank] )
-         {
-            MemSize_Query[TRank] += MemUnit_Query[TRank];
-            Query_Temp   [TRank]  = (long*)realloc( Query_Temp[TRank], MemSize_Query[TRank]*sizeof(long) );
-            FaPID_List   [TRank]  = (int* )realloc( FaPID_List[TRank], MemSize_Query[TRank]*sizeof(int ) );
-         }
-
-//       record list
-         Query_Temp[TRank][ NQuery[TRank] ] = LB_Idx;
-         FaPID_List[TRank][ NQuery[TRank] ] = FaPID;
-         NQuery    [TRank] ++;
-
+         TRank_List[t] = TRank;
+         LBIdx_List[t] = LB_Idx;
       } // if ( amr->patch[0][FaLv][FaPID]->son <= -1 )
    } // for (int t=0; t<NTargetFa; t++)
 
-// 1.3 sort the query list for different ranks
-   for (int r=0; r<MPI_NRank; r++)
+// 1.3 construct the unsorted query list for different ranks
+   for (int t=0; t<NTargetFa; t++)
    {
-      FaPID_IdxTable[r] = new int [ NQuery[r] ];
+      const int TRank = TRank_List[t];
+
+      if ( TRank == -1 )   continue;
+
+//    allocate enough memory
+      if ( NQuery[TRank] >= MemSize_Query[TRank] )
+      {
+         MemSize_Query[TRank] += MemUnit_Query[TRank];
+         Query_Temp   [TRank]  = (long*)realloc( Query_Temp[TRank], MemSize_Query[TRank]*sizeof(long) );
+         FaPID_List   [TRank]  = (int* )realloc( FaPID_List[TRank], MemSize_Query[TRank]*sizeof(int ) );
+      }
 
-      Mis_Heapsort( NQuery[r], Query_Temp[r], FaPID_IdxTable[r] );
+//    record list
+      Query_Temp[TRank][ NQuery[TRank] ] = LBIdx_List[t];
+      FaPID_List[TRank][ NQuery[TRank] ] = TargetFaPID[t];
+      NQuery    [TRank] ++;
    }
 
+   delete [] TRank_List;
+   delete [] LBIdx_List;
+
+// 1.4 sort the query list for different ranks
+   for (int r=0; r<MPI_NRank; r++)  FaPID_IdxTable[r] = new int [ NQuery[r] ];
+
+#  pragma omp parallel for schedule( dynamic )
+   for (int r=0; r<MPI_NRank; r++)  Mis_Heapsort( NQuery[r], Query_Temp[r], FaPID_IdxTable[r] );
+
 
 // 2 transfer data : (SendBuf_Query --> RecvBuf_Query --> SendBuf_Reply --> RecvBuf_Reply)
 // ==========================================================================================
@@ -196,6 +211,7 @@ void LB_FindSonNotHome( const int FaLv, const bool SearchAllFa, const int NInput
                   RecvBuf_Query, NReply, Reply_Disp, MPI_LONG, MPI_COMM_WORLD );
 
 // 2.4 prepare replies
+#  pragma omp parallel for schedule( dynamic )
    for (int r=0; r<MPI_NRank; r++)
       Mis_Matching_char( amr->NPatchComma[SonLv][1], amr->LB->IdxList_Real[SonLv], NReply[r],
                          RecvBuf_Query+Reply_Disp[r], SendBuf_Reply+Reply_Disp[r] );
@@ -207,46 +223,47 @@ void LB_FindSonNotHome( const int FaLv, const bool SearchAllFa, const int NInput
 
 // 3 set SonPID to "SON_OFFSET_LB-SonRank"
 // ==========================================================================================
-   Counter=0;
-
    for (int r=0; r<MPI_NRank; r++)
-   for (int t=0; t<NQuery[r]; t++)
    {
-      FaPID = FaPID_List[r][ FaPID_IdxTable[r][t] ];
-
-      if ( RecvBuf_Reply[ Counter ++ ] == 1 )
+#     pragma omp parallel for schedule( runtime )
+      for (int t=0; t<NQuery[r]; t++)
       {
-         amr->patch[0][FaLv][FaPID]->son = SON_OFFSET_LB - r;
-
-//       check : only external buffer patches can have sons at home but with son indices < -1
-#        ifdef GAMER_DEBUG
-         Cr = amr->patch[0][FaLv][FaPID]->corner;
+         const int FaPID = FaPID_List[r][ FaPID_IdxTable[r][t] ];
 
-         Internal = true;
-         for (int d=0; d<3; d++)
+         if ( RecvBuf_Reply[ Query_Disp[r] + t ] == 1 )
          {
-            if ( Cr[d] < 0  ||  Cr[d] >= amr->BoxScale[d] )
+            amr->patch[0][FaLv][FaPID]->son = SON_OFFSET_LB - r;
+
+//          check : only external buffer patches can have sons at home but with son indices < -1
+#           ifdef GAMER_DEBUG
+            const int *Cr = amr->patch[0][FaLv][FaPID]->corner;
+
+            bool Internal = true;
+            for (int d=0; d<3; d++)
             {
-               Internal = false;
-               break;
+               if ( Cr[d] < 0  ||  Cr[d] >= amr->BoxScale[d] )
+               {
+                  Internal = false;
+                  break;
+               }
             }
-         }
 
-         if ( Internal  &&  r == MPI_Rank )
-            Aux_Error( ERROR_INFO, "FaLv %d, FaPID %d's son should be home !!\n", FaLv, FaPID );
-#        endif
-      } // if ( RecvBuf_Reply[ Counter ++ ] == 1 )
+            if ( Internal  &&  r == MPI_Rank )
+               Aux_Error( ERROR_INFO, "FaLv %d, FaPID %d's son should be home !!\n", FaLv, FaPID );
+#           endif
+         } // if ( RecvBuf_Reply[ Query_Disp[r] + t ] == 1 )
 
-      else
-         amr->patch[0][FaLv][FaPID]->son = -1;
+         else
+            amr->patch[0][FaLv][FaPID]->son = -1;
 
-   } // for (int r=0; r<MPI_NRank; r++) ... for (int t=0; t<NQuery[r]; t++)
+      } // for (int t=0; t<NQuery[r]; t++)
+   } // for (int r=0; r<MPI_NRank; r++)
 
 
 // 4. check results in debug mode
 #  ifdef GAMER_DEBUG
    const int SonNReal = amr->NPatchComma[SonLv][1];
-   int SonPID, SonPID0;
+   int FaPID, SonPID, SonPID0;
 
 // check 1 : all real patches must have fathers
    for (SonPID=0; SonPID<SonNReal; SonPID++)
@@ -15,6 +15,25 @@ static int   RecvBufSize        = -1;
 extern Timer_t *Timer_MPI[3];
 #endif
 
+// persistent point-to-point requests for OPT__LB_SPARSE_COMM, one set for each level and GetBufMode
+const int NGetBufMode = 9;    // must be larger than the maximum value of GetBufMode_t
+
+struct SparseComm_t
+{
+   int          NReq;           // number of send and recv requests with non-zero data
+   MPI_Request *Req;            // persistent requests
+   real        *SendBuf;        // send buffer bound to Req
+   real        *RecvBuf;        // recv buffer bound to Req
+   int         *NCountDisp;     // Send_NCount, Send_NDisp, Recv_NCount, Recv_NDisp bound to Req
+};
+
+static SparseComm_t SparseComm[NLEVEL][NGetBufMode];
+
+static void LB_GetBufferData_SparseExchange( const int lv, const GetBufMode_t GetBufMode,
+                                             real *SendBuf, const int *Send_NCount, const int *Send_NDisp,
+                                             real *RecvBuf, const int *Recv_NCount, const int *Recv_NDisp );
+static void LB_GetBufferData_SparseFree( SparseComm_t *Comm );
+
 
 
 
@@ -68,6 +87,8 @@ void LB_GetBufferData( const int lv, const int FluSg, const int MagSg, const int
                        const long TVarCC, const long TVarFC, const int ParaBuf )
 {
 
+   TRACE_SCOPE( "LB_GetBufferData", lv );
+
    bool ExchangeFlu = ( GetBufMode == COARSE_FINE_FLUX ) ?
                       TVarCC & _FLUX_TOTAL : TVarCC & _TOTAL;  // whether or not to exchage the fluid data
 #  ifdef GRAVITY
@@ -990,8 +1011,8 @@ void LB_GetBufferData( const int lv, const int FluSg, const int MagSg, const int
                {
                   const int TFluVarIdx = TFluVarIdxList[v];
 
-                  memcpy( SendPtr, &amr->patch[FluSg][lv][SPID]->fluid[TFluVarIdx][0][0][0],
-                          PS1*PS1*PS1*sizeof(real) );
+                  Mis_CopyArray( SendPtr, &amr->patch[FluSg][lv][SPID]->fluid[TFluVarIdx][0][0][0],
+                                 PS1*PS1*PS1 );
 
                   SendPtr += CUBE( PS1 );
                }
@@ -1000,8 +1021,8 @@ void LB_GetBufferData( const int lv, const int FluSg, const int MagSg, const int
 #              ifdef GRAVITY
                if ( ExchangePot )
                {
-                  memcpy( SendPtr, &amr->patch[PotSg][lv][SPID]->pot[0][0][0],
-                          PS1*PS1*PS1*sizeof(real) );
+                  Mis_CopyArray( SendPtr, &amr->patch[PotSg][lv][SPID]->pot[0][0][0],
+                                 PS1*PS1*PS1 );
 
                   SendPtr += CUBE( PS1 );
                }
@@ -1014,8 +1035,8 @@ void LB_GetBufferData( const int lv, const int FluSg, const int MagSg, const int
                {
                   const int TMagVarIdx = TMagVarIdxList[v];
 
-                  memcpy( SendPtr, &amr->patch[MagSg][lv][SPID]->magnetic[TMagVarIdx][0],
-                          SQR(PS1)*PS1P1*sizeof(real) );
+                  Mis_CopyArray( SendPtr, &amr->patch[MagSg][lv][SPID]->magnetic[TMagVarIdx][0],
+                                 SQR(PS1)*PS1P1 );
 
                   SendPtr += SQR( PS1 )*PS1P1;
                }
@@ -1099,7 +1120,7 @@ void LB_GetBufferData( const int lv, const int FluSg, const int MagSg, const int
 
 
 
-// 4. transfer data by MPI_Alltoallv
+// 4. transfer data by persistent point-to-point requests (OPT__LB_SPARSE_COMM) or MPI_Alltoallv
 // ============================================================================================================
 #  ifdef TIMING
 // it's better to add barrier before timing transferring data through MPI
@@ -1111,13 +1132,20 @@ void LB_GetBufferData( const int lv, const int FluSg, const int MagSg, const int
    if ( OPT__TIMING_MPI )  Timer_MPI[1]->Start();
 #  endif
 
-#  ifdef FLOAT8
-   MPI_Alltoallv( SendBuf, Send_NCount, Send_NDisp, MPI_DOUBLE,
-                  RecvBuf, Recv_NCount, Recv_NDisp, MPI_DOUBLE, MPI_COMM_WORLD );
-#  else
-   MPI_Alltoallv( SendBuf, Send_NCount, Send_NDisp, MPI_FLOAT,
-                  RecvBuf, Recv_NCount, Recv_NDisp, MPI_FLOAT,  MPI_COMM_WORLD );
-#  endif
+   if ( OPT__LB_SPARSE_COMM )
+      LB_GetBufferData_SparseExchange( lv, GetBufMode, SendBuf, Send_NCount, Send_NDisp,
+                                       RecvBuf, Recv_NCount, Recv_NDisp );
+
+   else
+   {
+#     ifdef FLOAT8
+      MPI_Alltoallv( SendBuf, Send_NCount, Send_NDisp, MPI_DOUBLE,
+                     RecvBuf, Recv_NCount, Recv_NDisp, MPI_DOUBLE, MPI_COMM_WORLD );
+#     else
+      MPI_Alltoallv( SendBuf, Send_NCount, Send_NDisp, MPI_FLOAT,
+                     RecvBuf, Recv_NCount, Recv_NDisp, MPI_FLOAT,  MPI_COMM_WORLD );
+#     endif
+   }
 
 #  ifdef TIMING
    if ( OPT__TIMING_MPI )  Timer_MPI[1]->Stop();
@@ -1526,7 +1554,7 @@ void LB_GetBufferData( const int lv, const int FluSg, const int MagSg, const int
                for (int v=0; v<NVarCC_Flu; v++)
                {
                   const int TFluVarIdx = TFluVarIdxList[v];
-                  memcpy( &amr->patch[FluSg][lv][RPID]->fluid[TFluVarIdx][0][0][0], RecvPtr, CUBE(PS1)*sizeof(real) );
+                  Mis_CopyArray( &amr->patch[FluSg][lv][RPID]->fluid[TFluVarIdx][0][0][0], RecvPtr, CUBE(PS1) );
                   RecvPtr += CUBE( PS1 );
                }
 
@@ -1534,7 +1562,7 @@ void LB_GetBufferData( const int lv, const int FluSg, const int MagSg, const int
 #              ifdef GRAVITY
                if ( ExchangePot )
                {
-                  memcpy( &amr->patch[PotSg][lv][RPID]->pot[0][0][0], RecvPtr, CUBE(PS1)*sizeof(real) );
+                  Mis_CopyArray( &amr->patch[PotSg][lv][RPID]->pot[0][0][0], RecvPtr, CUBE(PS1) );
                   RecvPtr += CUBE( PS1 );
                }
 #              endif
@@ -1545,7 +1573,7 @@ void LB_GetBufferData( const int lv, const int FluSg, const int MagSg, const int
                for (int v=0; v<NVarFC_Mag; v++)
                {
                   const int TMagVarIdx = TMagVarIdxList[v];
-                  memcpy( &amr->patch[MagSg][lv][RPID]->magnetic[TMagVarIdx][0], RecvPtr, SQR(PS1)*PS1P1*sizeof(real) );
+                  Mis_CopyArray( &amr->patch[MagSg][lv][RPID]->magnetic[TMagVarIdx][0], RecvPtr, SQR(PS1)*PS1P1 );
                   RecvPtr += SQR( PS1 )*PS1P1;
                }
 #              endif
@@ -1794,6 +1822,158 @@ void LB_GetBufferData( const int lv, const int FluSg, const int MagSg, const int
 
 
 
+//-------------------------------------------------------------------------------------------------------
+// Function    :  LB_GetBufferData_SparseExchange
+// Description :  Replacement of MPI_Alltoallv() in LB_GetBufferData() that only communicates with ranks
+//                having non-zero data to be sent or received (for OPT__LB_SPARSE_COMM)
+//
+// Note        :  1. Each rank only exchanges buffer data with a few neighboring ranks along the space-filling
+//                   curve, for which the dense MPI_Alltoallv() becomes costly when MPI_NRank is large
+//                2. Persistent requests are created by MPI_Send_init() and MPI_Recv_init() and reused until
+//                   either the MPI count/displacement arrays or the shared send/recv buffers change
+//                   --> The count arrays only change when the MPI lists are reconstructed (e.g., by
+//                       LB_RecordExchangeDataPatchID()) or when the target variables/ghost zones change
+//                   --> LB_GetBufferData_MemAllocate_Send/Recv() reallocate the shared buffers only when they
+//                       are not large enough, so the same requests are reused for most calls
+//                3. Requests are stored separately for each level and GetBufMode, which have different lists
+//                4. All requests are completed before return, so the same MPI tag can be used for all messages
+//                5. Data sent to this rank itself are copied directly
+//
+// Parameter   :  lv          : Target refinement level
+//                GetBufMode  : Target mode of LB_GetBufferData()
+//                SendBuf     : MPI send buffer
+//                Send_NCount : Number of elements to be sent to each rank
+//                Send_NDisp  : Displacement of SendBuf for each rank
+//                RecvBuf     : MPI recv buffer
+//                Recv_NCount : Number of elements to be received from each rank
+//                Recv_NDisp  : Displacement of RecvBuf for each rank
+//
+// Return      :  RecvBuf
+//-------------------------------------------------------------------------------------------------------
+void LB_GetBufferData_SparseExchange( const int lv, const GetBufMode_t GetBufMode,
+                                      real *SendBuf, const int *Send_NCount, const int *Send_NDisp,
+                                      real *RecvBuf, const int *Recv_NCount, const int *Recv_NDisp )
+{
+
+// check
+   if ( GetBufMode < 0  ||  GetBufMode >= NGetBufMode )
+      Aux_Error( ERROR_INFO, "incorrect parameter %s = %d !!\n", "GetBufMode", GetBufMode );
+
+
+   SparseComm_t *Comm = &SparseComm[lv][GetBufMode];
+   const int     Tag  = GetBufMode;
+
+#  ifdef FLOAT8
+   const MPI_Datatype MPI_Type = MPI_DOUBLE;
+#  else
+   const MPI_Datatype MPI_Type = MPI_FLOAT;
+#  endif
+
+
+// 1. (re)create the persistent requests only if the data layout or buffers have changed
+   bool Reset = ( Comm->NCountDisp == NULL  ||  Comm->SendBuf != SendBuf  ||  Comm->RecvBuf != RecvBuf );
+
+   if ( !Reset )
+   {
+      const int *Input[4] = { Send_NCount, Send_NDisp, Recv_NCount, Recv_NDisp };
+
+      for (int t=0; t<4; t++)
+      {
+         if (  memcmp( Comm->NCountDisp+t*MPI_NRank, Input[t], MPI_NRank*sizeof(int) ) != 0  )
+         {
+            Reset = true;
+            break;
+         }
+      }
+   }
+
+   if ( Reset )
+   {
+      LB_GetBufferData_SparseFree( Comm );
+
+      Comm->NCountDisp = new int [ 4*MPI_NRank ];
+      memcpy( Comm->NCountDisp+0*MPI_NRank, Send_NCount, MPI_NRank*sizeof(int) );
+      memcpy( Comm->NCountDisp+1*MPI_NRank, Send_NDisp,  MPI_NRank*sizeof(int) );
+      memcpy( Comm->NCountDisp+2*MPI_NRank, Recv_NCount, MPI_NRank*sizeof(int) );
+      memcpy( Comm->NCountDisp+3*MPI_NRank, Recv_NDisp,  MPI_NRank*sizeof(int) );
+
+      Comm->SendBuf = SendBuf;
+      Comm->RecvBuf = RecvBuf;
+
+      int NReq = 0;
+      for (int r=0; r<MPI_NRank; r++)
+      {
+         if ( r == MPI_Rank )    continue;
+         if ( Recv_NCount[r] > 0 )  NReq ++;
+         if ( Send_NCount[r] > 0 )  NReq ++;
+      }
+
+      Comm->NReq = 0;
+      Comm->Req  = new MPI_Request [NReq];
+
+//    post receives first so that messages can be delivered directly to the recv buffer
+      for (int r=0; r<MPI_NRank; r++)
+         if ( r != MPI_Rank  &&  Recv_NCount[r] > 0 )
+            MPI_Recv_init( RecvBuf+Recv_NDisp[r], Recv_NCount[r], MPI_Type, r, Tag, MPI_COMM_WORLD,
+                           &Comm->Req[ Comm->NReq ++ ] );
+
+      for (int r=0; r<MPI_NRank; r++)
+         if ( r != MPI_Rank  &&  Send_NCount[r] > 0 )
+            MPI_Send_init( SendBuf+Send_NDisp[r], Send_NCount[r], MPI_Type, r, Tag, MPI_COMM_WORLD,
+                           &Comm->Req[ Comm->NReq ++ ] );
+   } // if ( Reset )
+
+
+// 2. transfer data
+   if ( Comm->NReq > 0 )   MPI_Startall( Comm->NReq, Comm->Req );
+
+   if ( Send_NCount[MPI_Rank] != Recv_NCount[MPI_Rank] )
+      Aux_Error( ERROR_INFO, "Send_NCount[%d] (%d) != Recv_NCount[%d] (%d) !!\n",
+                 MPI_Rank, Send_NCount[MPI_Rank], MPI_Rank, Recv_NCount[MPI_Rank] );
+
+   if ( Send_NCount[MPI_Rank] > 0 )
+      memcpy( RecvBuf+Recv_NDisp[MPI_Rank], SendBuf+Send_NDisp[MPI_Rank], Send_NCount[MPI_Rank]*sizeof(real) );
+
+   if ( Comm->NReq > 0 )   MPI_Waitall( Comm->NReq, Comm->Req, MPI_STATUSES_IGNORE );
+
+} // FUNCTION : LB_GetBufferData_SparseExchange
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  LB_GetBufferData_SparseFree
+// Description :  Free the persistent requests and the associated arrays of LB_GetBufferData_SparseExchange()
+//
+// Note        :  1. Invoked by LB_GetBufferData_SparseExchange() and LB_GetBufferData_MemFree()
+//                2. All requests must be inactive
+//
+// Parameter   :  Comm : Target set of persistent requests
+//-------------------------------------------------------------------------------------------------------
+void LB_GetBufferData_SparseFree( SparseComm_t *Comm )
+{
+
+   if ( Comm->Req != NULL )
+   {
+      for (int t=0; t<Comm->NReq; t++)    MPI_Request_free( &Comm->Req[t] );
+
+      delete [] Comm->Req;
+      Comm->Req = NULL;
+   }
+
+   if ( Comm->NCountDisp != NULL )
+   {
+      delete [] Comm->NCountDisp;
+      Comm->NCountDisp = NULL;
+   }
+
+   Comm->NReq    = 0;
+   Comm->SendBuf = NULL;
+   Comm->RecvBuf = NULL;
+
+} // FUNCTION : LB_GetBufferData_SparseFree
+
+
+
 //-------------------------------------------------------------------------------------------------------
 // Function    :  LB_GetBufferData_MemAllocate_Send
 // Description :  Allocate the MPI send buffer used by LG_GetBufferData (and Par_LB_SendParticleData)
@@ -1858,7 +2038,7 @@ real *LB_GetBufferData_MemAllocate_Recv( const int NRecv )
 
 //-------------------------------------------------------------------------------------------------------
 // Function    :  LB_GetBufferData_MemFree
-// Description :  Free the MPI send and recv buffers
+// Description :  Free the MPI send and recv buffers and the persistent requests of OPT__LB_SPARSE_COMM
 //
 // Note        :  This function is invoked by "End_MemFree"
 //
@@ -1879,6 +2059,10 @@ void LB_GetBufferData_MemFree()
       MPI_RecvBuf_Shared = NULL;
    }
 
+   for (int lv=0; lv<NLEVEL; lv++)
+   for (int m=0; m<NGetBufMode; m++)
+      LB_GetBufferData_SparseFree( &SparseComm[lv][m] );
+
 } // FUNCTION : LB_GetBufferData_MemFree
 
 
@@ -106,21 +106,18 @@ void LB_GrandsonCheck( const int FaLv )
 
 // 3. sort the query list for different ranks
 // ==========================================================================================
-   for (int r=0; r<MPI_NRank; r++)
-   {
-      FaPID_IdxTable[r] = new int [ NQuery[r] ];
+   for (int r=0; r<MPI_NRank; r++)  FaPID_IdxTable[r] = new int [ NQuery[r] ];
 
-      Mis_Heapsort( NQuery[r], Query_Temp[r], FaPID_IdxTable[r] );
-   }
+#  pragma omp parallel for schedule( dynamic )
+   for (int r=0; r<MPI_NRank; r++)  Mis_Heapsort( NQuery[r], Query_Temp[r], FaPID_IdxTable[r] );
 
 
 // 4. transfer data to get reply : (SendBuf_Query --> RecvBuf_Query --> SendBuf_Reply --> RecvBuf_Reply)
 // ==========================================================================================
    int   Query_Disp[MPI_NRank], Reply_Disp[MPI_NRank], NReply[MPI_NRank], NQuery_Total, NReply_Total;
-   int   Counter, SonPID0;
-   long *SendBuf_Query=NULL, *RecvBuf_Query=NULL, *QueryPtr=NULL;
-   int  *SendBuf_Reply=NULL, *RecvBuf_Reply=NULL, *ReplyPtr=NULL;
-   int  *Match=NULL;
+   int   Counter;
+   long *SendBuf_Query=NULL, *RecvBuf_Query=NULL;
+   int  *SendBuf_Reply=NULL, *RecvBuf_Reply=NULL;
 
 // 4.1 send the number of queries
    MPI_Alltoall( NQuery, 1, MPI_INT, NReply, 1, MPI_INT, MPI_COMM_WORLD );
@@ -153,11 +150,12 @@ void LB_GrandsonCheck( const int FaLv )
                   RecvBuf_Query, NReply, Reply_Disp, MPI_LONG, MPI_COMM_WORLD );
 
 // 4.4 prepare replies
+#  pragma omp parallel for schedule( dynamic )
    for (int r=0; r<MPI_NRank; r++)
    {
-      QueryPtr = RecvBuf_Query + Reply_Disp[r];
-      ReplyPtr = SendBuf_Reply + Reply_Disp[r];
-      Match    = new int [ NReply[r] ];
+      const long *QueryPtr = RecvBuf_Query + Reply_Disp[r];
+      int        *ReplyPtr = SendBuf_Reply + Reply_Disp[r];
+      int        *Match    = new int [ NReply[r] ];
 
       Mis_Matching_int( amr->NPatchComma[SonLv][1], amr->LB->IdxList_Real[SonLv], NReply[r], QueryPtr, Match );
 
@@ -168,12 +166,12 @@ void LB_GrandsonCheck( const int FaLv )
             Aux_Error( ERROR_INFO, "SonLBIdx = %ld found no matching in Rank %d !!\n", QueryPtr[t], MPI_Rank );
 #        endif
 
-         SonPID0 = amr->LB->IdxList_Real_IdxTable[SonLv][ Match[t] ];
+         int SonPID0 = amr->LB->IdxList_Real_IdxTable[SonLv][ Match[t] ];
          SonPID0 = SonPID0 - SonPID0%8;
 
          for (int LocalID=0; LocalID<8; LocalID++)
          {
-            SonPID = SonPID0 + LocalID;
+            const int SonPID = SonPID0 + LocalID;
 
 //          check if grandson exists
             if ( amr->patch[0][SonLv][SonPID]->son != -1 )  ReplyPtr[t] |= ( 1 << LocalID );
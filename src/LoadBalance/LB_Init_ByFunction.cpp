@@ -3,6 +3,7 @@
 #ifdef LOAD_BALANCE
 
 void Init_ByFunction_AssignData( const int lv );
+void Init_ByFunction_ShowTiming( const int NStage, const char *StageName[], Timer_t *Timer[][NLEVEL] );
 
 
 
@@ -14,6 +15,8 @@ void Init_ByFunction_AssignData( const int lv );
 // Note        :  1. Alternative function of Init_ByFunction()
 //                2. Optimize load balancing on a level-by-level basis
 //                   --> By invoking LB_Init_LoadBalance()
+//                3. Elapsed time of each stage on each level is reported by Init_ByFunction_ShowTiming()
+//                   when TIMING is on
 //
 // Parameter   :  None
 //
@@ -28,6 +31,7 @@ void LB_Init_ByFunction()
    const bool   FindHomePatchForPar_Yes = true;
    const bool   Redistribute_Yes        = true;
    const bool   ResetLB_Yes             = true;
+   const bool   Incremental_No          = false;
 #  ifdef PARTICLE
    const double Par_Weight              = amr->LB->Par_Weight;
 #  else
@@ -35,6 +39,17 @@ void LB_Init_ByFunction()
 #  endif
 
 
+// timers of different start-up stages
+// --> flagging and refinement are recorded on the level being created and restriction on the coarse level
+// --> stages = [ Refine, Flag, Assign, LoadBalance, Restrict ]
+   const int NStage = 5;
+
+   Timer_t *Timer[NStage][NLEVEL];
+
+   for (int s=0; s<NStage; s++)
+   for (int lv=0; lv<NLEVEL; lv++)     Timer[s][lv] = new Timer_t;
+
+
 // construct all levels
    for (int lv=0; lv<NLEVEL; lv++)
    {
@@ -42,46 +57,74 @@ void LB_Init_ByFunction()
 
 //    initialize the base level
       if ( lv == 0 )
-         Init_UniformGrid( lv, FindHomePatchForPar_Yes );
+      {
+         TIMING_FUNC(   Init_UniformGrid( lv, FindHomePatchForPar_Yes ),   Timer[0][lv],   TIMER_ON   );
+      }
 
 //    initialize the refinement levels
       else
       {
-         Flag_Real( lv-1, USELB_YES );
+         TIMING_FUNC(   Flag_Real( lv-1, USELB_YES ),   Timer[1][lv],   TIMER_ON   );
 
-         LB_Init_Refine( lv-1 );
+         TIMING_FUNC(   LB_Init_Refine( lv-1 ),         Timer[0][lv],   TIMER_ON   );
       }
 
 //    get the total number of real patches
-      Mis_GetTotalPatchNumber( lv );
+      TIMING_FUNC(   Mis_GetTotalPatchNumber( lv ),     Timer[3][lv],   TIMER_ON   );
 
 //    assign initial condition on grids
-      Init_ByFunction_AssignData( lv );
+      TIMING_FUNC(   Init_ByFunction_AssignData( lv ),  Timer[2][lv],   TIMER_ON   );
 
 //    load balance
-      LB_Init_LoadBalance( Redistribute_Yes, Par_Weight, ResetLB_Yes, lv );
+      TIMING_FUNC(   LB_Init_LoadBalance( Redistribute_Yes, Par_Weight, ResetLB_Yes, lv, Incremental_No ),
+                     Timer[3][lv],   TIMER_ON   );
 
       if ( MPI_Rank == 0 )    Aux_Message( stdout, "   Constructing level %d ... done\n", lv );
-
    } // for (int lv=0; lv<NLEVEL; lv++)
 
 
+// redistribute all levels jointly since the levels above are constructed and distributed one by one
+   if ( OPT__LB_ALL_LEVEL )
+   {
+      const int AllLv = -1;
+
+      TIMING_FUNC(   LB_Init_LoadBalance( Redistribute_Yes, Par_Weight, ResetLB_Yes, AllLv, Incremental_No ),
+                     Timer[3][0],   TIMER_ON   );
+   }
+
+
 // restrict all variables to be consistent with the finite volume scheme
    if ( OPT__INIT_RESTRICT )
    for (int lv=NLEVEL-2; lv>=0; lv--)
    {
       if ( MPI_Rank == 0 )    Aux_Message( stdout, "   Restricting level %d ... ", lv );
 
-      Flu_FixUp_Restrict( lv, amr->FluSg[lv+1], amr->FluSg[lv], amr->MagSg[lv+1], amr->MagSg[lv], NULL_INT, NULL_INT, _TOTAL, _MAG );
+      TIMING_FUNC(   Flu_FixUp_Restrict( lv, amr->FluSg[lv+1], amr->FluSg[lv], amr->MagSg[lv+1], amr->MagSg[lv],
+                                         NULL_INT, NULL_INT, _TOTAL, _MAG ),
+                     Timer[4][lv],   TIMER_ON   );
 
-      LB_GetBufferData( lv, amr->FluSg[lv], amr->MagSg[lv], NULL_INT, DATA_RESTRICT, _TOTAL, _MAG, NULL_INT );
+      TIMING_FUNC(   LB_GetBufferData( lv, amr->FluSg[lv], amr->MagSg[lv], NULL_INT, DATA_RESTRICT, _TOTAL, _MAG, NULL_INT ),
+                     Timer[4][lv],   TIMER_ON   );
 
-      Buf_GetBufferData( lv, amr->FluSg[lv], amr->MagSg[lv], NULL_INT, DATA_GENERAL, _TOTAL, _MAG, Flu_ParaBuf, USELB_YES );
+      TIMING_FUNC(   Buf_GetBufferData( lv, amr->FluSg[lv], amr->MagSg[lv], NULL_INT, DATA_GENERAL, _TOTAL, _MAG,
+                                        Flu_ParaBuf, USELB_YES ),
+                     Timer[4][lv],   TIMER_ON   );
 
       if ( MPI_Rank == 0 )    Aux_Message( stdout, "done\n" );
    }
 
 
+// report the start-up timing
+#  ifdef TIMING
+   const char *StageName[NStage] = { "Refine", "Flag", "Assign", "LoadBalance", "Restrict" };
+
+   Init_ByFunction_ShowTiming( NStage, StageName, Timer );
+#  endif
+
+   for (int s=0; s<NStage; s++)
+   for (int lv=0; lv<NLEVEL; lv++)     delete Timer[s][lv];
+
+
    if ( MPI_Rank == 0 )    Aux_Message( stdout, "%s ... done\n", __FUNCTION__ );
 
 } // FUNCTION : LB_Init_ByFunction
@@ -24,6 +24,12 @@ static void LB_RedistributeParticle_End( real **ParAtt_Old );
 //                5. Data in the buffer patches will be filled up
 //                6. NPatchTotal[] and NPatchComma[] must be prepared in advance
 //                7. Particles will also be redistributed
+//                8. With OPT__LB_ALL_LEVEL, the cut points of all levels are set jointly by LB_SetCutPoint_AllLevel()
+//                   when redistributing all levels (i.e., TLv < 0)
+//                9. With "Incremental == true", the cut points on TLv are shifted by LB_SetCutPoint_Incremental()
+//                   and this function returns immediately if none of them is changed
+//                   --> Only patch groups adjacent to the shifted cut points change their ranks
+//                   --> Patches (and MPI lists) on other levels are left untouched
 //
 // Parameter   :  Redistribute : true  --> Redistribute all real patches according to the load-balance weighting of
 //                                         each patch and initialize all load-balance related set-up
@@ -45,8 +51,12 @@ static void LB_RedistributeParticle_End( real **ParAtt_Old );
 //                TLv          : Target refinement level(s)
 //                               --> 0~TOP_LEVEL : only apply to a specific level
 //                                   <0          : apply to all levels
+//                Incremental  : Shift the existing cut points on TLv instead of setting them from scratch
+//                               --> Used by OPT__LB_INCREMENTAL
+//                               --> Must work with "Redistribute == true" and "TLv >= 0"
 //-------------------------------------------------------------------------------------------------------
-void LB_Init_LoadBalance( const bool Redistribute, const double ParWeight, const bool Reset, const int TLv )
+void LB_Init_LoadBalance( const bool Redistribute, const double ParWeight, const bool Reset, const int TLv,
+                          const bool Incremental )
 {
 
    if ( MPI_Rank == 0 )
@@ -64,6 +74,9 @@ void LB_Init_LoadBalance( const bool Redistribute, const double ParWeight, const
 
    if ( TLv > TOP_LEVEL )  Aux_Error( ERROR_INFO, "TLv (%d) > TOP_LEVEL (%d) !!\n", TLv, TOP_LEVEL );
 
+   if (  Incremental  &&  ( !Redistribute || TLv < 0 )  )
+      Aux_Error( ERROR_INFO, "Incremental must work with Redistribute and TLv >= 0 (TLv = %d) !!\n", TLv );
+
 // check the synchronization
    if ( TLv < 0 )
    for (int lv=1; lv<NLEVEL; lv++)
@@ -87,8 +100,26 @@ void LB_Init_LoadBalance( const bool Redistribute, const double ParWeight, const
    const bool InputLBIdxAndLoad_No = false;
 
    if ( Redistribute )
-   for (int lv=lv_min; lv<=lv_max; lv++)
-      LB_SetCutPoint( lv, NPatchTotal[lv]/8, amr->LB->CutPoint[lv], InputLBIdxAndLoad_No, NULL, NULL, ParWeight );
+   {
+      if ( Incremental )
+      {
+//       nothing to do if the cut points are not changed
+         if (  ! LB_SetCutPoint_Incremental( TLv, amr->LB->CutPoint[TLv], ParWeight )  )
+         {
+            if ( MPI_Rank == 0 )
+               Aux_Message( stdout, "   %s at Lv %d ... done (cut points unchanged)\n", __FUNCTION__, TLv );
+
+            return;
+         }
+      }
+
+      else if ( OPT__LB_ALL_LEVEL  &&  TLv < 0 )
+         LB_SetCutPoint_AllLevel( ParWeight );
+
+      else
+      for (int lv=lv_min; lv<=lv_max; lv++)
+         LB_SetCutPoint( lv, NPatchTotal[lv]/8, amr->LB->CutPoint[lv], InputLBIdxAndLoad_No, NULL, NULL, ParWeight );
+   }
 
 
 // 2. reinitialize arrays used by the load-balance routines
@@ -456,7 +487,6 @@ void LB_RedistributeRealPatch( const int lv, real **ParAtt_Old, const bool Remov
    const int RecvDataSizeMag1v  = NRecv_Total_Patch*MagSize1v;
 #  endif
 
-   real *SendPtr         = NULL;
    long *SendBuf_LBIdx   = new long [ NSend_Total_Patch ];
    real *SendBuf_Flu     = new real [ SendDataSizeFlu1v*NCOMP_TOTAL ];
 #  ifdef GRAVITY
@@ -471,7 +501,9 @@ void LB_RedistributeRealPatch( const int lv, real **ParAtt_Old, const bool Remov
 #  ifdef PARTICLE
    real *SendBuf_ParData = new real [ NSend_Total_ParData ];
    int  *SendBuf_NPar    = new int  [ NSend_Total_Patch ];
+   real *SendPtr         = NULL;
 #  endif
+   int  *SendIdx_Patch   = new int  [ NSend_Total_Patch ];   // index of each patch in the send buffers
 
    for (int r=0; r<MPI_NRank; r++)
    {
@@ -481,45 +513,19 @@ void LB_RedistributeRealPatch( const int lv, real **ParAtt_Old, const bool Remov
 #     endif
    }
 
+// record LB_Idx and particles serially since RemoveOneParticle() is not thread-safe
    for (int PID=0; PID<amr->NPatchComma[lv][1]; PID++)
    {
       LB_Idx = amr->patch[0][lv][PID]->LB_Idx;
       TRank  = LB_Index2Rank( lv, LB_Idx, CHECK_ON );
 
 //    2.1 LB_Idx
-      SendBuf_LBIdx[ Send_NDisp_Patch[TRank] + NDone_Patch[TRank] ] = LB_Idx;
-
-//    2.2 fluid
-      for (int v=0; v<NCOMP_TOTAL; v++)
-      {
-         SendPtr = SendBuf_Flu + v*SendDataSizeFlu1v + Send_NDisp_Flu1v[TRank] + NDone_Patch[TRank]*FluSize1v;
-         memcpy( SendPtr, &amr->patch[FluSg][lv][PID]->fluid[v][0][0][0], FluSize1v*sizeof(real) );
-      }
-
-#     ifdef GRAVITY
-//    2.3 potential
-      SendPtr = SendBuf_Pot + Send_NDisp_Flu1v[TRank] + NDone_Patch[TRank]*FluSize1v;
-      memcpy( SendPtr, &amr->patch[PotSg][lv][PID]->pot[0][0][0], FluSize1v*sizeof(real) );
-
-//    2.4 potential with ghost zones
-#     ifdef STORE_POT_GHOST
-      SendPtr = SendBuf_PotExt + Send_NDisp_PotExt[TRank] + NDone_Patch[TRank]*GraNxtSize;
-      memcpy( SendPtr, &amr->patch[PotSg][lv][PID]->pot_ext[0][0][0], GraNxtSize*sizeof(real) );
-#     endif
-#     endif
-
-//    2.5 magnetic field
-#     ifdef MHD
-      for (int v=0; v<NCOMP_MAG; v++)
-      {
-         SendPtr = SendBuf_Mag + v*SendDataSizeMag1v + Send_NDisp_Mag1v[TRank] + NDone_Patch[TRank]*MagSize1v;
-         memcpy( SendPtr, &amr->patch[MagSg][lv][PID]->magnetic[v][0], MagSize1v*sizeof(real) );
-      }
-#     endif
+      SendIdx_Patch[PID] = Send_NDisp_Patch[TRank] + NDone_Patch[TRank];
+      SendBuf_LBIdx[ SendIdx_Patch[PID] ] = LB_Idx;
 
-//    2.6 particle
+//    2.2 particle
 #     ifdef PARTICLE
-      SendBuf_NPar[ Send_NDisp_Patch[TRank] + NDone_Patch[TRank] ] = amr->patch[0][lv][PID]->NPar;
+      SendBuf_NPar[ SendIdx_Patch[PID] ] = amr->patch[0][lv][PID]->NPar;
 
       SendPtr = SendBuf_ParData + Send_NDisp_ParData[TRank] + NDone_ParData[TRank];
 
@@ -549,6 +555,44 @@ void LB_RedistributeRealPatch( const int lv, real **ParAtt_Old, const bool Remov
 #     endif
    } // for (int PID=0; PID<amr->NPatchComma[lv][1]; PID++)
 
+// copy grid data in parallel
+#  pragma omp parallel for schedule( runtime )
+   for (int PID=0; PID<amr->NPatchComma[lv][1]; PID++)
+   {
+      const int SendIdx = SendIdx_Patch[PID];
+      real *SendPtr = NULL;
+
+//    2.3 fluid
+      for (int v=0; v<NCOMP_TOTAL; v++)
+      {
+         SendPtr = SendBuf_Flu + v*SendDataSizeFlu1v + SendIdx*FluSize1v;
+         Mis_CopyArray( SendPtr, &amr->patch[FluSg][lv][PID]->fluid[v][0][0][0], FluSize1v );
+      }
+
+#     ifdef GRAVITY
+//    2.4 potential
+      SendPtr = SendBuf_Pot + SendIdx*FluSize1v;
+      Mis_CopyArray( SendPtr, &amr->patch[PotSg][lv][PID]->pot[0][0][0], FluSize1v );
+
+//    2.5 potential with ghost zones
+#     ifdef STORE_POT_GHOST
+      SendPtr = SendBuf_PotExt + SendIdx*GraNxtSize;
+      Mis_CopyArray( SendPtr, &amr->patch[PotSg][lv][PID]->pot_ext[0][0][0], GraNxtSize );
+#     endif
+#     endif
+
+//    2.6 magnetic field
+#     ifdef MHD
+      for (int v=0; v<NCOMP_MAG; v++)
+      {
+         SendPtr = SendBuf_Mag + v*SendDataSizeMag1v + SendIdx*MagSize1v;
+         Mis_CopyArray( SendPtr, &amr->patch[MagSg][lv][PID]->magnetic[v][0], MagSize1v );
+      }
+#     endif
+   } // for (int PID=0; PID<amr->NPatchComma[lv][1]; PID++)
+
+   delete [] SendIdx_Patch;
+
 // check if all particles are detached from patches at lv
 #  ifdef DEBUG_PARTICLE
    if ( amr->Par->NPar_Lv[lv] != 0 )
@@ -692,69 +736,52 @@ void LB_RedistributeRealPatch( const int lv, real **ParAtt_Old, const bool Remov
 // 6. allocate new patches with the data just received (use "patch group" as the basic unit)
 //    --> also add particles to the particle repository and associate them with home patches
 // ==========================================================================================
-   const real *RecvPtr_Grid = NULL;
-   const int   PScale       = PATCH_SIZE*amr->scale[lv];
-   const int   PGScale      = 2*PScale;
-   int PID, Cr0[3];
+   const int PScale  = PATCH_SIZE*amr->scale[lv];
+   const int PGScale = 2*PScale;
 
-#  ifdef PARTICLE
-// check: for RemoveParFromRepo == false, the size of particle repository should be exactly equal to the received particles
-// --> see LB_RedistributeParticle_Init()
-#  ifdef DEBUG_PARTICLE
-   const long NParExpect = amr->Par->NPar_AcPlusInac + NRecv_Total_ParData/PAR_NATT_TOTAL;
-   if ( !RemoveParFromRepo  &&  NParExpect > amr->Par->ParListSize )
-      Aux_Error( ERROR_INFO, "NParExpect (%ld) > ParListSize (%ld) !!\n", NParExpect, amr->Par->ParListSize );
-#  endif
+   if ( amr->num[lv] != 0 )
+      Aux_Error( ERROR_INFO, "amr->num[%d] = %d != 0 !!\n", lv, amr->num[lv] );
 
-   const real *RecvPtr_Par = RecvBuf_ParData;
-   long *ParList        = NULL;
-   int   ParListSizeMax = 0;    // must NOT be negative to deal with the case NRecv_Total_Patch == 0
-
-   for (int t=0; t<NRecv_Total_Patch; t++)   ParListSizeMax = MAX( ParListSizeMax, RecvBuf_NPar[t] );
-
-   ParList = new long [ParListSizeMax];
-#  endif // #ifdef PARTICLE
+   if ( NRecv_Total_Patch > MAX_PATCH )
+      Aux_Error( ERROR_INFO, "exceed MAX_PATCH (%d) => please reset it in the Makefile !!\n", MAX_PATCH );
 
+// 6.1 allocate patches and assign grid data in parallel
+#  pragma omp parallel for schedule( runtime )
    for (int PID0=0; PID0<NRecv_Total_Patch; PID0+=8)
    {
-      LB_Idx = RecvBuf_LBIdx[PID0];
+      const real *RecvPtr_Grid = NULL;
+      int Cr0[3];
 
-      LB_Index2Corner( lv, LB_Idx, Cr0, CHECK_ON );
+      LB_Index2Corner( lv, RecvBuf_LBIdx[PID0], Cr0, CHECK_ON );
 
       for (int d=0; d<3; d++)    Cr0[d] -= Cr0[d]%PGScale; // currently this line has no effect
 
-//    6.1 allocate patches
-//    father patch is still unkown ...
-      amr->pnew( lv, Cr0[0],        Cr0[1],        Cr0[2],        -1, true, true, true );
-      amr->pnew( lv, Cr0[0]+PScale, Cr0[1],        Cr0[2],        -1, true, true, true );
-      amr->pnew( lv, Cr0[0],        Cr0[1]+PScale, Cr0[2],        -1, true, true, true );
-      amr->pnew( lv, Cr0[0],        Cr0[1],        Cr0[2]+PScale, -1, true, true, true );
-      amr->pnew( lv, Cr0[0]+PScale, Cr0[1]+PScale, Cr0[2],        -1, true, true, true );
-      amr->pnew( lv, Cr0[0],        Cr0[1]+PScale, Cr0[2]+PScale, -1, true, true, true );
-      amr->pnew( lv, Cr0[0]+PScale, Cr0[1],        Cr0[2]+PScale, -1, true, true, true );
-      amr->pnew( lv, Cr0[0]+PScale, Cr0[1]+PScale, Cr0[2]+PScale, -1, true, true, true );
-
-//    6.2 assign data
       for (int LocalID=0; LocalID<8; LocalID++)
       {
-         PID = PID0 + LocalID;
+         const int PID = PID0 + LocalID;
+
+//       allocate patches (father patch is still unkown ...)
+         amr->pnew_PID( lv, PID, Cr0[0]+TABLE_02( LocalID, 'x', 0, PScale ),
+                                 Cr0[1]+TABLE_02( LocalID, 'y', 0, PScale ),
+                                 Cr0[2]+TABLE_02( LocalID, 'z', 0, PScale ),
+                        -1, true, true, true );
 
 //       fluid
          for (int v=0; v<NCOMP_TOTAL; v++)
          {
             RecvPtr_Grid = RecvBuf_Flu + v*RecvDataSizeFlu1v + PID*FluSize1v;
-            memcpy( &amr->patch[FluSg][lv][PID]->fluid[v][0][0][0], RecvPtr_Grid, FluSize1v*sizeof(real) );
+            Mis_CopyArray( &amr->patch[FluSg][lv][PID]->fluid[v][0][0][0], RecvPtr_Grid, FluSize1v );
          }
 
 #        ifdef GRAVITY
 //       potential
          RecvPtr_Grid = RecvBuf_Pot + PID*FluSize1v;
-         memcpy( &amr->patch[PotSg][lv][PID]->pot[0][0][0], RecvPtr_Grid, FluSize1v*sizeof(real) );
+         Mis_CopyArray( &amr->patch[PotSg][lv][PID]->pot[0][0][0], RecvPtr_Grid, FluSize1v );
 
 //       potential with ghost zones
 #        ifdef STORE_POT_GHOST
          RecvPtr_Grid = RecvBuf_PotExt + PID*GraNxtSize;
-         memcpy( &amr->patch[PotSg][lv][PID]->pot_ext[0][0][0], RecvPtr_Grid, GraNxtSize*sizeof(real) );
+         Mis_CopyArray( &amr->patch[PotSg][lv][PID]->pot_ext[0][0][0], RecvPtr_Grid, GraNxtSize );
 #        endif
 #        endif // GRAVITY
 
@@ -763,44 +790,66 @@ void LB_RedistributeRealPatch( const int lv, real **ParAtt_Old, const bool Remov
          for (int v=0; v<NCOMP_MAG; v++)
          {
             RecvPtr_Grid = RecvBuf_Mag + v*RecvDataSizeMag1v + PID*MagSize1v;
-            memcpy( &amr->patch[MagSg][lv][PID]->magnetic[v][0], RecvPtr_Grid, MagSize1v*sizeof(real) );
+            Mis_CopyArray( &amr->patch[MagSg][lv][PID]->magnetic[v][0], RecvPtr_Grid, MagSize1v );
          }
 #        endif
+      } // for (int LocalID=0; LocalID<8; LocalID++)
+   } // for (int PID0=0; PID0<NRecv_Total_Patch; PID0+=8)
 
-//       particle
-#        ifdef PARTICLE
-         for (int p=0; p<RecvBuf_NPar[PID]; p++)
-         {
-//          add a single particle to the particle repository
-            ParID        = amr->Par->AddOneParticle( RecvPtr_Par );
-            RecvPtr_Par += PAR_NATT_TOTAL;
-
-//          store the new particle index
-            ParList[p] = ParID;
-
-//          we do not transfer inactive particles
-#           ifdef DEBUG_PARTICLE
-            if ( amr->Par->Attribute[PAR_MASS][ParID] < (real)0.0 )
-               Aux_Error( ERROR_INFO, "Transferring inactive particle (ParID %d, Mass %14.7e) !!\n",
-                          ParID, amr->Par->Attribute[PAR_MASS][ParID] );
-#           endif
-         }
+   amr->num[lv] += NRecv_Total_Patch;
+
+// 6.2 add particles to the particle repository and associate them with home patches
+// --> must be done serially since AddOneParticle() is not thread-safe
+#  ifdef PARTICLE
+// check: for RemoveParFromRepo == false, the size of particle repository should be exactly equal to the received particles
+// --> see LB_RedistributeParticle_Init()
+#  ifdef DEBUG_PARTICLE
+   const long NParExpect = amr->Par->NPar_AcPlusInac + NRecv_Total_ParData/PAR_NATT_TOTAL;
+   if ( !RemoveParFromRepo  &&  NParExpect > amr->Par->ParListSize )
+      Aux_Error( ERROR_INFO, "NParExpect (%ld) > ParListSize (%ld) !!\n", NParExpect, amr->Par->ParListSize );
+#  endif
 
-//       6.3 associate particles with their home patches
+   const real *RecvPtr_Par = RecvBuf_ParData;
+   long *ParList        = NULL;
+   int   ParListSizeMax = 0;    // must NOT be negative to deal with the case NRecv_Total_Patch == 0
+
+   for (int t=0; t<NRecv_Total_Patch; t++)   ParListSizeMax = MAX( ParListSizeMax, RecvBuf_NPar[t] );
+
+   ParList = new long [ParListSizeMax];
+
+   for (int PID=0; PID<NRecv_Total_Patch; PID++)
+   {
+      for (int p=0; p<RecvBuf_NPar[PID]; p++)
+      {
+//       add a single particle to the particle repository
+         ParID        = amr->Par->AddOneParticle( RecvPtr_Par );
+         RecvPtr_Par += PAR_NATT_TOTAL;
+
+//       store the new particle index
+         ParList[p] = ParID;
+
+//       we do not transfer inactive particles
 #        ifdef DEBUG_PARTICLE
-//       do not set ParPos too early since pointers to the particle repository (e.g., amr->Par->PosX)
-//       may change after calling amr->Par->AddOneParticle()
-         const real *ParPos[3] = { amr->Par->PosX, amr->Par->PosY, amr->Par->PosZ };
-         char Comment[100];
-         sprintf( Comment, "%s, PID %d, NPar %d", __FUNCTION__, PID, RecvBuf_NPar[PID] );
-         amr->patch[0][lv][PID]->AddParticle( RecvBuf_NPar[PID], ParList, &amr->Par->NPar_Lv[lv],
-                                              ParPos, amr->Par->NPar_AcPlusInac, Comment );
-#        else
-         amr->patch[0][lv][PID]->AddParticle( RecvBuf_NPar[PID], ParList, &amr->Par->NPar_Lv[lv] );
+         if ( amr->Par->Attribute[PAR_MASS][ParID] < (real)0.0 )
+            Aux_Error( ERROR_INFO, "Transferring inactive particle (ParID %d, Mass %14.7e) !!\n",
+                       ParID, amr->Par->Attribute[PAR_MASS][ParID] );
 #        endif
-#        endif // #ifdef PARTICLE
-      } // for (int LocalID=0; LocalID<8; LocalID++)
-   } // for (int PID0=0; PID0<NRecv_Total_Patch; PID0+=8)
+      }
+
+//    6.3 associate particles with their home patches
+#     ifdef DEBUG_PARTICLE
+//    do not set ParPos too early since pointers to the particle repository (e.g., amr->Par->PosX)
+//    may change after calling amr->Par->AddOneParticle()
+      const real *ParPos[3] = { amr->Par->PosX, amr->Par->PosY, amr->Par->PosZ };
+      char Comment[100];
+      sprintf( Comment, "%s, PID %d, NPar %d", __FUNCTION__, PID, RecvBuf_NPar[PID] );
+      amr->patch[0][lv][PID]->AddParticle( RecvBuf_NPar[PID], ParList, &amr->Par->NPar_Lv[lv],
+                                           ParPos, amr->Par->NPar_AcPlusInac, Comment );
+#     else
+      amr->patch[0][lv][PID]->AddParticle( RecvBuf_NPar[PID], ParList, &amr->Par->NPar_Lv[lv] );
+#     endif
+   } // for (int PID=0; PID<NRecv_Total_Patch; PID++)
+#  endif // #ifdef PARTICLE
 
 // 6.4 reset NPatchComma
    for (int m=1; m<28; m++)   amr->NPatchComma[lv][m] = NRecv_Total_Patch;
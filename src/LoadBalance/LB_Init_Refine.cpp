@@ -14,6 +14,9 @@
 //                   --> Buffer patches will be allocated later when invoking LB_Init_LoadBalance()
 //                3. Must inovke Flag_Real( FaLv ) in advance
 //                4. LB_Init_LoadBalance() will be invoked later to optimize load-balancing
+//                5. Son patches are allocated in parallel with OpenMP
+//                   --> Son indices are determined in advance by a prefix sum over all flagged patches so that
+//                       the patch order is identical to the serial version
 //
 // Parameter   :  FaLv : Target level to be refined (FaLv --> FaLv+1)
 //-------------------------------------------------------------------------------------------------------
@@ -22,10 +25,9 @@ void LB_Init_Refine( const int FaLv )
 
    const int  SonLv         = FaLv + 1;
    const int  PScale        = PS1*amr->scale[SonLv];
+   const int  FaNReal       = amr->NPatchComma[FaLv][1];
    const bool AllocData_Yes = true;
 
-   const int *FaCr;
-
 
 // check
    if ( FaLv == TOP_LEVEL )
@@ -35,37 +37,51 @@ void LB_Init_Refine( const int FaLv )
       Aux_Error( ERROR_INFO, "number of son patches on level %d = %d != 0 !!\n", SonLv, amr->num[SonLv] );
 
 
-// loop over all **real** patches on FaLv
-   for (int FaPID=0; FaPID<amr->NPatchComma[FaLv][1]; FaPID++)
+// 1. construct the father->son relation for all **real** patches on FaLv
+   int NSon = 0;
+
+   for (int FaPID=0; FaPID<FaNReal; FaPID++)
    {
       if ( amr->patch[0][FaLv][FaPID]->flag )
       {
-//       construct the father->son relation
-         amr->patch[0][FaLv][FaPID]->son = amr->num[SonLv];
+         amr->patch[0][FaLv][FaPID]->son = amr->num[SonLv] + NSon;
+         NSon += 8;
+      }
+   }
 
+   if ( amr->num[SonLv]+NSon > MAX_PATCH )
+      Aux_Error( ERROR_INFO, "exceed MAX_PATCH (%d) => please reset it in the Makefile !!\n", MAX_PATCH );
 
-//       allocate child patches and construct the child->father relation
-         FaCr = amr->patch[0][FaLv][FaPID]->corner;
 
-         amr->pnew( SonLv, FaCr[0],        FaCr[1],        FaCr[2],        FaPID, AllocData_Yes, AllocData_Yes, AllocData_Yes );
-         amr->pnew( SonLv, FaCr[0]+PScale, FaCr[1],        FaCr[2],        FaPID, AllocData_Yes, AllocData_Yes, AllocData_Yes );
-         amr->pnew( SonLv, FaCr[0],        FaCr[1]+PScale, FaCr[2],        FaPID, AllocData_Yes, AllocData_Yes, AllocData_Yes );
-         amr->pnew( SonLv, FaCr[0],        FaCr[1],        FaCr[2]+PScale, FaPID, AllocData_Yes, AllocData_Yes, AllocData_Yes );
-         amr->pnew( SonLv, FaCr[0]+PScale, FaCr[1]+PScale, FaCr[2],        FaPID, AllocData_Yes, AllocData_Yes, AllocData_Yes );
-         amr->pnew( SonLv, FaCr[0],        FaCr[1]+PScale, FaCr[2]+PScale, FaPID, AllocData_Yes, AllocData_Yes, AllocData_Yes );
-         amr->pnew( SonLv, FaCr[0]+PScale, FaCr[1],        FaCr[2]+PScale, FaPID, AllocData_Yes, AllocData_Yes, AllocData_Yes );
-         amr->pnew( SonLv, FaCr[0]+PScale, FaCr[1]+PScale, FaCr[2]+PScale, FaPID, AllocData_Yes, AllocData_Yes, AllocData_Yes );
+// 2. allocate child patches and construct the child->father relation
+#  pragma omp parallel for schedule( runtime )
+   for (int FaPID=0; FaPID<FaNReal; FaPID++)
+   {
+      if ( amr->patch[0][FaLv][FaPID]->flag )
+      {
+         const int *FaCr    = amr->patch[0][FaLv][FaPID]->corner;
+         const int  SonPID0 = amr->patch[0][FaLv][FaPID]->son;
 
-//       pass particles from father to sons
-#        ifdef PARTICLE
-         Par_PassParticle2Son_SinglePatch( FaLv, FaPID );
-#        endif
+         for (int LocalID=0; LocalID<8; LocalID++)
+            amr->pnew_PID( SonLv, SonPID0+LocalID, FaCr[0]+TABLE_02( LocalID, 'x', 0, PScale ),
+                                                   FaCr[1]+TABLE_02( LocalID, 'y', 0, PScale ),
+                                                   FaCr[2]+TABLE_02( LocalID, 'z', 0, PScale ),
+                           FaPID, AllocData_Yes, AllocData_Yes, AllocData_Yes );
+      }
+   }
 
-      } // if ( amr->patch[0][FaLv][FaPID]->flag )
-   } // for (int FaPID=0; FaPID<amr->NPatchComma[FaLv][1]; FaPID++)
+   amr->num[SonLv] += NSon;
 
    for (int m=1; m<28; m++)   amr->NPatchComma[SonLv][m] = amr->num[SonLv];
 
+
+// 3. pass particles from father to sons
+// --> must be done after allocating all son patches since it is not thread-safe
+#  ifdef PARTICLE
+   for (int FaPID=0; FaPID<FaNReal; FaPID++)
+      if ( amr->patch[0][FaLv][FaPID]->flag )   Par_PassParticle2Son_SinglePatch( FaLv, FaPID );
+#  endif
+
 } // FUNCTION : LB_Init_Refine
 
 
@@ -123,20 +123,20 @@ void LB_Refine_AllocateNewPatch( const int FaLv, int NNew_Home, int *NewPID_Home
 // to avoid GNU warnings "non-constant array new length must be specified without parentheses around the type-id [-Wvla]"
 // --> see http://stackoverflow.com/questions/4523497/typedef-fixed-length-array
    /*
-   real (**flu_BufBk)[PS1][PS1][PS1] = ( OPT__REUSE_MEMORY ) ? NULL : new ( real (*[SonNBuff])[PS1][PS1][PS1] );
+   real_store (**flu_BufBk)[PS1][PS1][PS1] = ( OPT__REUSE_MEMORY ) ? NULL : new ( real_store (*[SonNBuff])[PS1][PS1][PS1] );
 #  ifdef GRAVITY
-   real (**pot_BufBk)[PS1][PS1]      = ( OPT__REUSE_MEMORY ) ? NULL : new ( real (*[SonNBuff])[PS1][PS1] );
+   real_store (**pot_BufBk)[PS1][PS1]      = ( OPT__REUSE_MEMORY ) ? NULL : new ( real_store (*[SonNBuff])[PS1][PS1] );
 #  endif
    */
-   typedef real flu_type[PS1][PS1][PS1];
-   real (**flu_BufBk)[PS1][PS1][PS1]    = ( OPT__REUSE_MEMORY ) ? NULL : new flu_type *[SonNBuff];
+   typedef real_store flu_type[PS1][PS1][PS1];
+   real_store (**flu_BufBk)[PS1][PS1][PS1]    = ( OPT__REUSE_MEMORY ) ? NULL : new flu_type *[SonNBuff];
 #  ifdef GRAVITY
-   typedef real pot_type[PS1][PS1];
-   real (**pot_BufBk)[PS1][PS1]         = ( OPT__REUSE_MEMORY ) ? NULL : new pot_type *[SonNBuff];
+   typedef real_store pot_type[PS1][PS1];
+   real_store (**pot_BufBk)[PS1][PS1]         = ( OPT__REUSE_MEMORY ) ? NULL : new pot_type *[SonNBuff];
 #  endif
 #  ifdef MHD
-   typedef real mag_type[ PS1P1*SQR(PS1) ];
-   real (**mag_BufBk)[ PS1P1*SQR(PS1) ] = ( OPT__REUSE_MEMORY ) ? NULL : new mag_type *[SonNBuff];
+   typedef real_store mag_type[ PS1P1*SQR(PS1) ];
+   real_store (**mag_BufBk)[ PS1P1*SQR(PS1) ] = ( OPT__REUSE_MEMORY ) ? NULL : new mag_type *[SonNBuff];
 #  endif
 
    if ( SonNBuff != 0 )
@@ -625,20 +625,20 @@ void LB_Refine_AllocateNewPatch( const int FaLv, int NNew_Home, int *NewPID_Home
          {
 //          note that it's OK to leave FSg_Flu2, FSg_Pot2, FSg_Mag2 unmodified (which can thus be NULL) since
 //          it will be allocated in LB_RecordExchangeDataPatchID if necessary
-            real (*flu_ptr)[PS1][PS1][PS1] = flu_BufBk[ PCr1D_BufBk_IdxTable[t] ];
+            real_store (*flu_ptr)[PS1][PS1][PS1] = flu_BufBk[ PCr1D_BufBk_IdxTable[t] ];
             if ( flu_ptr != NULL )
                amr->patch[FSg_Flu][SonLv][MPID]->fluid = flu_ptr;
 
 #           ifdef GRAVITY
 //          don't worry about pot_ext since it's actually useless for buffer patches
 //          --> after the following operation, some buffer patches may have pot != NULL but pot_ext == NULL (for FSg_Pot)
-            real (*pot_ptr)[PS1][PS1] = pot_BufBk[ PCr1D_BufBk_IdxTable[t] ];
+            real_store (*pot_ptr)[PS1][PS1] = pot_BufBk[ PCr1D_BufBk_IdxTable[t] ];
             if ( pot_ptr != NULL )
                amr->patch[FSg_Pot][SonLv][MPID]->pot = pot_ptr;
 #           endif
 
 #           ifdef MHD
-            real (*mag_ptr)[ PS1P1*SQR(PS1) ] = mag_BufBk[ PCr1D_BufBk_IdxTable[t] ];
+            real_store (*mag_ptr)[ PS1P1*SQR(PS1) ] = mag_BufBk[ PCr1D_BufBk_IdxTable[t] ];
             if ( mag_ptr != NULL )
                amr->patch[FSg_Mag][SonLv][MPID]->magnetic = mag_ptr;
 #           endif
@@ -0,0 +1,384 @@
+#include "GAMER.h"
+
+#ifdef LOAD_BALANCE
+
+
+
+static long NKeyBelow( const long *Key, const long NKey, const long Target );
+static int  CutPoint2Rank( const long *CutPoint, const long LBIdx );
+static long CountCrossLevelPG( const int *NPG_Total, long **LBIdx0_AllRank, long *const CutPoint[] );
+
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  LB_SetCutPoint_AllLevel
+// Description :  Set the load-balance cut points of all levels jointly (for OPT__LB_ALL_LEVEL)
+//
+// Note        :  1. Set amr->LB->CutPoint[lv][] for all levels
+//                   --> Alternative to calling LB_SetCutPoint() level by level
+//                2. Patch groups of all levels are ordered along a single space-filling curve and are
+//                   partitioned according to the **total** workload of all levels
+//                   --> Workload of each patch group is weighted by "amr->NUpdateLv[lv]"
+//                   --> Ranks may have different workloads at a single level
+//                3. Since "FaLBIdx*8 == SonLBIdx - SonLBIdx%8" (see LB_Corner2Index()), the space-filling curve of
+//                   level lv is mapped to that of the finest level by "LBIdx << 3*(MaxLv-lv)". A global cut
+//                   "Key" then assigns a patch group with the minimum LBIdx "LBIdx0" to the next rank iff
+//                   "(LBIdx0 << 3*(MaxLv-lv)) >= Key"
+//                   --> A son patch group is always put in the same rank as its father patch unless a cut lies
+//                       within the father patch group
+//                4. Each global cut is moved to the boundary of the coarsest patch group possible as long as the
+//                   accumulated workload deviates from the target by no more than "0.25*WLI_Max*Load_Ave"
+//                   --> Reduce the number of father-son pairs in different ranks
+//                   --> Deviation of each rank is < 0.5*WLI_Max*Load_Ave, and thus does not trigger a new
+//                       redistribution right away
+//                5. OPT__VERBOSE reports the number of patch groups whose father patch lies in a different
+//                   rank (i.e., those requiring inter-rank communication in the restriction, flux correction,
+//                   and coarse-fine interpolation) before and after setting the new cut points
+//                6. NPatchTotal[] must be prepared in advance
+//
+// Parameter   :  ParWeight : Relative load-balance weighting of particles
+//                            --> Weighting of each patch is estimated as "PATCH_SIZE^3 + NParThisPatch*ParWeight"
+//                            --> <= 0.0 : do not consider particle weighting
+//
+// Return      :  amr->LB->CutPoint[][]
+//-------------------------------------------------------------------------------------------------------
+void LB_SetCutPoint_AllLevel( const double ParWeight )
+{
+
+   if ( OPT__VERBOSE  &&  MPI_Rank == 0 )
+      Aux_Message( stdout, "      %s ...\n", __FUNCTION__ );
+
+
+   int     NPG_Total     [NLEVEL];
+   long   *LBIdx0_AllRank[NLEVEL];
+   double *Load_AllRank  [NLEVEL];
+   long   *CutPoint      [NLEVEL];
+   long   *CutPoint_Buf  = new long [ NLEVEL*(MPI_NRank+1) ];   // contiguous buffer of CutPoint[] for MPI_Bcast()
+
+   for (int lv=0; lv<NLEVEL; lv++)  CutPoint[lv] = CutPoint_Buf + lv*(MPI_NRank+1);
+
+
+// 1. collect the load-balance weighting and LB_Idx of all patch groups at all levels from all ranks
+   int *NPG_EachRank = ( MPI_Rank == 0 ) ? new int [MPI_NRank] : NULL;
+   int *Recv_Disp    = ( MPI_Rank == 0 ) ? new int [MPI_NRank] : NULL;
+
+   for (int lv=0; lv<NLEVEL; lv++)
+   {
+      NPG_Total     [lv] = NPatchTotal[lv] / 8;
+      LBIdx0_AllRank[lv] = NULL;
+      Load_AllRank  [lv] = NULL;
+
+      if ( MPI_Rank == 0 )
+      {
+         LBIdx0_AllRank[lv] = new long   [ NPG_Total[lv] ];
+         Load_AllRank  [lv] = new double [ NPG_Total[lv] ];
+      }
+
+      const int NPG_ThisRank    = amr->NPatchComma[lv][1] / 8;
+      long     *LBIdx0_ThisRank = new long   [NPG_ThisRank];
+      double   *Load_ThisRank   = new double [NPG_ThisRank];
+
+      MPI_Gather( &NPG_ThisRank, 1, MPI_INT, NPG_EachRank, 1, MPI_INT, 0, MPI_COMM_WORLD );
+
+      if ( MPI_Rank == 0 )
+      {
+         Recv_Disp[0] = 0;
+         for (int r=0; r<MPI_NRank-1; r++)   Recv_Disp[r+1] = Recv_Disp[r] + NPG_EachRank[r];
+      }
+
+//    minimum LBIdx in each patch group
+      for (int t=0; t<NPG_ThisRank; t++)
+      {
+         LBIdx0_ThisRank[t]  = amr->patch[0][lv][t*8]->LB_Idx;
+         LBIdx0_ThisRank[t] -= LBIdx0_ThisRank[t] % 8;
+      }
+
+      LB_EstimateWorkload_AllPatchGroup( lv, ParWeight, Load_ThisRank );
+
+      MPI_Gatherv( LBIdx0_ThisRank, NPG_ThisRank, MPI_LONG, LBIdx0_AllRank[lv], NPG_EachRank, Recv_Disp,
+                   MPI_LONG, 0, MPI_COMM_WORLD );
+      MPI_Gatherv( Load_ThisRank,   NPG_ThisRank, MPI_DOUBLE, Load_AllRank[lv], NPG_EachRank, Recv_Disp,
+                   MPI_DOUBLE, 0, MPI_COMM_WORLD );
+
+      delete [] LBIdx0_ThisRank;
+      delete [] Load_ThisRank;
+   } // for (int lv=0; lv<NLEVEL; lv++)
+
+   delete [] NPG_EachRank;
+   delete [] Recv_Disp;
+
+
+   if ( MPI_Rank == 0 )
+   {
+//    2. record the current cut points for reporting the number of cross-level patch groups
+      long NCross_Old = -1;
+
+      if ( OPT__VERBOSE )
+      {
+         for (int lv=0; lv<NLEVEL; lv++)
+         for (int r=0; r<MPI_NRank+1; r++)   CutPoint[lv][r] = amr->LB->CutPoint[lv][r];
+
+         NCross_Old = CountCrossLevelPG( NPG_Total, LBIdx0_AllRank, CutPoint );
+      }
+
+
+//    3. map all patch groups onto the space-filling curve of the finest level
+      int  MaxLv  = -1;
+      long NPG_All = 0;
+
+      for (int lv=0; lv<NLEVEL; lv++)
+      {
+         if ( NPG_Total[lv] > 0 )   MaxLv = lv;
+         NPG_All += NPG_Total[lv];
+      }
+
+      long   *Key       = new long   [NPG_All];
+      double *Load      = new double [NPG_All];
+      double *LoadAcc   = new double [NPG_All+1];   // LoadAcc[t] = total workload of the first t sorted patch groups
+      int    *IdxTable  = new int    [NPG_All];
+      long   *Key_Cut   = new long   [MPI_NRank+1]; // rank r owns "Key_Cut[r] <= Key < Key_Cut[r+1]"
+      double  Load_Ave  = 0.0;
+
+      for (int lv=0, t=0; lv<=MaxLv; lv++)
+      {
+         const double Weight = (double)MAX( amr->NUpdateLv[lv], 1L );
+
+         for (int PG=0; PG<NPG_Total[lv]; PG++, t++)
+         {
+            Key [t] = LBIdx0_AllRank[lv][PG] << ( 3*(MaxLv-lv) );
+            Load[t] = Load_AllRank[lv][PG]*Weight;
+         }
+      }
+
+      Mis_Heapsort( (int)NPG_All, Key, IdxTable );
+
+      LoadAcc[0] = 0.0;
+      for (long t=0; t<NPG_All; t++)   LoadAcc[t+1] = LoadAcc[t] + Load[ IdxTable[t] ];
+
+      Load_Ave = LoadAcc[NPG_All] / (double)MPI_NRank;
+
+
+//    4. set the global cut points
+      Key_Cut[        0] = ( NPG_All == 0 ) ? 0 : Key[0];
+      Key_Cut[MPI_NRank] = ( NPG_All == 0 ) ? 0 : Key[NPG_All-1] + 1;
+
+      const double Tolerance = 0.25*amr->LB->WLI_Max*Load_Ave;
+
+      for (int r=1; r<MPI_NRank; r++)
+      {
+         const double LoadTarget = r*Load_Ave;
+
+//       4-1. find the cut with an accumulated workload closest to the target accumulated workload
+         long t = NKeyBelow( Key, NPG_All, Key_Cut[r-1] );
+
+         while ( t < NPG_All  &&  LoadAcc[t+1] < LoadTarget )   t ++;
+
+         if ( t < NPG_All  &&  fabs(LoadAcc[t+1]-LoadTarget) < fabs(LoadAcc[t]-LoadTarget) )  t ++;
+
+         long KeyThisCut = ( t < NPG_All ) ? Key[t] : Key_Cut[MPI_NRank];
+
+//       4-2. move the cut to the boundary of the coarsest patch group with an acceptable workload deviation
+//            --> the finest level (lv == MaxLv) always works since KeyThisCut is already a patch group boundary there
+         for (int lv=0; lv<MaxLv; lv++)
+         {
+            const long   Span       = 8L << ( 3*(MaxLv-lv) );
+            const long   Key_L      = KeyThisCut - KeyThisCut%Span;
+            const long   Key_R      = ( Key_L == KeyThisCut ) ? Key_L : Key_L + Span;
+            const double LoadDiff_L = fabs( LoadAcc[ NKeyBelow(Key,NPG_All,Key_L) ] - LoadTarget );
+            const double LoadDiff_R = fabs( LoadAcc[ NKeyBelow(Key,NPG_All,Key_R) ] - LoadTarget );
+            const long   Key_Snap   = ( LoadDiff_L <= LoadDiff_R ) ? Key_L : Key_R;
+
+            if ( MIN(LoadDiff_L,LoadDiff_R) <= Tolerance )
+            {
+               KeyThisCut = Key_Snap;
+               break;
+            }
+         }
+
+//       4-3. ensure monotonicity
+         Key_Cut[r] = MIN(  MAX( KeyThisCut, Key_Cut[r-1] ), Key_Cut[MPI_NRank]  );
+      } // for (int r=1; r<MPI_NRank; r++)
+
+
+//    5. convert the global cut points to the cut points of each level
+      for (int lv=0; lv<NLEVEL; lv++)
+      {
+         if ( NPG_Total[lv] == 0 )
+         {
+            for (int r=0; r<MPI_NRank+1; r++)   CutPoint[lv][r] = -1;
+            continue;
+         }
+
+         long LBIdx0_Min = LBIdx0_AllRank[lv][0];
+         long LBIdx0_Max = LBIdx0_AllRank[lv][0];
+
+         for (int PG=1; PG<NPG_Total[lv]; PG++)
+         {
+            LBIdx0_Min = MIN( LBIdx0_Min, LBIdx0_AllRank[lv][PG] );
+            LBIdx0_Max = MAX( LBIdx0_Max, LBIdx0_AllRank[lv][PG] );
+         }
+
+         CutPoint[lv][        0] = LBIdx0_Min;
+         CutPoint[lv][MPI_NRank] = LBIdx0_Max + 8;   // +8 since the maximum LBIdx in all patches is LBIdx0_Max + 7
+
+//       minimum LBIdx0 on lv satisfying "(LBIdx0 << 3*(MaxLv-lv)) >= Key_Cut[r]"
+         const long Span = 8L << ( 3*(MaxLv-lv) );
+
+         for (int r=1; r<MPI_NRank; r++)
+         {
+            const long CP = ( Key_Cut[r] + Span - 1 ) / Span * 8;
+
+            CutPoint[lv][r] = MIN(  MAX( CP, CutPoint[lv][0] ), CutPoint[lv][MPI_NRank]  );
+         }
+
+#        ifdef GAMER_DEBUG
+         for (int r=0; r<MPI_NRank; r++)
+            if ( CutPoint[lv][r+1] < CutPoint[lv][r] )
+               Aux_Error( ERROR_INFO, "lv %d, CutPoint[%d] (%ld) < CutPoint[%d] (%ld) !!\n",
+                          lv, r+1, CutPoint[lv][r+1], r, CutPoint[lv][r] );
+#        endif
+      } // for (int lv=0; lv<NLEVEL; lv++)
+
+
+//    6. output the workload of each MPI rank and the number of cross-level patch groups
+      if ( OPT__VERBOSE )
+      {
+         double Load_Max = 0.0;
+
+         for (int r=0; r<MPI_NRank; r++)
+         {
+            const long   t_s        = ( r == 0           ) ? 0       : NKeyBelow( Key, NPG_All, Key_Cut[r  ] );
+            const long   t_e        = ( r == MPI_NRank-1 ) ? NPG_All : NKeyBelow( Key, NPG_All, Key_Cut[r+1] );
+            const double Load_ThisRank = LoadAcc[t_e] - LoadAcc[t_s];
+
+            Aux_Message( stdout, "         Rank %4d, Key %20ld -> %20ld, Load_Weighted %9.3e\n",
+                         r, Key_Cut[r], Key_Cut[r+1], Load_ThisRank );
+
+            Load_Max = MAX( Load_Max, Load_ThisRank );
+         }
+
+         const long NCross_New = CountCrossLevelPG( NPG_Total, LBIdx0_AllRank, CutPoint );
+         const long NPG_Son    = NPG_All - NPG_Total[0];
+
+         Aux_Message( stdout, "         Load_Ave %9.3e, Load_Max %9.3e --> Load_Imbalance = %6.2f%%\n",
+                      Load_Ave, Load_Max, (NPG_All == 0) ? 0.0 : 100.0*(Load_Max-Load_Ave)/Load_Ave );
+         Aux_Message( stdout, "         Patch groups with father patches in a different rank: %ld -> %ld (out of %ld)\n",
+                      NCross_Old, NCross_New, NPG_Son );
+         Aux_Message( stdout, "         =============================================================================\n" );
+      }
+
+
+      delete [] Key;
+      delete [] Load;
+      delete [] LoadAcc;
+      delete [] IdxTable;
+      delete [] Key_Cut;
+   } // if ( MPI_Rank == 0 )
+
+
+// 7. broadcast the cut points
+   MPI_Bcast( CutPoint_Buf, NLEVEL*(MPI_NRank+1), MPI_LONG, 0, MPI_COMM_WORLD );
+
+   for (int lv=0; lv<NLEVEL; lv++)
+   for (int r=0; r<MPI_NRank+1; r++)   amr->LB->CutPoint[lv][r] = CutPoint[lv][r];
+
+
+// free memory
+   for (int lv=0; lv<NLEVEL; lv++)
+   {
+      delete [] LBIdx0_AllRank[lv];
+      delete [] Load_AllRank  [lv];
+   }
+
+   delete [] CutPoint_Buf;
+
+
+   if ( OPT__VERBOSE  &&  MPI_Rank == 0 )
+      Aux_Message( stdout, "      %s ... done\n", __FUNCTION__ );
+
+} // FUNCTION : LB_SetCutPoint_AllLevel
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  NKeyBelow
+// Description :  Return the number of elements smaller than Target in the sorted array Key[]
+//-------------------------------------------------------------------------------------------------------
+long NKeyBelow( const long *Key, const long NKey, const long Target )
+{
+
+   long Min = 0, Max = NKey;
+
+   while ( Min < Max )
+   {
+      const long Mid = ( Min + Max ) / 2;
+
+      if ( Key[Mid] < Target )   Min = Mid + 1;
+      else                       Max = Mid;
+   }
+
+   return Min;
+
+} // FUNCTION : NKeyBelow
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  CutPoint2Rank
+// Description :  Same as LB_Index2Rank() except that it adopts the input cut points and a binary search
+//
+// Return      :  success : target MPI rank
+//                fail    : -1
+//-------------------------------------------------------------------------------------------------------
+int CutPoint2Rank( const long *CutPoint, const long LBIdx )
+{
+
+   if ( LBIdx < CutPoint[0]  ||  LBIdx >= CutPoint[MPI_NRank] )   return -1;
+
+// find the maximum r satisfying "CutPoint[r] <= LBIdx" to skip ranks without any patch
+   int Min = 0, Max = MPI_NRank;
+
+   while ( Max - Min > 1 )
+   {
+      const int Mid = ( Min + Max ) / 2;
+
+      if ( CutPoint[Mid] <= LBIdx )    Min = Mid;
+      else                             Max = Mid;
+   }
+
+   return Min;
+
+} // FUNCTION : CutPoint2Rank
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  CountCrossLevelPG
+// Description :  Count the number of patch groups whose father patch lies in a different rank
+//
+// Note        :  1. Father patch of a patch group with the minimum LBIdx "LBIdx0" has LBIdx "LBIdx0/8"
+//                2. Patch groups outside the range of the input cut points are counted as well
+//-------------------------------------------------------------------------------------------------------
+long CountCrossLevelPG( const int *NPG_Total, long **LBIdx0_AllRank, long *const CutPoint[] )
+{
+
+   long NCross = 0;
+
+   for (int lv=1; lv<NLEVEL; lv++)
+   for (int PG=0; PG<NPG_Total[lv]; PG++)
+   {
+      const long LBIdx0   = LBIdx0_AllRank[lv][PG];
+      const int  SonRank  = CutPoint2Rank( CutPoint[lv  ], LBIdx0   );
+      const int  FaRank   = CutPoint2Rank( CutPoint[lv-1], LBIdx0/8 );
+
+      if ( SonRank != FaRank  ||  SonRank == -1 )  NCross ++;
+   }
+
+   return NCross;
+
+} // FUNCTION : CountCrossLevelPG
+
+
+
+#endif // #ifdef LOAD_BALANCE
@@ -0,0 +1,201 @@
+#include "GAMER.h"
+
+#ifdef LOAD_BALANCE
+
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  LB_SetCutPoint_Incremental
+// Description :  Shift the existing cut points on level "lv" by a small amount to diffuse the workload between
+//                neighboring ranks on the space-filling curve (for OPT__LB_INCREMENTAL)
+//
+// Note        :  1. Alternative to LB_SetCutPoint(), which sets all cut points from scratch
+//                2. Each rank only exchanges its total workload with other ranks and determines the new cut points
+//                   with its neighboring ranks from its own patch groups
+//                   --> No need to collect LB_Idx and workload of all patch groups to one rank
+//                3. For each pair of neighboring ranks, the heavier rank moves patch groups adjacent to the cut
+//                   to the lighter one to remove half of their workload difference
+//                   --> Patch groups are moved only if it reduces the workload difference, so cut points
+//                       remain unchanged when the workload difference is less than that of a single patch group
+//                   --> At most "OPT__LB_INC_MAX_SHIFT" of the patch groups of a rank are moved across each cut
+//                4. Since OPT__LB_INC_MAX_SHIFT <= 0.5, patch groups moved across the two cuts of a rank never
+//                   overlap and the cut points remain monotonic
+//                5. Real patches on each rank must lie within the range of its current cut points, which
+//                   is guaranteed by both LB_Init_LoadBalance() and LB_Refine()
+//
+// Parameter   :  lv        : Target refinement level
+//                CutPoint  : Cut point array to be updated
+//                ParWeight : Relative load-balance weighting of particles
+//                            --> Weighting of each patch is estimated as "PATCH_SIZE^3 + NParThisPatch*ParWeight"
+//                            --> <= 0.0 : do not consider particle weighting
+//
+// Return      :  1. CutPoint[]
+//                2. true  : at least one cut point has been changed
+//                   false : nothing has been changed
+//                   --> Same on all ranks
+//-------------------------------------------------------------------------------------------------------
+bool LB_SetCutPoint_Incremental( const int lv, long *CutPoint, const double ParWeight )
+{
+
+// check
+   if ( OPT__LB_INC_MAX_SHIFT <= 0.0  ||  OPT__LB_INC_MAX_SHIFT > 0.5 )
+      Aux_Error( ERROR_INFO, "incorrect OPT__LB_INC_MAX_SHIFT (%14.7e) !!\n", OPT__LB_INC_MAX_SHIFT );
+
+
+// 0. set the cut points from scratch if they are not monotonic yet
+//    --> for example, LB_Refine() only sets CutPoint[0] and CutPoint[MPI_NRank] for a newly created level
+//    --> CutPoint[] is the same in all ranks and so is this decision
+   for (int r=0; r<MPI_NRank; r++)
+   {
+      if ( CutPoint[r+1] < CutPoint[r] )
+      {
+         const bool InputLBIdx0AndLoad_No = false;
+
+         LB_SetCutPoint( lv, NPatchTotal[lv]/8, CutPoint, InputLBIdx0AndLoad_No, NULL, NULL, ParWeight );
+
+         return true;
+      }
+   }
+
+
+// 1. get the LB_Idx and workload of all patch groups in this rank sorted along the space-filling curve
+   const int NPG_ThisRank = amr->NPatchComma[lv][1] / 8;
+
+   long   *LBIdx0   = new long   [NPG_ThisRank];
+   double *Load_PG  = new double [NPG_ThisRank];
+   int    *IdxTable = new int    [NPG_ThisRank];
+
+   for (int t=0; t<NPG_ThisRank; t++)
+   {
+      LBIdx0[t]  = amr->patch[0][lv][t*8]->LB_Idx;
+      LBIdx0[t] -= LBIdx0[t] % 8;
+   }
+
+   LB_EstimateWorkload_AllPatchGroup( lv, ParWeight, Load_PG );
+
+   Mis_Heapsort( NPG_ThisRank, LBIdx0, IdxTable );
+
+
+// 2. collect the total workload of all ranks
+   double Load_ThisRank = 0.0, Load_Ave = 0.0;
+   double *Load_AllRank = new double [MPI_NRank];
+
+   for (int t=0; t<NPG_ThisRank; t++)  Load_ThisRank += Load_PG[t];
+
+   MPI_Allgather( &Load_ThisRank, 1, MPI_DOUBLE, Load_AllRank, 1, MPI_DOUBLE, MPI_COMM_WORLD );
+
+   for (int r=0; r<MPI_NRank; r++)  Load_Ave += Load_AllRank[r];
+   Load_Ave /= (double)MPI_NRank;
+
+
+// 3. shift the cut points with the lower and upper neighboring ranks if this rank is heavier
+//    --> CutPoint[MPI_Rank] and CutPoint[MPI_Rank+1] are set by this rank only if it is the heavier rank
+//        of the corresponding pair, and thus each cut point is set by at most one rank
+   const int NMove_Max = (int)( OPT__LB_INC_MAX_SHIFT*NPG_ThisRank );
+
+   long *CutPoint_New = new long [MPI_NRank+1];
+   int  *NMove        = new int  [MPI_NRank+1];   // number of patch groups moved across each cut point
+
+   for (int r=0; r<MPI_NRank+1; r++)
+   {
+      CutPoint_New[r] = -1;
+      NMove       [r] = 0;
+   }
+
+   for (int Side=0; Side<2; Side++)    // 0/1 : lower/upper neighbor
+   {
+      const int NeighborRank = ( Side == 0 ) ? MPI_Rank-1 : MPI_Rank+1;
+      const int TCut         = ( Side == 0 ) ? MPI_Rank   : MPI_Rank+1;
+
+      if ( NeighborRank < 0  ||  NeighborRank >= MPI_NRank )      continue;
+      if ( Load_ThisRank <= Load_AllRank[NeighborRank] )          continue;
+
+      const double LoadTarget = 0.5*( Load_ThisRank - Load_AllRank[NeighborRank] );
+      double       LoadAcc    = 0.0;
+      int          NMoveThisCut = 0;
+
+//    accumulate the patch groups closest to the cut until reaching the target workload
+      while ( NMoveThisCut < NMove_Max )
+      {
+         const int    t          = ( Side == 0 ) ? NMoveThisCut : NPG_ThisRank-1-NMoveThisCut;
+         const double LoadThisPG = Load_PG[ IdxTable[t] ];
+
+         if ( fabs(LoadAcc+LoadThisPG-LoadTarget) >= fabs(LoadAcc-LoadTarget) )  break;
+
+         LoadAcc += LoadThisPG;
+         NMoveThisCut ++;
+      }
+
+      if ( NMoveThisCut == 0 )   continue;
+
+      CutPoint_New[TCut] = ( Side == 0 ) ? LBIdx0[NMoveThisCut] : LBIdx0[ NPG_ThisRank-NMoveThisCut ];
+      NMove       [TCut] = NMoveThisCut;
+   } // for (int Side=0; Side<2; Side++)
+
+
+// 4. collect the new cut points from all ranks
+   long *CutPoint_New_AllRank = new long [MPI_NRank+1];
+   int  *NMove_AllRank        = new int  [MPI_NRank+1];
+
+   MPI_Allreduce( CutPoint_New, CutPoint_New_AllRank, MPI_NRank+1, MPI_LONG, MPI_MAX, MPI_COMM_WORLD );
+   MPI_Allreduce( NMove,        NMove_AllRank,        MPI_NRank+1, MPI_INT,  MPI_MAX, MPI_COMM_WORLD );
+
+   bool Changed = false;
+
+   for (int r=1; r<MPI_NRank; r++)
+   {
+      if ( CutPoint_New_AllRank[r] >= 0  &&  CutPoint_New_AllRank[r] != CutPoint[r] )
+      {
+         CutPoint[r] = CutPoint_New_AllRank[r];
+         Changed     = true;
+      }
+   }
+
+#  ifdef GAMER_DEBUG
+   for (int r=0; r<MPI_NRank; r++)
+      if ( CutPoint[r+1] < CutPoint[r] )
+         Aux_Error( ERROR_INFO, "lv %d, CutPoint[%d] (%ld) < CutPoint[%d] (%ld) !!\n",
+                    lv, r+1, CutPoint[r+1], r, CutPoint[r] );
+#  endif
+
+
+// 5. output the new cut points and the number of patch groups moved across each of them
+   if ( OPT__VERBOSE  &&  MPI_Rank == 0 )
+   {
+      double Load_Max = 0.0;
+      for (int r=0; r<MPI_NRank; r++)  Load_Max = MAX( Load_Max, Load_AllRank[r] );
+
+      for (int r=1; r<MPI_NRank; r++)
+      {
+         if ( NMove_AllRank[r] == 0 )  continue;
+
+         Aux_Message( stdout, "         Lv %2d: Cut %4d -> %15ld, move %6d patch groups from rank %4d to rank %4d\n",
+                      lv, r, CutPoint[r], NMove_AllRank[r],
+                      ( Load_AllRank[r] > Load_AllRank[r-1] ) ? r : r-1,
+                      ( Load_AllRank[r] > Load_AllRank[r-1] ) ? r-1 : r );
+      }
+
+      Aux_Message( stdout, "         Lv %2d: Load_Ave %9.3e, Load_Max %9.3e --> Load_Imbalance (before shift) = %6.2f%%\n",
+                   lv, Load_Ave, Load_Max, (Load_Ave == 0.0) ? 0.0 : 100.0*(Load_Max-Load_Ave)/Load_Ave );
+   }
+
+
+// free memory
+   delete [] LBIdx0;
+   delete [] Load_PG;
+   delete [] IdxTable;
+   delete [] Load_AllRank;
+   delete [] CutPoint_New;
+   delete [] NMove;
+   delete [] CutPoint_New_AllRank;
+   delete [] NMove_AllRank;
+
+
+   return Changed;
+
+} // FUNCTION : LB_SetCutPoint_Incremental
+
+
+
+#endif // #ifdef LOAD_BALANCE
@@ -36,6 +36,8 @@ extern void (*Flu_ResetByUser_API_Ptr)( const int lv, const int FluSg, const dou
 void EvolveLevel( const int lv, const double dTime_FaLv )
 {
 
+   TRACE_SCOPE( "EvolveLevel", lv );
+
 #  ifdef TIMING
    MPI_Barrier( MPI_COMM_WORLD );
    Timer_Lv[lv]->Start();
@@ -442,7 +444,8 @@ void EvolveLevel( const int lv, const double dTime_FaLv )
       const int SaveSg_SrcFlu = SaveSg_Flu;  // save in the same Flu/MagSg
       const int SaveSg_SrcMag = SaveSg_Mag;
 
-      if ( SrcTerms.Any )
+//    skip it if the source terms have been added by the fluid solver (i.e., SRC_FUSE_FLUID)
+      if ( SrcTerms.Any  &&  !SRC_FUSE_FLUID )
       {
          if ( OPT__VERBOSE  &&  MPI_Rank == 0 )
             Aux_Message( stdout, "   Lv %2d: Src_AdvanceDt, counter = %8ld ... ", lv, AdvanceCounter[lv] );
@@ -5,7 +5,8 @@ static void Preparation_Step( const Solver_t TSolver, const int lv, const double
 static void Solver( const Solver_t TSolver, const int lv, const double TimeNew, const double TimeOld,
                     const int NPG, const int ArrayID, const double dt, const double Poi_Coeff );
 static void Closing_Step( const Solver_t TSolver, const int lv, const int SaveSg_Flu, const int SaveSg_Mag, const int SaveSg_Pot,
-                          const int NPG, const int *PID0_List, const int ArrayID, const double dt );
+                          const int NPG, const int *PID0_List, const int ArrayID, const double dt,
+                          const double TimeNew, const double TimeOld );
 
 extern Timer_t *Timer_Pre         [NLEVEL][NSOLVER];
 extern Timer_t *Timer_Sol         [NLEVEL][NSOLVER];
@@ -33,6 +34,8 @@ extern Timer_t *Timer_Poi_PrePot_F[NLEVEL];
 //                   the input data
 //                4. For LOAD_BALANCE, one can turn on the option "OPT__OVERLAP_MPI" to enable the
 //                   overlapping between MPI communication and CPU/GPU computation
+//                5. For the fluid solver, OPT__FLU_SUPER_BLOCK advances super-blocks of 2x2x2 patch groups by
+//                   Flu_SuperBlock() before the regular solver (not supported with OPT__OVERLAP_MPI)
 //
 // Parameter   :  TSolver      : Target solver
 //                               --> FLUID_SOLVER               : Fluid / ELBDM solver
@@ -187,6 +190,14 @@ void InvokeSolver( const Solver_t TSolver, const int lv, const double TimeNew, c
       PID0_List    = new int [NTotal];
 
       for (int t=0; t<NTotal; t++)  PID0_List[t] = 8*t;
+
+//    advance super-blocks of 2x2x2 patch groups first and remove them from PID0_List
+//    --> the remaining patch groups are advanced by the regular fluid solver below
+#     ifdef SUPPORT_FLU_SUPER_BLOCK
+      if ( TSolver == FLUID_SOLVER  &&  OPT__FLU_SUPER_BLOCK )
+      TIMING_SYNC(   NTotal = Flu_SuperBlock( lv, TimeNew, TimeOld, dt, SaveSg_Flu, SaveSg_Mag, NTotal, PID0_List ),
+                     Timer_Sol[lv][TSolver]  );
+#     endif
    } // if ( OverlapMPI ) ... else ...
 
    NPG[ArrayID] = ( NPG_Max < NTotal ) ? NPG_Max : NTotal;
@@ -232,7 +243,7 @@ void InvokeSolver( const Solver_t TSolver, const int lv, const double TimeNew, c
 
 //-------------------------------------------------------------------------------------------------------------
       TIMING_SYNC(   Closing_Step( TSolver, lv, SaveSg_Flu, SaveSg_Mag, SaveSg_Pot,
-                     NPG[1-ArrayID], PID0_List+Disp-NPG_Max, 1-ArrayID, dt ),
+                     NPG[1-ArrayID], PID0_List+Disp-NPG_Max, 1-ArrayID, dt, TimeNew, TimeOld ),
                      Timer_Clo[lv][TSolver]  );
 //-------------------------------------------------------------------------------------------------------------
 
@@ -248,7 +259,7 @@ void InvokeSolver( const Solver_t TSolver, const int lv, const double TimeNew, c
 
 //-------------------------------------------------------------------------------------------------------------
    TIMING_SYNC(   Closing_Step( TSolver, lv, SaveSg_Flu, SaveSg_Mag, SaveSg_Pot,
-                  NPG[ArrayID], PID0_List+Disp-NPG_Max, ArrayID, dt ),
+                  NPG[ArrayID], PID0_List+Disp-NPG_Max, ArrayID, dt, TimeNew, TimeOld ),
                   Timer_Clo[lv][TSolver]  );
 //-------------------------------------------------------------------------------------------------------------
 
@@ -259,6 +270,51 @@ void InvokeSolver( const Solver_t TSolver, const int lv, const double TimeNew, c
 
 
 
+//-------------------------------------------------------------------------------------------------------
+// Function    :  InvokeSolver_PatchList
+// Description :  Invoke the preparation and execution steps of the target solver for an arbitrary list of
+//                patch groups without the closing step
+//
+// Note        :  1. Always use the host arrays with ArrayID = 0
+//                   --> Must NOT be invoked during InvokeSolver()
+//                2. The updated data are left in the host output arrays (e.g., h_Flu_Array_F_Out[0]) and
+//                   must be stored back to the patch pointers by the caller
+//                3. NPG must not exceed the maximum number of patch groups of the target solver
+//                   (e.g., FLU_GPU_NPGROUP for FLUID_SOLVER)
+//                4. Can be invoked by only some of the MPI ranks
+//                5. Currently used by the patch-local retry of AUTO_REDUCE_DT (i.e., Flu_RetryLocal())
+//
+// Parameter   :  TSolver   : Target solver (see InvokeSolver())
+//                lv        : Target refinement level
+//                TimeNew   : Target physical time to reach
+//                TimeOld   : Physical time before update
+//                dt        : Time interval to advance solution
+//                Poi_Coeff : Coefficient in front of the RHS in the Poisson eq.
+//                NPG       : Number of patch groups to be updated
+//                PID0_List : List recording the patch indices with LocalID==0 to be udpated
+//                Prepare   : true  --> Prepare the input data
+//                            false --> Reuse the input data already stored in the host input arrays
+//-------------------------------------------------------------------------------------------------------
+void InvokeSolver_PatchList( const Solver_t TSolver, const int lv, const double TimeNew, const double TimeOld,
+                             const double dt, const double Poi_Coeff, const int NPG, const int *PID0_List,
+                             const bool Prepare )
+{
+
+   const int ArrayID = 0;
+
+// do not use TIMING_SYNC() here since it may invoke MPI_Barrier() while this function is called by only some ranks
+   if ( Prepare )    Preparation_Step( TSolver, lv, TimeNew, TimeOld, NPG, PID0_List, ArrayID );
+
+   Solver( TSolver, lv, TimeNew, TimeOld, NPG, ArrayID, dt, Poi_Coeff );
+
+#  ifdef GPU
+   CUAPI_Synchronize();
+#  endif
+
+} // FUNCTION : InvokeSolver_PatchList
+
+
+
 //-------------------------------------------------------------------------------------------------------
 // Function    :  Preparation_Step
 // Description :  Prepare the input data for the CPU/GPU solvers
@@ -291,6 +347,8 @@ void Preparation_Step( const Solver_t TSolver, const int lv, const double TimeNe
                        const int *PID0_List, const int ArrayID )
 {
 
+   TRACE_SCOPE( "Preparation_Step", lv );
+
 #  ifndef UNSPLIT_GRAVITY
    real (*h_Pot_Array_USG_F[2])[ CUBE(USG_NXT_F) ]                    = { NULL, NULL };
 #  endif
@@ -440,6 +498,8 @@ void Solver( const Solver_t TSolver, const int lv, const double TimeNew, const d
              const int NPG, const int ArrayID, const double dt, const double Poi_Coeff )
 {
 
+   TRACE_SCOPE( "Solver", lv );
+
    const double dh = amr->dh[lv];
 
 #  ifdef GRAVITY
@@ -548,7 +608,8 @@ void Solver( const Solver_t TSolver, const int lv, const double TimeNew, const d
                                  ELBDM_ETA, ELBDM_TAYLOR3_COEFF, ELBDM_TAYLOR3_AUTO,
                                  TimeOld, (OPT__SELF_GRAVITY || OPT__EXT_POT), OPT__EXT_ACC,
                                  MIN_DENS, MIN_PRES, MIN_EINT, DUAL_ENERGY_SWITCH,
-                                 OPT__NORMALIZE_PASSIVE, PassiveNorm_NVar, PassiveNorm_VarIdx, JEANS_MIN_PRES, JeansMinPres_Coeff );
+                                 OPT__NORMALIZE_PASSIVE, PassiveNorm_NVar, PassiveNorm_VarIdx, JEANS_MIN_PRES, JeansMinPres_Coeff,
+                                 SRC_FUSE_FLUID, TimeNew, OPT__FLU_SLAB );
 #        endif
       break;
 
@@ -742,11 +803,16 @@ void Solver( const Solver_t TSolver, const int lv, const double TimeNew, const d
 //                PID0_List  : List recording the patch indices with LocalID==0 to be udpated
 //                ArrayID    : Array index to load and store data ( 0 or 1 )
 //                dt         : Time interval to advance solution (for OPT__1ST_FLUX_CORR in Flu_Close())
+//                TimeNew    : Target physical time to reach (for SRC_FUSE_FLUID in Flu_Close())
+//                TimeOld    : Physical time before update   (for SRC_FUSE_FLUID in Flu_Close())
 //-------------------------------------------------------------------------------------------------------
 void Closing_Step( const Solver_t TSolver, const int lv, const int SaveSg_Flu, const int SaveSg_Mag, const int SaveSg_Pot,
-                   const int NPG, const int *PID0_List, const int ArrayID, const double dt )
+                   const int NPG, const int *PID0_List, const int ArrayID, const double dt,
+                   const double TimeNew, const double TimeOld )
 {
 
+   TRACE_SCOPE( "Closing_Step", lv );
+
 #  ifndef DUAL_ENERGY
    char (*h_DE_Array_F_Out [2])[ CUBE(PS2) ]                          = { NULL, NULL };
 #  endif
@@ -767,7 +833,7 @@ void Closing_Step( const Solver_t TSolver, const int lv, const int SaveSg_Flu, c
       case FLUID_SOLVER :
          Flu_Close( lv, SaveSg_Flu, SaveSg_Mag, h_Flux_Array[ArrayID], h_Ele_Array[ArrayID],
                     h_Flu_Array_F_Out[ArrayID], h_Mag_Array_F_Out[ArrayID], h_DE_Array_F_Out[ArrayID],
-                    NPG, PID0_List, h_Flu_Array_F_In[ArrayID], h_Mag_Array_F_In[ArrayID], dt );
+                    NPG, PID0_List, h_Flu_Array_F_In[ArrayID], h_Mag_Array_F_In[ArrayID], dt, TimeNew, TimeOld );
       break;
 
 #     ifdef GRAVITY
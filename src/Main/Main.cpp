@@ -52,14 +52,18 @@ double               OUTPUT_PART_X, OUTPUT_PART_Y, OUTPUT_PART_Z, AUTO_REDUCE_DT
 double               OPT__CK_MEMFREE, INT_MONO_COEFF, UNIT_L, UNIT_M, UNIT_T, UNIT_V, UNIT_D, UNIT_E, UNIT_P;
 int                  OPT__UM_IC_LEVEL, OPT__UM_IC_NVAR, OPT__UM_IC_LOAD_NRANK, OPT__GPUID_SELECT, OPT__PATCH_COUNT;
 int                  INIT_DUMPID, INIT_SUBSAMPLING_NCELL, OPT__TIMING_BARRIER, OPT__REUSE_MEMORY, RESTART_LOAD_NRANK;
+int                  OPT__TIMING_TRACE_NEVENT;
 bool                 OPT__FLAG_RHO, OPT__FLAG_RHO_GRADIENT, OPT__FLAG_USER, OPT__FLAG_LOHNER_DENS, OPT__FLAG_REGION;
 int                  OPT__FLAG_USER_NUM;
 bool                 OPT__DT_USER, OPT__RECORD_DT, OPT__RECORD_MEMORY, OPT__MEMORY_POOL, OPT__RESTART_RESET;
+bool                 OPT__SINGLE_SANDGLASS;
 bool                 OPT__FIXUP_RESTRICT, OPT__INIT_RESTRICT, OPT__VERBOSE, OPT__MANUAL_CONTROL, OPT__UNIT;
 bool                 OPT__INT_TIME, OPT__OUTPUT_USER, OPT__OUTPUT_BASE, OPT__OVERLAP_MPI, OPT__TIMING_BALANCE;
 bool                 OPT__OUTPUT_BASEPS, OPT__CK_REFINE, OPT__CK_PROPER_NESTING, OPT__CK_FINITE, OPT__RECORD_PERFORMANCE;
 bool                 OPT__CK_RESTRICT, OPT__CK_PATCH_ALLOCATE, OPT__FIXUP_FLUX, OPT__CK_FLUX_ALLOCATE, OPT__CK_NORMALIZE_PASSIVE;
-bool                 OPT__UM_IC_DOWNGRADE, OPT__UM_IC_REFINE, OPT__TIMING_MPI;
+bool                 OPT__UM_IC_DOWNGRADE, OPT__UM_IC_REFINE, OPT__TIMING_MPI, OPT__TIMING_TRACE;
+bool                 OPT__TIMING_PERF, AUTO_REDUCE_DT_LOCAL;
+long                 OPT__TIMING_PERF_RAW;
 bool                 OPT__CK_CONSERVATION, OPT__RESET_FLUID, OPT__RECORD_USER, OPT__NORMALIZE_PASSIVE, AUTO_REDUCE_DT;
 bool                 OPT__OPTIMIZE_AGGRESSIVE, OPT__INIT_GRID_WITH_OMP, OPT__NO_FLAG_NEAR_BOUNDARY;
 bool                 OPT__RECORD_NOTE, OPT__RECORD_UNPHY, INT_OPP_SIGN_0TH_ORDER;
@@ -82,11 +86,17 @@ OptTimeStepLevel_t   OPT__DT_LEVEL;
 #if   ( MODEL == HYDRO )
 double               FlagTable_PresGradient[NLEVEL-1], FlagTable_Vorticity[NLEVEL-1], FlagTable_Jeans[NLEVEL-1];
 double               GAMMA, MINMOD_COEFF, MOLECULAR_WEIGHT, ISO_TEMP;
+char                 EOS_TAB_NAME[MAX_STRING];
+int                  EOS_TAB_NDENS, EOS_TAB_NSEINT, EOS_TAB_NYE, EOS_TAB_NPRES;
+double               EOS_TAB_LOGDENS_MIN, EOS_TAB_LOGDENS_MAX, EOS_TAB_LOGSEINT_MIN, EOS_TAB_LOGSEINT_MAX;
+double               EOS_TAB_YE_MIN, EOS_TAB_YE_MAX;
 LR_Limiter_t         OPT__LR_LIMITER;
 Opt1stFluxCorr_t     OPT__1ST_FLUX_CORR;
 OptRSolver1st_t      OPT__1ST_FLUX_CORR_SCHEME;
 bool                 OPT__FLAG_PRES_GRADIENT, OPT__FLAG_LOHNER_ENGY, OPT__FLAG_LOHNER_PRES, OPT__FLAG_LOHNER_TEMP;
 bool                 OPT__FLAG_VORTICITY, OPT__FLAG_JEANS, JEANS_MIN_PRES, OPT__LAST_RESORT_FLOOR;
+bool                 OPT__FLU_SUPER_BLOCK;
+int                  OPT__FLU_SLAB;
 int                  OPT__CK_NEGATIVE, JEANS_MIN_PRES_LEVEL, JEANS_MIN_PRES_NCELL;
 double               MIN_DENS, MIN_PRES, MIN_EINT;
 #ifdef DUAL_ENERGY
@@ -165,6 +175,10 @@ double               LB_INPUT__WLI_MAX;
 double               LB_INPUT__PAR_WEIGHT;
 #endif
 bool                 OPT__RECORD_LOAD_BALANCE;
+bool                 OPT__LB_ALL_LEVEL;
+int                  OPT__LB_INCREMENTAL;
+double               OPT__LB_INC_MAX_SHIFT;
+bool                 OPT__LB_SPARSE_COMM;
 #endif
 bool                 OPT__MINIMIZE_MPI_BARRIER;
 
@@ -237,9 +251,14 @@ EoS_t EoS;
 
 // (2-10) source terms
 SrcTerms_t SrcTerms;
+bool       SRC_FUSE_FLUID;
 #if ( MODEL == HYDRO )
 double     Src_Dlep_AuxArray_Flt[SRC_NAUX_DLEP];
 int        Src_Dlep_AuxArray_Int[SRC_NAUX_DLEP];
+double     Src_Cool_AuxArray_Flt[SRC_NAUX_COOL];
+int        Src_Cool_AuxArray_Int[SRC_NAUX_COOL];
+char       SRC_COOLING_TABLE[MAX_STRING];
+double     SRC_COOLING_REDSHIFT, SRC_COOLING_METAL;
 #endif
 double     Src_User_AuxArray_Flt[SRC_NAUX_USER];
 int        Src_User_AuxArray_Int[SRC_NAUX_USER];
@@ -451,9 +470,13 @@ extern void (*Aux_Record_User_Ptr)();
 
 
 
+#ifndef GAMER_BENCH
 //-------------------------------------------------------------------------------------------------------
 // Function    :  main
 // Description :  GAMER main function
+//
+// Note        :  1. Disabled by GAMER_BENCH so that the solver benchmarks (see Benchmark/Bench_Main.cpp)
+//                   can reuse the global variables defined in this file
 //-------------------------------------------------------------------------------------------------------
 int main( int argc, char *argv[] )
 {
@@ -607,7 +630,9 @@ int main( int argc, char *argv[] )
 #        endif
          const int    AllLv            = -1;
 
-         LB_Init_LoadBalance( Redistribute_Yes, ParWeight, ResetLB_Yes, AllLv );
+         const bool   Incremental_No   = false;
+
+         LB_Init_LoadBalance( Redistribute_Yes, ParWeight, ResetLB_Yes, AllLv, Incremental_No );
 
          if ( OPT__PATCH_COUNT > 0 )         Aux_Record_PatchCount();
 
@@ -616,6 +641,27 @@ int main( int argc, char *argv[] )
 #        endif
       } // if ( LB_EstimateLoadImbalance() > amr->LB->WLI_Max )
 
+//    shift the cut points between neighboring ranks level by level every OPT__LB_INCREMENTAL steps
+//    --> only migrate patch groups adjacent to the shifted cut points
+      else if ( OPT__LB_INCREMENTAL > 0  &&  Step%OPT__LB_INCREMENTAL == 0 )
+      {
+         const bool   Redistribute_Yes = true;
+         const bool   ResetLB_Yes      = true;
+#        ifdef PARTICLE
+         const double ParWeight        = amr->LB->Par_Weight;
+#        else
+         const double ParWeight        = 0.0;
+#        endif
+         const bool   Incremental_Yes  = true;
+
+         for (int lv=0; lv<NLEVEL; lv++)
+         {
+            if ( NPatchTotal[lv] == 0 )   break;
+
+            LB_Init_LoadBalance( Redistribute_Yes, ParWeight, ResetLB_Yes, lv, Incremental_Yes );
+         }
+      } // else if ( OPT__LB_INCREMENTAL > 0  &&  Step%OPT__LB_INCREMENTAL == 0 )
+
 #     ifdef TIMING
       Timer_Main[5]->Stop();
 #     endif
@@ -636,6 +682,8 @@ int main( int argc, char *argv[] )
 
       Aux_Record_Timing();
 
+      Aux_Trace_Flush();
+
       Aux_ResetTimer();
 
       Timer_Other.Stop();
@@ -682,3 +730,4 @@ int main( int argc, char *argv[] )
 
 } // FUNCTION : Main
 
+#endif // #ifndef GAMER_BENCH
@@ -754,6 +754,8 @@ void Prepare_PatchData( const int lv, const double PrepTime, real *OutputCC, rea
 #     pragma omp for schedule( runtime )
       for (int TID=0; TID<NPG; TID++)
       {
+         TRACE_SCOPE( "Prepare_PatchData_PG", lv );
+
          PID0 = PID0_List[TID];
 
 #        ifdef GAMER_DEBUG
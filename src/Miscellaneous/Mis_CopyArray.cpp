@@ -0,0 +1,40 @@
+#include "GAMER.h"
+
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  Mis_CopyArray
+// Description :  Copy an array of floating-point numbers with type conversion
+//
+// Note        :  1. Mainly used for copying data between patches (real_store) and solver or I/O buffers (real),
+//                   which have different types when MIXED_PRECISION is on
+//                   --> Conversion from double to float rounds to the nearest representable value
+//                2. Reduce to memcpy() if TDst and TSrc are the same
+//                3. Only float and double are supported
+//
+// Parameter   :  Dst : Destination array
+//                Src : Source array
+//                N   : Number of elements to be copied
+//
+// Return      :  Dst[]
+//-------------------------------------------------------------------------------------------------------
+template <typename TDst, typename TSrc>
+void Mis_CopyArray( TDst *Dst, const TSrc *Src, const long N )
+{
+
+   if ( sizeof(TDst) == sizeof(TSrc) )
+      memcpy( Dst, Src, N*sizeof(TDst) );
+
+   else
+      for (long t=0; t<N; t++)   Dst[t] = (TDst)Src[t];
+
+} // FUNCTION : Mis_CopyArray
+
+
+
+// explicit template instantiation
+template void Mis_CopyArray <float,  float>  ( float  *Dst, const float  *Src, const long N );
+template void Mis_CopyArray <float,  double> ( float  *Dst, const double *Src, const long N );
+template void Mis_CopyArray <double, float>  ( double *Dst, const float  *Src, const long N );
+template void Mis_CopyArray <double, double> ( double *Dst, const double *Src, const long N );
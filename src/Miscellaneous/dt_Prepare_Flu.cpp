@@ -35,13 +35,13 @@ void dt_Prepare_Flu( const int lv, real h_Flu_Array_T[][FLU_NIN_T][ CUBE(PS1) ],
          const int N   = 8*TID + LocalID;
 
 //       fluid variables (including/excluding passive scalars for general/constant-gamma EoS)
-         memcpy( h_Flu_Array_T[N][0], amr->patch[ amr->FluSg[lv] ][lv][PID]->fluid[0][0][0],
-                 FLU_NIN_T*CUBE(PS1)*sizeof(real) );
+         Mis_CopyArray( h_Flu_Array_T[N][0], amr->patch[ amr->FluSg[lv] ][lv][PID]->fluid[0][0][0],
+                        FLU_NIN_T*CUBE(PS1) );
 
 //       B field
 #        ifdef MHD
-         memcpy( h_Mag_Array_T[N][0], amr->patch[ amr->MagSg[lv] ][lv][PID]->magnetic[0],
-                 NCOMP_MAG*PS1P1*SQR(PS1)*sizeof(real) );
+         Mis_CopyArray( h_Mag_Array_T[N][0], amr->patch[ amr->MagSg[lv] ][lv][PID]->magnetic[0],
+                        NCOMP_MAG*PS1P1*SQR(PS1) );
 #        endif
       }
    } // for (int TID=0; TID<NPG; TID++)
@@ -30,7 +30,7 @@ void Hydro_DataReconstruction( const real g_ConVar   [][ CUBE(FLU_NXT) ],
                                const real MinDens, const real MinPres, const real MinEint,
                                const bool NormPassive, const int NNorm, const int NormIdx[],
                                const bool JeansMinPres, const real JeansMinPres_Coeff,
-                               const EoS_t *EoS );
+                               const EoS_t *EoS, const int kSlab_s, const int kSlab_e );
 void Hydro_ComputeFlux( const real g_FC_Var [][NCOMP_TOTAL_PLUS_MAG][ CUBE(N_FC_VAR) ],
                               real g_FC_Flux[][NCOMP_TOTAL_PLUS_MAG][ CUBE(N_FC_FLUX) ],
                         const int NFlux, const int NSkip_N, const int NSkip_T,
@@ -38,12 +38,13 @@ void Hydro_ComputeFlux( const real g_FC_Var [][NCOMP_TOTAL_PLUS_MAG][ CUBE(N_FC_
                         const real dt, const real dh, const double Time, const bool UsePot,
                         const OptExtAcc_t ExtAcc, const ExtAcc_t ExtAcc_Func, const double ExtAcc_AuxArray[],
                         const real MinDens, const real MinPres, const bool DumpIntFlux, real g_IntFlux[][NCOMP_TOTAL][ SQR(PS2) ],
-                        const EoS_t *EoS );
+                        const EoS_t *EoS, const int kSlab_s, const int kSlab_e );
 void Hydro_FullStepUpdate( const real g_Input[][ CUBE(FLU_NXT) ], real g_Output[][ CUBE(PS2) ], char g_DE_Status[],
                            const real g_FC_B[][ PS2P1*SQR(PS2) ], const real g_Flux[][NCOMP_TOTAL_PLUS_MAG][ CUBE(N_FC_FLUX) ],
-                           const real dt, const real dh, const real MinDens, const real MinEint,
+                           const real dt, const real dh, const real MinDens, const real MinPres, const real MinEint,
                            const real DualEnergySwitch, const bool NormPassive, const int NNorm, const int NormIdx[],
-                           const EoS_t *EoS );
+                           const EoS_t *EoS, const bool FuseSrc, const double g_Corner[],
+                           const double TimeNew, const double TimeOld, const int kSlab_s, const int kSlab_e );
 #ifdef MHD
 void MHD_ComputeElectric(       real g_EC_Ele[][ CUBE(N_EC_ELE) ],
                           const real g_FC_Flux[][NCOMP_TOTAL_PLUS_MAG][ CUBE(N_FC_FLUX) ],
@@ -137,6 +138,8 @@ void Hydro_TGradientCorrection(       real g_FC_Var   [][NCOMP_TOTAL_PLUS_MAG][
 //                JeansMinPres       : Apply minimum pressure estimated from the Jeans length
 //                JeansMinPres_Coeff : Coefficient used by JeansMinPres = G*(Jeans_NCell*Jeans_dh)^2/(Gamma*pi);
 //                EoS                : EoS object
+//                FuseSrc            : Add the local source terms in Hydro_FullStepUpdate() (for SRC_FUSE_FLUID and CPU only)
+//                TimeNew            : Physical time after update                            (for SRC_FUSE_FLUID and CPU only)
 //-------------------------------------------------------------------------------------------------------
 #ifdef __CUDACC__
 __global__
@@ -191,7 +194,7 @@ void CPU_FluidSolver_CTU(
    const real DualEnergySwitch, const bool NormPassive, const int NNorm,
    const int c_NormIdx[],
    const bool JeansMinPres, const real JeansMinPres_Coeff,
-   const EoS_t EoS )
+   const EoS_t EoS, const bool FuseSrc, const double TimeNew )
 #endif // #ifdef __CUDACC__ ... else ...
 {
 
@@ -209,6 +212,10 @@ void CPU_FluidSolver_CTU(
 #  if ( defined __CUDACC__  &&  !defined GRAVITY )
    const double *c_ExtAcc_AuxArray = NULL;
 #  endif
+#  ifdef __CUDACC__
+   const bool   FuseSrc            = false;
+   const double TimeNew            = NULL_REAL;
+#  endif
 
 
 // openmp pragma for the CPU solver
@@ -255,18 +262,22 @@ void CPU_FluidSolver_CTU(
       for (int P=0; P<NPatchGroup; P++)
 #     endif
       {
+#        ifndef __CUDACC__
+         TRACE_SCOPE( "FluidSolver_PG", -1 );
+#        endif
+
 //       1. evaluate the face-centered values at the half time-step
          Hydro_DataReconstruction( g_Flu_Array_In[P], g_Mag_Array_In[P], g_PriVar_1PG, g_FC_Var_1PG, g_Slope_PPM_1PG,
                                    Con2Pri_Yes, LR_Limiter, MinMod_Coeff, dt, dh,
                                    MinDens, MinPres, MinEint, NormPassive, NNorm, c_NormIdx,
-                                   JeansMinPres, JeansMinPres_Coeff, &EoS );
+                                   JeansMinPres, JeansMinPres_Coeff, &EoS, 0, PS2 );
 
 
 //       2. evaluate the face-centered half-step fluxes by solving the Riemann problem
          Hydro_ComputeFlux( g_FC_Var_1PG, g_FC_Flux_1PG, N_HF_FLUX, 0, 0, CorrHalfVel_No,
                             NULL, NULL, NULL_REAL, NULL_REAL, NULL_REAL,
                             EXT_POT_NONE, EXT_ACC_NONE, NULL, NULL,
-                            MinDens, MinPres, StoreFlux_No, NULL, &EoS );
+                            MinDens, MinPres, StoreFlux_No, NULL, &EoS, 0, PS2 );
 
 
 //       3. evaluate electric field and update B field at the half time-step
@@ -304,7 +315,7 @@ void CPU_FluidSolver_CTU(
          Hydro_ComputeFlux( g_FC_Var_1PG, g_FC_Flux_1PG, N_FL_FLUX, NSkip_N, NSkip_T, CorrHalfVel,
                             g_Pot_Array_USG[P], g_Corner_Array[P], dt, dh, Time,
                             UsePot, ExtAcc, ExtAcc_Func, c_ExtAcc_AuxArray,
-                            MinDens, MinPres, StoreFlux, g_Flux_Array[P], &EoS );
+                            MinDens, MinPres, StoreFlux, g_Flux_Array[P], &EoS, 0, PS2 );
 
 
 //       7. evaluate electric field and update B field at the full time-step
@@ -323,8 +334,8 @@ void CPU_FluidSolver_CTU(
 
 //       8. full-step evolution of the fluid data
          Hydro_FullStepUpdate( g_Flu_Array_In[P], g_Flu_Array_Out[P], g_DE_Array_Out[P], g_Mag_Array_Out[P],
-                               g_FC_Flux_1PG, dt, dh, MinDens, MinEint, DualEnergySwitch,
-                               NormPassive, NNorm, c_NormIdx, &EoS );
+                               g_FC_Flux_1PG, dt, dh, MinDens, MinPres, MinEint, DualEnergySwitch,
+                               NormPassive, NNorm, c_NormIdx, &EoS, FuseSrc, g_Corner_Array[P], TimeNew, Time, 0, PS2 );
 
       } // loop over all patch groups
    } // OpenMP parallel region
@@ -41,7 +41,7 @@ void Hydro_DataReconstruction( const real g_ConVar   [][ CUBE(FLU_NXT) ],
                                const real MinDens, const real MinPres, const real MinEint,
                                const bool NormPassive, const int NNorm, const int NormIdx[],
                                const bool JeansMinPres, const real JeansMinPres_Coeff,
-                               const EoS_t *EoS );
+                               const EoS_t *EoS, const int kSlab_s, const int kSlab_e );
 void Hydro_ComputeFlux( const real g_FC_Var [][NCOMP_TOTAL_PLUS_MAG][ CUBE(N_FC_VAR) ],
                               real g_FC_Flux[][NCOMP_TOTAL_PLUS_MAG][ CUBE(N_FC_FLUX) ],
                         const int NFlux, const int NSkip_N, const int NSkip_T,
@@ -49,12 +49,13 @@ void Hydro_ComputeFlux( const real g_FC_Var [][NCOMP_TOTAL_PLUS_MAG][ CUBE(N_FC_
                         const real dt, const real dh, const double Time, const bool UsePot,
                         const OptExtAcc_t ExtAcc, const ExtAcc_t ExtAcc_Func, const double ExtAcc_AuxArray[],
                         const real MinDens, const real MinPres, const bool DumpIntFlux, real g_IntFlux[][NCOMP_TOTAL][ SQR(PS2) ],
-                        const EoS_t *EoS );
+                        const EoS_t *EoS, const int kSlab_s, const int kSlab_e );
 void Hydro_FullStepUpdate( const real g_Input[][ CUBE(FLU_NXT) ], real g_Output[][ CUBE(PS2) ], char g_DE_Status[],
                            const real g_FC_B[][ PS2P1*SQR(PS2) ], const real g_Flux[][NCOMP_TOTAL_PLUS_MAG][ CUBE(N_FC_FLUX) ],
-                           const real dt, const real dh, const real MinDens, const real MinEint,
+                           const real dt, const real dh, const real MinDens, const real MinPres, const real MinEint,
                            const real DualEnergySwitch, const bool NormPassive, const int NNorm, const int NormIdx[],
-                           const EoS_t *EoS );
+                           const EoS_t *EoS, const bool FuseSrc, const double g_Corner[],
+                           const double TimeNew, const double TimeOld, const int kSlab_s, const int kSlab_e );
 #if   ( RSOLVER == EXACT )
 void Hydro_RiemannSolver_Exact( const int XYZ, real Flux_Out[], const real L_In[], const real R_In[],
                                 const real MinDens, const real MinPres, const EoS_DE2P_t EoS_DensEint2Pres,
@@ -147,6 +148,15 @@ static void Hydro_RiemannPredict( const real g_ConVar_In[][ CUBE(FLU_NXT) ],
 //                4. See include/CUFLU.h for the values and description of different symbolic constants
 //                   such as N_FC_VAR, N_FC_FLUX, N_SLOPE_PPM, N_FL_FLUX, N_HF_VAR
 //                5. Arrays with a prefix "g_" are stored in the global memory of GPU
+//                6. When SlabSize > 0, data reconstruction, full-step fluxes, and full-step evolution are performed
+//                   on one z slab of SlabSize output planes at a time
+//                   --> Only the scratch data required by the target slab are computed so that they are still in
+//                       cache when used by the next stage, which reduces the working set from entire patch groups
+//                       to a few planes
+//                   --> Results are bitwise identical to SlabSize = 0 since each cell is evaluated by the same
+//                       operations
+//                   --> The half-step prediction of MHM_RP is still applied to the entire patch group
+//                   --> Not supported by MHD and GPU since CT requires the fluxes of the entire patch group
 //
 // Parameter   :  g_Flu_Array_In     : Array storing the input fluid variables
 //                g_Flu_Array_Out    : Array to store the output fluid variables
@@ -194,6 +204,10 @@ static void Hydro_RiemannPredict( const real g_ConVar_In[][ CUBE(FLU_NXT) ],
 //                JeansMinPres       : Apply minimum pressure estimated from the Jeans length
 //                JeansMinPres_Coeff : Coefficient used by JeansMinPres = G*(Jeans_NCell*Jeans_dh)^2/(Gamma*pi);
 //                EoS                : EoS object
+//                FuseSrc            : Add the local source terms in Hydro_FullStepUpdate() (for SRC_FUSE_FLUID and CPU only)
+//                TimeNew            : Physical time after update                            (for SRC_FUSE_FLUID and CPU only)
+//                SlabSize           : Number of z planes per slab (for OPT__FLU_SLAB and CPU only)
+//                                     --> <= 0 : update the entire patch group at once
 //-------------------------------------------------------------------------------------------------------
 #ifdef __CUDACC__
 __global__
@@ -248,7 +262,7 @@ void CPU_FluidSolver_MHM(
    const real DualEnergySwitch, const bool NormPassive, const int NNorm,
    const int c_NormIdx[],
    const bool JeansMinPres, const real JeansMinPres_Coeff,
-   const EoS_t EoS )
+   const EoS_t EoS, const bool FuseSrc, const double TimeNew, const int SlabSize )
 #endif // #ifdef __CUDACC__ ... else ...
 {
 
@@ -269,6 +283,15 @@ void CPU_FluidSolver_MHM(
 #  if ( defined __CUDACC__  &&  !defined GRAVITY )
    const double *c_ExtAcc_AuxArray = NULL;
 #  endif
+#  ifdef __CUDACC__
+   const bool   FuseSrc            = false;
+   const double TimeNew            = NULL_REAL;
+#  endif
+#  if ( defined __CUDACC__  ||  defined MHD )
+   const int    NSlab              = PS2;
+#  else
+   const int    NSlab              = ( SlabSize > 0 ) ? MIN( SlabSize, PS2 ) : PS2;
+#  endif
 
 
 // openmp pragma for the CPU solver
@@ -315,14 +338,18 @@ void CPU_FluidSolver_MHM(
       for (int P=0; P<NPatchGroup; P++)
 #     endif
       {
+#        ifndef __CUDACC__
+         TRACE_SCOPE( "FluidSolver_PG", -1 );
+#        endif
 
-//       1. half-step prediction
-//       1-a. MHM_RP: use Riemann solver to calculate the half-step fluxes
+
+//       1. MHM_RP: use Riemann solver to calculate the half-step solutions
+//          --> MHM: face-centered values are advanced by half time-step during the data reconstruction
 #        if ( FLU_SCHEME == MHM_RP )
 
 #        ifdef MHD
-//       1-a-1. evaluate the cell-centered B field and store in g_PriVar[]
-//              --> also copy density and compute velocity for MHD_ComputeElectric()
+//       1-1. evaluate the cell-centered B field and store in g_PriVar[]
+//            --> also copy density and compute velocity for MHD_ComputeElectric()
          real CC_B[NCOMP_MAG];
 
          CGPU_LOOP( idx, CUBE(FLU_NXT) )
@@ -354,12 +381,12 @@ void CPU_FluidSolver_MHM(
 #        endif // #ifdef MHD
 
 
-//       1-a-2. evaluate the half-step first-order fluxes by Riemann solver
+//       1-2. evaluate the half-step first-order fluxes by Riemann solver
          Hydro_RiemannPredict_Flux( g_Flu_Array_In[P], g_Flux_Half_1PG, g_Mag_Array_In[P], g_PriVar_1PG+MAG_OFFSET,
                                     MinDens, MinPres, &EoS );
 
 
-//       1-a-3. evaluate electric field and update B field at the half time-step
+//       1-3. evaluate electric field and update B field at the half time-step
 #        ifdef MHD
          MHD_ComputeElectric( g_EC_Ele_1PG, g_Flux_Half_1PG, g_PriVar_1PG, N_HF_ELE, N_HF_FLUX,
                               FLU_NXT, 0, dt, dh, StoreElectric_No, NULL,
@@ -371,64 +398,73 @@ void CPU_FluidSolver_MHM(
 #        endif
 
 
-//       1-a-4. evaluate the half-step solutions
+//       1-4. evaluate the half-step solutions
          Hydro_RiemannPredict( g_Flu_Array_In[P], g_FC_Mag_Half_1PG, g_Flux_Half_1PG, g_PriVar_Half_1PG,
                                dt, dh, MinDens, MinPres, MinEint, NormPassive, NNorm, c_NormIdx,
                                JeansMinPres, JeansMinPres_Coeff, &EoS );
 
-
-//       1-a-5. evaluate the face-centered values by data reconstruction
-//              --> note that g_PriVar_Half_1PG[] returned by Hydro_RiemannPredict() stores the primitive variables
-         Hydro_DataReconstruction( NULL, g_FC_Mag_Half_1PG, g_PriVar_Half_1PG, g_FC_Var_1PG, g_Slope_PPM_1PG,
-                                   Con2Pri_No, LR_Limiter, MinMod_Coeff, dt, dh,
-                                   MinDens, MinPres, MinEint, NormPassive, NNorm, c_NormIdx,
-                                   JeansMinPres, JeansMinPres_Coeff, &EoS );
-
-
-//       1-b. MHM: use interpolated face-centered values to calculate the half-step fluxes
-#        elif ( FLU_SCHEME == MHM )
-
-//       evaluate the face-centered values by data reconstruction
-         Hydro_DataReconstruction( g_Flu_Array_In[P], NULL, g_PriVar_1PG, g_FC_Var_1PG, g_Slope_PPM_1PG,
-                                   Con2Pri_Yes, LR_Limiter, MinMod_Coeff, dt, dh,
-                                   MinDens, MinPres, MinEint, NormPassive, NNorm, c_NormIdx,
-                                   JeansMinPres, JeansMinPres_Coeff, &EoS );
-
-#        endif // #if ( FLU_SCHEME == MHM_RP ) ... else ...
+#        endif // #if ( FLU_SCHEME == MHM_RP )
 
 
-//       2. evaluate the full-step fluxes
-#        ifdef MHD
-         const int NSkip_N = 0;
-         const int NSkip_T = 0;
-#        else
-         const int NSkip_N = 0;
-         const int NSkip_T = 1;
-#        endif
-         Hydro_ComputeFlux( g_FC_Var_1PG, g_FC_Flux_1PG, N_FL_FLUX, NSkip_N, NSkip_T,
-                            CorrHalfVel, g_Pot_Array_USG[P], g_Corner_Array[P],
-                            dt, dh, Time, UsePot, ExtAcc, ExtAcc_Func, c_ExtAcc_AuxArray,
-                            MinDens, MinPres, StoreFlux, g_Flux_Array[P], &EoS );
-
-
-//       3. evaluate electric field and update B field at the full time-step
-//          --> must update B field before Hydro_FullStepUpdate() since the latter requires
-//              the updated magnetic energy when adopting the dual-energy formalism
-#        ifdef MHD
-         MHD_ComputeElectric( g_EC_Ele_1PG, g_FC_Flux_1PG, g_PriVar_Half_1PG, N_FL_ELE, N_FL_FLUX,
-                              N_HF_VAR, LR_GHOST_SIZE, dt, dh, StoreElectric, g_Ele_Array[P],
-                              CorrHalfVel, g_Pot_Array_USG[P], g_Corner_Array[P], Time,
-                              UsePot, ExtAcc, ExtAcc_Func, c_ExtAcc_AuxArray );
-
-         MHD_UpdateMagnetic( g_Mag_Array_Out[P][0], g_Mag_Array_Out[P][1], g_Mag_Array_Out[P][2],
-                             g_Mag_Array_In[P], g_EC_Ele_1PG, dt, dh, PS2, N_FL_ELE, FLU_GHOST_SIZE );
-#        endif
-
-
-//       4. full-step evolution
-         Hydro_FullStepUpdate( g_Flu_Array_In[P], g_Flu_Array_Out[P], g_DE_Array_Out[P], g_Mag_Array_Out[P],
-                               g_FC_Flux_1PG, dt, dh, MinDens, MinEint, DualEnergySwitch,
-                               NormPassive, NNorm, c_NormIdx, &EoS );
+//       loop over all z slabs (see Note 6)
+         for (int kSlab_s=0; kSlab_s<PS2; kSlab_s+=NSlab)
+         {
+            const int kSlab_e = MIN( kSlab_s+NSlab, PS2 );
+
+
+//          2. evaluate the face-centered values by data reconstruction
+#           if ( FLU_SCHEME == MHM_RP )
+//          2-a. MHM_RP: note that g_PriVar_Half_1PG[] returned by Hydro_RiemannPredict() stores the primitive variables
+            Hydro_DataReconstruction( NULL, g_FC_Mag_Half_1PG, g_PriVar_Half_1PG, g_FC_Var_1PG, g_Slope_PPM_1PG,
+                                      Con2Pri_No, LR_Limiter, MinMod_Coeff, dt, dh,
+                                      MinDens, MinPres, MinEint, NormPassive, NNorm, c_NormIdx,
+                                      JeansMinPres, JeansMinPres_Coeff, &EoS, kSlab_s, kSlab_e );
+
+#           elif ( FLU_SCHEME == MHM )
+//          2-b. MHM: use interpolated face-centered values to calculate the half-step fluxes
+            Hydro_DataReconstruction( g_Flu_Array_In[P], NULL, g_PriVar_1PG, g_FC_Var_1PG, g_Slope_PPM_1PG,
+                                      Con2Pri_Yes, LR_Limiter, MinMod_Coeff, dt, dh,
+                                      MinDens, MinPres, MinEint, NormPassive, NNorm, c_NormIdx,
+                                      JeansMinPres, JeansMinPres_Coeff, &EoS, kSlab_s, kSlab_e );
+
+#           endif // #if ( FLU_SCHEME == MHM_RP ) ... else ...
+
+
+//          3. evaluate the full-step fluxes
+#           ifdef MHD
+            const int NSkip_N = 0;
+            const int NSkip_T = 0;
+#           else
+            const int NSkip_N = 0;
+            const int NSkip_T = 1;
+#           endif
+            Hydro_ComputeFlux( g_FC_Var_1PG, g_FC_Flux_1PG, N_FL_FLUX, NSkip_N, NSkip_T,
+                               CorrHalfVel, g_Pot_Array_USG[P], g_Corner_Array[P],
+                               dt, dh, Time, UsePot, ExtAcc, ExtAcc_Func, c_ExtAcc_AuxArray,
+                               MinDens, MinPres, StoreFlux, g_Flux_Array[P], &EoS, kSlab_s, kSlab_e );
+
+
+//          4. evaluate electric field and update B field at the full time-step
+//             --> must update B field before Hydro_FullStepUpdate() since the latter requires
+//                 the updated magnetic energy when adopting the dual-energy formalism
+//             --> NSlab is always PS2 for MHD
+#           ifdef MHD
+            MHD_ComputeElectric( g_EC_Ele_1PG, g_FC_Flux_1PG, g_PriVar_Half_1PG, N_FL_ELE, N_FL_FLUX,
+                                 N_HF_VAR, LR_GHOST_SIZE, dt, dh, StoreElectric, g_Ele_Array[P],
+                                 CorrHalfVel, g_Pot_Array_USG[P], g_Corner_Array[P], Time,
+                                 UsePot, ExtAcc, ExtAcc_Func, c_ExtAcc_AuxArray );
+
+            MHD_UpdateMagnetic( g_Mag_Array_Out[P][0], g_Mag_Array_Out[P][1], g_Mag_Array_Out[P][2],
+                                g_Mag_Array_In[P], g_EC_Ele_1PG, dt, dh, PS2, N_FL_ELE, FLU_GHOST_SIZE );
+#           endif
+
+
+//          5. full-step evolution
+            Hydro_FullStepUpdate( g_Flu_Array_In[P], g_Flu_Array_Out[P], g_DE_Array_Out[P], g_Mag_Array_Out[P],
+                                  g_FC_Flux_1PG, dt, dh, MinDens, MinPres, MinEint, DualEnergySwitch,
+                                  NormPassive, NNorm, c_NormIdx, &EoS, FuseSrc, g_Corner_Array[P], TimeNew, Time,
+                                  kSlab_s, kSlab_e );
+         } // for (int kSlab_s=0; kSlab_s<PS2; kSlab_s+=NSlab)
 
       } // loop over all patch groups
    } // OpenMP parallel region
@@ -0,0 +1,158 @@
+#include "CUFLU.h"
+
+#ifdef SUPPORT_FLU_SUPER_BLOCK
+
+
+
+// redefine the block size so that the following CPU hydro solver is compiled for super-blocks
+// --> a super-block consists of 2x2x2 patch groups sharing the same ghost zones
+// --> all other array sizes (e.g., FLU_NXT, N_FC_VAR, N_FC_FLUX, N_SLOPE_PPM, USG_NXT_F) are derived from PS2
+//     and are thus redefined accordingly
+// --> PS1 is redefined as half the block size so that the solver stores the fluxes across the boundaries
+//     of individual patch groups (i.e., i/j/k = 0, PS2/2, PS2 of a super-block)
+// --> the solver and all its shared routines are compiled in the namespace "SuperBlock" to avoid conflicting
+//     with the regular patch-group solver
+#undef  PS1
+#undef  PS2
+#undef  PS2P1
+#define PS1       ( FLU_SB_PS2/2 )
+#define PS2       ( FLU_SB_PS2 )
+#define PS2P1     ( PS2 + 1 )
+
+#if ( FLU_NXT != FLU_SB_NXT  ||  USG_NXT_F != USG_SB_NXT_F )
+#  error : ERROR : inconsistent super-block size !!
+#endif
+
+namespace SuperBlock
+{
+#include "CPU_Shared_FluUtility.cpp"
+#include "CPU_Shared_DualEnergy.cpp"
+#include "CPU_Shared_DataReconstruction.cpp"
+#include "CPU_Shared_RiemannSolver_Exact.cpp"
+#include "CPU_Shared_RiemannSolver_Roe.cpp"
+#include "CPU_Shared_RiemannSolver_HLLE.cpp"
+#include "CPU_Shared_RiemannSolver_HLLC.cpp"
+#include "CPU_Shared_ComputeFlux.cpp"
+#include "CPU_Shared_FullStepUpdate.cpp"
+#if ( FLU_SCHEME == CTU )
+#include "CPU_FluidSolver_CTU.cpp"
+#else
+#include "CPU_FluidSolver_MHM.cpp"
+#endif
+} // namespace SuperBlock
+
+
+#ifndef GRAVITY
+static double  *ExtAcc_AuxArray = NULL;
+static ExtAcc_t CPUExtAcc_Ptr   = NULL;
+#endif
+
+
+// scratch arrays of the super-block solver (one for each OpenMP thread)
+static real (*SB_PriVar)      [NCOMP_LR            ][ CUBE(FLU_NXT)     ] = NULL;
+static real (*SB_Slope_PPM)[3][NCOMP_LR            ][ CUBE(N_SLOPE_PPM) ] = NULL;
+static real (*SB_FC_Var)   [6][NCOMP_TOTAL_PLUS_MAG][ CUBE(N_FC_VAR)    ] = NULL;
+static real (*SB_FC_Flux)  [3][NCOMP_TOTAL_PLUS_MAG][ CUBE(N_FC_FLUX)   ] = NULL;
+
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  CPU_FluidSolver_SuperBlock
+// Description :  Invoke the CPU MHM/MHM_RP/CTU fluid solver compiled for super-blocks of 2x2x2 patch groups
+//
+// Note        :  1. Invoked by Flu_SuperBlock()
+//                2. Identical to CPU_FluidSolver() except that the array sizes are FLU_SB_NXT/FLU_SB_PS2/USG_SB_NXT_F
+//                   instead of FLU_NXT/PS2/USG_NXT_F
+//                   --> Only the fluxes across the patch-group boundaries (i.e., i/j/k = 0, FLU_SB_PS2/2, FLU_SB_PS2)
+//                       are stored in Flux_Array[]
+//                3. Scratch arrays must be allocated by CPU_FluidSolver_SuperBlock_MemAllocate() in advance
+//
+// Parameter   :  See CPU_FluidSolver()
+//                NBlock : Number of super-blocks to be evaluated
+//-------------------------------------------------------------------------------------------------------
+void CPU_FluidSolver_SuperBlock( const real   Flu_Array_In [][NCOMP_TOTAL][ CUBE(FLU_SB_NXT) ],
+                                       real   Flu_Array_Out[][NCOMP_TOTAL][ CUBE(FLU_SB_PS2) ],
+                                       char   DE_Array_Out [][ CUBE(FLU_SB_PS2) ],
+                                       real   Flux_Array   [][9][NCOMP_TOTAL][ SQR(FLU_SB_PS2) ],
+                                 const double Corner_Array [][3],
+                                 const real   Pot_Array_USG[][ CUBE(USG_SB_NXT_F) ],
+                                 const int NBlock, const real dt, const real dh, const bool StoreFlux,
+                                 const LR_Limiter_t LR_Limiter, const real MinMod_Coeff, const double Time,
+                                 const bool UsePot, const OptExtAcc_t ExtAcc,
+                                 const real MinDens, const real MinPres, const real MinEint,
+                                 const real DualEnergySwitch, const bool NormPassive, const int NNorm,
+                                 const int NormIdx[], const bool JeansMinPres, const real JeansMinPres_Coeff,
+                                 const bool FuseSrc, const double TimeNew, const int SlabSize )
+{
+
+// check
+#  ifdef GAMER_DEBUG
+   if ( SB_FC_Var == NULL )   Aux_Error( ERROR_INFO, "super-block scratch arrays have not been allocated !!\n" );
+#  endif
+
+
+   const bool StoreElectric_No = false;
+
+#  if   ( FLU_SCHEME == MHM  ||  FLU_SCHEME == MHM_RP )
+   SuperBlock::CPU_FluidSolver_MHM( Flu_Array_In, Flu_Array_Out, NULL, NULL,
+                                    DE_Array_Out, Flux_Array, NULL, Corner_Array, Pot_Array_USG,
+                                    SB_PriVar, SB_Slope_PPM, SB_FC_Var, SB_FC_Flux, NULL, NULL,
+                                    NBlock, dt, dh, StoreFlux, StoreElectric_No, LR_Limiter, MinMod_Coeff, Time,
+                                    UsePot, ExtAcc, CPUExtAcc_Ptr, ExtAcc_AuxArray, MinDens, MinPres, MinEint,
+                                    DualEnergySwitch, NormPassive, NNorm, NormIdx, JeansMinPres, JeansMinPres_Coeff, EoS,
+                                    FuseSrc, TimeNew, SlabSize );
+#  elif ( FLU_SCHEME == CTU )
+   SuperBlock::CPU_FluidSolver_CTU( Flu_Array_In, Flu_Array_Out, NULL, NULL,
+                                    DE_Array_Out, Flux_Array, NULL, Corner_Array, Pot_Array_USG,
+                                    SB_PriVar, SB_Slope_PPM, SB_FC_Var, SB_FC_Flux, NULL, NULL,
+                                    NBlock, dt, dh, StoreFlux, StoreElectric_No, LR_Limiter, MinMod_Coeff, Time,
+                                    UsePot, ExtAcc, CPUExtAcc_Ptr, ExtAcc_AuxArray, MinDens, MinPres, MinEint,
+                                    DualEnergySwitch, NormPassive, NNorm, NormIdx, JeansMinPres, JeansMinPres_Coeff, EoS,
+                                    FuseSrc, TimeNew );
+#  endif
+
+} // FUNCTION : CPU_FluidSolver_SuperBlock
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  CPU_FluidSolver_SuperBlock_MemAllocate
+// Description :  Allocate the scratch arrays of the super-block solver
+//
+// Note        :  1. One set of arrays for each OpenMP thread
+//                2. Invoked by Flu_SuperBlock_MemAllocate()
+//
+// Parameter   :  NThread : Number of OpenMP threads
+//-------------------------------------------------------------------------------------------------------
+void CPU_FluidSolver_SuperBlock_MemAllocate( const int NThread )
+{
+
+   SB_FC_Var    = new real [NThread][6][NCOMP_TOTAL_PLUS_MAG][ CUBE(N_FC_VAR)    ];
+   SB_FC_Flux   = new real [NThread][3][NCOMP_TOTAL_PLUS_MAG][ CUBE(N_FC_FLUX)   ];
+   SB_PriVar    = new real [NThread]   [NCOMP_LR            ][ CUBE(FLU_NXT)     ];
+#  if ( LR_SCHEME == PPM )
+   SB_Slope_PPM = new real [NThread][3][NCOMP_LR            ][ CUBE(N_SLOPE_PPM) ];
+#  endif
+
+} // FUNCTION : CPU_FluidSolver_SuperBlock_MemAllocate
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  CPU_FluidSolver_SuperBlock_MemFree
+// Description :  Free the scratch arrays allocated by CPU_FluidSolver_SuperBlock_MemAllocate()
+//-------------------------------------------------------------------------------------------------------
+void CPU_FluidSolver_SuperBlock_MemFree()
+{
+
+   delete [] SB_FC_Var;       SB_FC_Var    = NULL;
+   delete [] SB_FC_Flux;      SB_FC_Flux   = NULL;
+   delete [] SB_PriVar;       SB_PriVar    = NULL;
+   delete [] SB_Slope_PPM;    SB_Slope_PPM = NULL;
+
+} // FUNCTION : CPU_FluidSolver_SuperBlock_MemFree
+
+
+
+#endif // #ifdef SUPPORT_FLU_SUPER_BLOCK
@@ -100,6 +100,10 @@ void Hydro_RiemannSolver_HLLD( const int XYZ, real Flux_Out[], const real L_In[]
 //                DumpIntFlux     : true --> store the inter-patch fluxes in g_IntFlux[]
 //                g_IntFlux       : Array for DumpIntFlux
 //                EoS             : EoS object
+//                kSlab_s/e       : Only compute the fluxes required by the output z slab [kSlab_s, kSlab_e)
+//                                  (for OPT__FLU_SLAB)
+//                                  --> Set to 0/PS2 to compute all fluxes
+//                                  --> See SLAB_PLANE_S/E() in CUFLU.h
 //-------------------------------------------------------------------------------------------------------
 GPU_DEVICE
 void Hydro_ComputeFlux( const real g_FC_Var [][NCOMP_TOTAL_PLUS_MAG][ CUBE(N_FC_VAR) ],
@@ -110,7 +114,7 @@ void Hydro_ComputeFlux( const real g_FC_Var [][NCOMP_TOTAL_PLUS_MAG][ CUBE(N_FC_
                         const OptExtAcc_t ExtAcc, const ExtAcc_t ExtAcc_Func, const double ExtAcc_AuxArray[],
                         const real MinDens, const real MinPres, const bool DumpIntFlux,
                         real g_IntFlux[][NCOMP_TOTAL][ SQR(PS2) ],
-                        const EoS_t *EoS )
+                        const EoS_t *EoS, const int kSlab_s, const int kSlab_e )
 {
 
 // check
@@ -204,11 +208,14 @@ void Hydro_ComputeFlux( const real g_FC_Var [][NCOMP_TOTAL_PLUS_MAG][ CUBE(N_FC_
       }
 
       const int size_ij = idx_flux_e[0]*idx_flux_e[1];
-      CGPU_LOOP( idx, idx_flux_e[0]*idx_flux_e[1]*idx_flux_e[2] )
+      const int kFlux_s = SLAB_PLANE_S( kSlab_s, idx_flux_e[2] );
+      const int kFlux_e = SLAB_PLANE_E( kSlab_e, idx_flux_e[2] );
+
+      CGPU_LOOP( idx, size_ij*(kFlux_e-kFlux_s) )
       {
          const int i_flux   = idx % idx_flux_e[0];
          const int j_flux   = idx % size_ij / idx_flux_e[0];
-         const int k_flux   = idx / size_ij;
+         const int k_flux   = idx / size_ij + kFlux_s;
          const int idx_flux = IDX321( i_flux, j_flux, k_flux, NFlux, NFlux );
 
          const int i_fc     = i_flux + idx_fc_s[0];
@@ -145,6 +145,10 @@ static void Hydro_Char2Pri( real InOut[], const real Dens, const real Pres, cons
 //                JeansMinPres       : Apply minimum pressure estimated from the Jeans length
 //                JeansMinPres_Coeff : Coefficient used by JeansMinPres = G*(Jeans_NCell*Jeans_dh)^2/(Gamma*pi);
 //                EoS                : EoS object
+//                kSlab_s/e          : Only reconstruct the data required by the output z slab [kSlab_s, kSlab_e)
+//                                     (for OPT__FLU_SLAB)
+//                                     --> Set to 0/PS2 to reconstruct the entire patch group
+//                                     --> See SLAB_PLANE_S/E() in CUFLU.h
 //------------------------------------------------------------------------------------------------------
 GPU_DEVICE
 void Hydro_DataReconstruction( const real g_ConVar   [][ CUBE(FLU_NXT) ],
@@ -157,7 +161,7 @@ void Hydro_DataReconstruction( const real g_ConVar   [][ CUBE(FLU_NXT) ],
                                const real MinDens, const real MinPres, const real MinEint,
                                const bool NormPassive, const int NNorm, const int NormIdx[],
                                const bool JeansMinPres, const real JeansMinPres_Coeff,
-                               const EoS_t *EoS )
+                               const EoS_t *EoS, const int kSlab_s, const int kSlab_e )
 {
 
 //### NOTE: temporary solution to the bug in cuda 10.1 and 10.2 that incorrectly overwrites didx_cc[]
@@ -266,8 +270,14 @@ void Hydro_DataReconstruction( const real g_ConVar   [][ CUBE(FLU_NXT) ],
       real* const EintPtr = NULL;
 #     endif
 
-      CGPU_LOOP( idx, CUBE(NIn) )
+      const int NIn2   = SQR( NIn );
+      const int kPri_s = SLAB_PLANE_S( kSlab_s, NIn );
+      const int kPri_e = SLAB_PLANE_E( kSlab_e, NIn );
+
+      CGPU_LOOP( t, (kPri_e-kPri_s)*NIn2 )
       {
+         const int idx = t + kPri_s*NIn2;
+
          for (int v=0; v<NCOMP_TOTAL; v++)   ConVar_1Cell[v] = g_ConVar[v][idx];
 
 #        ifdef MHD
@@ -289,7 +299,7 @@ void Hydro_DataReconstruction( const real g_ConVar   [][ CUBE(FLU_NXT) ],
 #        ifdef LR_EINT
          g_PriVar[NCOMP_TOTAL_PLUS_MAG][idx] = Hydro_CheckMinEint( Eint, MinEint ); // store Eint in the last variable
 #        endif
-      } // CGPU_LOOP( idx, CUBE(NIn) )
+      } // CGPU_LOOP( t, (kPri_e-kPri_s)*NIn2 )
 
 #     ifdef __CUDACC__
       __syncthreads();
@@ -303,9 +313,13 @@ void Hydro_DataReconstruction( const real g_ConVar   [][ CUBE(FLU_NXT) ],
    const int NIn_p1    = NIn + 1;
    int idx_B[NCOMP_MAG];
 #  endif
+   const int kFC_s     = SLAB_PLANE_S( kSlab_s, N_FC_VAR );
+   const int kFC_e     = SLAB_PLANE_E( kSlab_e, N_FC_VAR );
 
-   CGPU_LOOP( idx_fc, CUBE(N_FC_VAR) )
+   CGPU_LOOP( t, (kFC_e-kFC_s)*N_FC_VAR2 )
    {
+      const int idx_fc = t + kFC_s*N_FC_VAR2;
+
       const int i_cc   = NGhost + idx_fc%N_FC_VAR;
       const int j_cc   = NGhost + idx_fc%N_FC_VAR2/N_FC_VAR;
       const int k_cc   = NGhost + idx_fc/N_FC_VAR2;
@@ -620,7 +634,7 @@ void Hydro_DataReconstruction( const real g_ConVar   [][ CUBE(FLU_NXT) ],
       for (int v=0; v<NCOMP_TOTAL_PLUS_MAG; v++)
          g_FC_Var[f][v][idx_fc] = fc[f][v];
 
-   } // CGPU_LOOP( idx_fc, CUBE(N_FC_VAR) )
+   } // CGPU_LOOP( t, (kFC_e-kFC_s)*N_FC_VAR2 )
 
 
 #  ifdef __CUDACC__
@@ -652,7 +666,7 @@ void Hydro_DataReconstruction( const real g_ConVar   [][ CUBE(FLU_NXT) ],
                                const real MinDens, const real MinPres, const real MinEint,
                                const bool NormPassive, const int NNorm, const int NormIdx[],
                                const bool JeansMinPres, const real JeansMinPres_Coeff,
-                               const EoS_t *EoS )
+                               const EoS_t *EoS, const int kSlab_s, const int kSlab_e )
 {
 
 //### NOTE: temporary solution to the bug in cuda 10.1 and 10.2 that incorrectly overwrites didx_cc[]
@@ -775,8 +789,14 @@ void Hydro_DataReconstruction( const real g_ConVar   [][ CUBE(FLU_NXT) ],
       real* const EintPtr = NULL;
 #     endif
 
-      CGPU_LOOP( idx, CUBE(NIn) )
+      const int NIn2   = SQR( NIn );
+      const int kPri_s = SLAB_PLANE_S( kSlab_s, NIn );
+      const int kPri_e = SLAB_PLANE_E( kSlab_e, NIn );
+
+      CGPU_LOOP( t, (kPri_e-kPri_s)*NIn2 )
       {
+         const int idx = t + kPri_s*NIn2;
+
          for (int v=0; v<NCOMP_TOTAL; v++)   ConVar_1Cell[v] = g_ConVar[v][idx];
 
 #        ifdef MHD
@@ -798,7 +818,7 @@ void Hydro_DataReconstruction( const real g_ConVar   [][ CUBE(FLU_NXT) ],
 #        ifdef LR_EINT
          g_PriVar[NCOMP_TOTAL_PLUS_MAG][idx] = Hydro_CheckMinEint( Eint, MinEint ); // store Eint in the last variable
 #        endif
-      } // CGPU_LOOP( idx, CUBE(NIn) )
+      } // CGPU_LOOP( t, (kPri_e-kPri_s)*NIn2 )
 
 #     ifdef __CUDACC__
       __syncthreads();
@@ -808,8 +828,12 @@ void Hydro_DataReconstruction( const real g_ConVar   [][ CUBE(FLU_NXT) ],
 
 // 1. evaluate the monotonic slope of all cells
    const int N_SLOPE_PPM2 = SQR( N_SLOPE_PPM );
-   CGPU_LOOP( idx_slope, CUBE(N_SLOPE_PPM) )
+   const int kSlope_s     = SLAB_PLANE_S( kSlab_s, N_SLOPE_PPM );
+   const int kSlope_e     = SLAB_PLANE_E( kSlab_e, N_SLOPE_PPM );
+
+   CGPU_LOOP( t, (kSlope_e-kSlope_s)*N_SLOPE_PPM2 )
    {
+      const int idx_slope = t + kSlope_s*N_SLOPE_PPM2;
       const int i_cc   = NGhost - 1 + idx_slope%N_SLOPE_PPM;
       const int j_cc   = NGhost - 1 + idx_slope%N_SLOPE_PPM2/N_SLOPE_PPM;
       const int k_cc   = NGhost - 1 + idx_slope/N_SLOPE_PPM2;
@@ -843,7 +867,7 @@ void Hydro_DataReconstruction( const real g_ConVar   [][ CUBE(FLU_NXT) ],
          for (int v=0; v<NCOMP_LR; v++)   g_Slope_PPM[d][v][idx_slope] = Slope_Limiter[v];
 
       } // for (int d=0; d<3; d++)
-   } // CGPU_LOOP( idx_slope, CUBE(N_SLOPE_PPM) )
+   } // CGPU_LOOP( t, (kSlope_e-kSlope_s)*N_SLOPE_PPM2 )
 
 #  ifdef __CUDACC__
    __syncthreads();
@@ -856,9 +880,13 @@ void Hydro_DataReconstruction( const real g_ConVar   [][ CUBE(FLU_NXT) ],
    const int NIn_p1    = NIn + 1;
    int idx_B[NCOMP_MAG];
 #  endif
+   const int kFC_s     = SLAB_PLANE_S( kSlab_s, N_FC_VAR );
+   const int kFC_e     = SLAB_PLANE_E( kSlab_e, N_FC_VAR );
 
-   CGPU_LOOP( idx_fc, CUBE(N_FC_VAR) )
+   CGPU_LOOP( t, (kFC_e-kFC_s)*N_FC_VAR2 )
    {
+      const int idx_fc = t + kFC_s*N_FC_VAR2;
+
       const int i_fc      = idx_fc%N_FC_VAR;
       const int j_fc      = idx_fc%N_FC_VAR2/N_FC_VAR;
       const int k_fc      = idx_fc/N_FC_VAR2;
@@ -1202,7 +1230,7 @@ void Hydro_DataReconstruction( const real g_ConVar   [][ CUBE(FLU_NXT) ],
       for (int v=0; v<NCOMP_TOTAL_PLUS_MAG; v++)
          g_FC_Var[f][v][idx_fc] = fc[f][v];
 
-   } // CGPU_LOOP( idx_fc, CUBE(N_FC_VAR) )
+   } // CGPU_LOOP( t, (kFC_e-kFC_s)*N_FC_VAR2 )
 
 
 #  ifdef __CUDACC__
@@ -31,6 +31,8 @@
 //
 // Note        :  1. This function is shared by MHM, MHM_RP, and CTU schemes
 //                2. Invoke dual-energy check if DualEnergySwitch is on
+//                3. Add the local source terms by Src_FuseFluid() if FuseSrc is on (for SRC_FUSE_FLUID)
+//                   --> Only supported by the CPU solvers
 //
 // Parameter   :  g_Input          : Array storing the input fluid data
 //                g_Output         : Array to store the updated fluid data
@@ -43,6 +45,7 @@
 //                dt               : Time interval to advance solution
 //                dh               : Cell size
 //                MinDens/Eint     : Density and internal energy floors
+//                MinPres          : Pressure floor (only used when FuseSrc is on)
 //                DualEnergySwitch : Use the dual-energy formalism if E_int/E_kin < DualEnergySwitch
 //                NormPassive      : true --> normalize passive scalars so that the sum of their mass density
 //                                            is equal to the gas mass density
@@ -52,13 +55,20 @@
 //                                   --> Should be set to the global variable "PassiveNorm_VarIdx"
 //                EoS              : EoS object
 //                                   --> Only for obtaining Gamma used by the dual-energy formalism
+//                FuseSrc          : Add the local source terms to the updated data (for SRC_FUSE_FLUID)
+//                g_Corner         : Physical coordinates of the first interior cell of the patch group
+//                                   --> Only used when FuseSrc is on
+//                TimeNew/Old      : Physical time after/before update (only used when FuseSrc is on)
+//                kSlab_s/e        : Only update the output z slab [kSlab_s, kSlab_e) (for OPT__FLU_SLAB)
+//                                   --> Set to 0/PS2 to update the entire patch group
 //-------------------------------------------------------------------------------------------------------
 GPU_DEVICE
 void Hydro_FullStepUpdate( const real g_Input[][ CUBE(FLU_NXT) ], real g_Output[][ CUBE(PS2) ], char g_DE_Status[],
                            const real g_FC_B[][ PS2P1*SQR(PS2) ], const real g_Flux[][NCOMP_TOTAL_PLUS_MAG][ CUBE(N_FC_FLUX) ],
-                           const real dt, const real dh, const real MinDens, const real MinEint,
+                           const real dt, const real dh, const real MinDens, const real MinPres, const real MinEint,
                            const real DualEnergySwitch, const bool NormPassive, const int NNorm, const int NormIdx[],
-                           const EoS_t *EoS )
+                           const EoS_t *EoS, const bool FuseSrc, const double g_Corner[],
+                           const double TimeNew, const double TimeOld, const int kSlab_s, const int kSlab_e )
 {
 
    const int  didx_flux[3] = { 1, N_FL_FLUX, SQR(N_FL_FLUX) };
@@ -68,8 +78,9 @@ void Hydro_FullStepUpdate( const real g_Input[][ CUBE(FLU_NXT) ], real g_Output[
 
 
    const int size_ij = SQR(PS2);
-   CGPU_LOOP( idx_out, CUBE(PS2) )
+   CGPU_LOOP( t, (kSlab_e-kSlab_s)*size_ij )
    {
+      const int idx_out  = t + kSlab_s*size_ij;
       const int i_out    = idx_out % PS2;
       const int j_out    = idx_out % size_ij / PS2;
       const int k_out    = idx_out / size_ij;
@@ -160,11 +171,32 @@ void Hydro_FullStepUpdate( const real g_Input[][ CUBE(FLU_NXT) ], real g_Output[
 #     endif // #ifdef DUAL_ENERGY
 
 
-//    4. store results to the output array
+//    4. add the local source terms while the updated data are still at hand
+//    --> cells recomputed with the 1st-order fluxes in Flu_Close()->CorrectUnphysical() will add them again
+#     ifndef __CUDACC__
+      if ( FuseSrc )
+      {
+         const double x = g_Corner[0] + i_out*dh;
+         const double y = g_Corner[1] + j_out*dh;
+         const double z = g_Corner[2] + k_out*dh;
+
+#        ifdef MHD
+         real B[NCOMP_MAG];
+         MHD_GetCellCenteredBField( B, g_FC_B[MAGX], g_FC_B[MAGY], g_FC_B[MAGZ], PS2, PS2, PS2, i_out, j_out, k_out );
+#        else
+         real *B = NULL;
+#        endif
+
+         Src_FuseFluid( Output_1Cell, B, dt, dh, x, y, z, TimeNew, TimeOld, MinDens, MinPres, MinEint );
+      }
+#     endif
+
+
+//    5. store results to the output array
       for (int v=0; v<NCOMP_TOTAL; v++)   g_Output[v][idx_out] = Output_1Cell[v];
 
 
-//    5. check the negative density and energy
+//    6. check the negative density and energy
 #     ifdef CHECK_NEGATIVE_IN_FLUID
       if ( Hydro_CheckNegative(Output_1Cell[DENS]) )
          printf( "WARNING : invalid density (%14.7e) at file <%s>, line <%d>, function <%s>\n",
@@ -175,7 +207,7 @@ void Hydro_FullStepUpdate( const real g_Input[][ CUBE(FLU_NXT) ], real g_Output[
                  Output_1Cell[ENGY], __FILE__, __LINE__, __FUNCTION__ );
 #     endif
 
-   } // CGPU_LOOP( idx_out, CUBE(PS2) )
+   } // CGPU_LOOP( t, (kSlab_e-kSlab_s)*size_ij )
 
 } // FUNCTION : Hydro_FullStepUpdate
 
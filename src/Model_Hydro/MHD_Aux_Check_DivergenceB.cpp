@@ -48,7 +48,7 @@ void MHD_Aux_Check_DivergenceB( const bool Verbose, const char *comment )
 //          we check both leaf and non-leaf patches
             for (int PID=0; PID<amr->NPatchComma[lv][1]; PID++)
             {
-               const real (*B)[PS1P1*PS1*PS1] = amr->patch[MagSg][lv][PID]->magnetic;
+               const real_store (*B)[PS1P1*PS1*PS1] = amr->patch[MagSg][lv][PID]->magnetic;
 
                for (int k=0; k<PS1; k++)
                for (int j=0; j<PS1; j++)
@@ -5,6 +5,42 @@
 
 
 
+#ifdef MIXED_PRECISION
+//-------------------------------------------------------------------------------------------------------
+// Function    :  GetAdjacentFaceB
+// Description :  Convert the face-centered magnetic field adjacent to a given cell to real
+//
+// Note        :  1. Only used by MIXED_PRECISION, for which the patch data are stored in real_store
+//                2. Returned arrays can be passed to MHD_GetCellCenteredBField/Energy() as 1x1x1 arrays
+//                   with i=j=k=0
+//
+// Parameter   :  Bx/y/z_FC : Face-centered B field to be returned (each with two elements)
+//                lv        : Target AMR level
+//                PID       : Target patch index
+//                i/j/k     : Target array indices of the patch
+//                MagSg     : Sandglass of the magnetic field data
+//
+// Return      :  Bx_FC, By_FC, Bz_FC
+//-------------------------------------------------------------------------------------------------------
+static void GetAdjacentFaceB( real Bx_FC[], real By_FC[], real Bz_FC[], const int lv, const int PID,
+                              const int i, const int j, const int k, const int MagSg )
+{
+
+   const real_store (*B)[PS1P1*PS1*PS1] = amr->patch[MagSg][lv][PID]->magnetic;
+
+   const int idx_Bx = IDX321_BX( i, j, k, PS1, PS1 );
+   const int idx_By = IDX321_BY( i, j, k, PS1, PS1 );
+   const int idx_Bz = IDX321_BZ( i, j, k, PS1, PS1 );
+
+   Bx_FC[0] = B[MAGX][idx_Bx];   Bx_FC[1] = B[MAGX][ idx_Bx + 1        ];
+   By_FC[0] = B[MAGY][idx_By];   By_FC[1] = B[MAGY][ idx_By + PS1      ];
+   Bz_FC[0] = B[MAGZ][idx_Bz];   Bz_FC[1] = B[MAGZ][ idx_Bz + SQR(PS1) ];
+
+} // FUNCTION : GetAdjacentFaceB
+#endif // #ifdef MIXED_PRECISION
+
+
+
 //-------------------------------------------------------------------------------------------------------
 // Function    :  MHD_GetCellCenteredBFieldInPatch
 // Description :  Calculate the cell-centered magnetic field from the face-centered values of a given cell
@@ -44,11 +80,19 @@ void MHD_GetCellCenteredBFieldInPatch( real B_CC[], const int lv, const int PID,
 
 
 // FC = face-centered
+#  ifdef MIXED_PRECISION
+   real Bx_FC[2], By_FC[2], Bz_FC[2];
+
+   GetAdjacentFaceB( Bx_FC, By_FC, Bz_FC, lv, PID, i, j, k, MagSg );
+
+   MHD_GetCellCenteredBField( B_CC, Bx_FC, By_FC, Bz_FC, 1, 1, 1, 0, 0, 0 );
+#  else
    const real *Bx_FC = amr->patch[MagSg][lv][PID]->magnetic[MAGX];
    const real *By_FC = amr->patch[MagSg][lv][PID]->magnetic[MAGY];
    const real *Bz_FC = amr->patch[MagSg][lv][PID]->magnetic[MAGZ];
 
    MHD_GetCellCenteredBField( B_CC, Bx_FC, By_FC, Bz_FC, PS1, PS1, PS1, i, j, k );
+#  endif
 
 } // FUNCTION : MHD_GetCellCenteredBFieldInPatch
 
@@ -91,11 +135,19 @@ real MHD_GetCellCenteredBEnergyInPatch( const int lv, const int PID, const int i
 
 
 // FC = face-centered
+#  ifdef MIXED_PRECISION
+   real Bx_FC[2], By_FC[2], Bz_FC[2];
+
+   GetAdjacentFaceB( Bx_FC, By_FC, Bz_FC, lv, PID, i, j, k, MagSg );
+
+   return MHD_GetCellCenteredBEnergy( Bx_FC, By_FC, Bz_FC, 1, 1, 1, 0, 0, 0 );
+#  else
    const real *Bx_FC = amr->patch[MagSg][lv][PID]->magnetic[MAGX];
    const real *By_FC = amr->patch[MagSg][lv][PID]->magnetic[MAGY];
    const real *Bz_FC = amr->patch[MagSg][lv][PID]->magnetic[MAGZ];
 
    return MHD_GetCellCenteredBEnergy( Bx_FC, By_FC, Bz_FC, PS1, PS1, PS1, i, j, k );
+#  endif
 
 } // FUNCTION : MHD_GetCellCenteredBEnergyInPatch
 
@@ -69,7 +69,7 @@ Procedure for outputting new variables:
 
 
 //-------------------------------------------------------------------------------------------------------
-// Function    :  Output_DumpData_Total_HDF5 (FormatVersion = 2429)
+// Function    :  Output_DumpData_Total_HDF5 (FormatVersion = 2442)
 // Description :  Output all simulation data in the HDF5 format, which can be used as a restart file
 //                or loaded by YT
 //
@@ -200,6 +200,19 @@ Procedure for outputting new variables:
 //                2427 : 2020/12/26 --> output SRC_BLOCK_SIZE and SRC_GHOST_SIZE
 //                2428 : 2020/12/27 --> output SRC_NAUX_DLEP and SRC_NAUX_USER
 //                2429 : 2021/01/26 --> output SRC_DLEP_PROF_NVAR and SRC_DLEP_PROF_NBINMAX
+//                2430 : 2026/10/19 --> output OPT__TIMING_TRACE and OPT__TIMING_TRACE_NEVENT
+//                2431 : 2026/10/19 --> output OPT__TIMING_PERF and OPT__TIMING_PERF_RAW
+//                2432 : 2026/10/19 --> output AUTO_REDUCE_DT_LOCAL
+//                2433 : 2026/10/19 --> output OPT__FLU_SUPER_BLOCK
+//                2434 : 2026/10/19 --> output MIXED_PRECISION
+//                2435 : 2026/10/19 --> output OPT__SINGLE_SANDGLASS
+//                2436 : 2026/10/19 --> output the parameters of EOS_TABULAR
+//                2437 : 2026/10/19 --> output SRC_NAUX_COOL and the parameters of SRC_COOLING
+//                2438 : 2026/10/19 --> output SRC_FUSE_FLUID
+//                2439 : 2026/10/19 --> output OPT__FLU_SLAB
+//                2440 : 2026/10/19 --> output OPT__LB_ALL_LEVEL
+//                2441 : 2026/10/19 --> output OPT__LB_INCREMENTAL and OPT__LB_INC_MAX_SHIFT
+//                2442 : 2026/10/19 --> output OPT__LB_SPARSE_COMM
 //-------------------------------------------------------------------------------------------------------
 void Output_DumpData_Total_HDF5( const char *FileName )
 {
@@ -740,13 +753,13 @@ void Output_DumpData_Total_HDF5( const char *FileName )
 
 
 // 5. output the simulation grid data (density, momentum, ... etc)
-   const int FieldSizeOnePatch = sizeof(real)*CUBE(PS1);
+   const int FieldSizeOnePatch = CUBE(PS1);
    int  NFieldOut;
    char (*FieldName)[MAX_STRING]     = NULL;
    real (*FieldData)[PS1][PS1][PS1]  = NULL;
 
 #  ifdef MHD
-   const int FCMagSizeOnePatch = sizeof(real)*PS1P1*SQR(PS1);
+   const int FCMagSizeOnePatch = PS1P1*SQR(PS1);
    char FCMagName[NCOMP_MAG][MAX_STRING];
    real (*FCMagData)[PS1P1*SQR(PS1)] = NULL;
 #  endif
@@ -946,7 +959,7 @@ void Output_DumpData_Total_HDF5( const char *FileName )
                if ( v == PotDumpIdx )
                {
                   for (int PID=0; PID<amr->NPatchComma[lv][1]; PID++)
-                     memcpy( FieldData[PID], amr->patch[ amr->PotSg[lv] ][lv][PID]->pot, FieldSizeOnePatch );
+                     Mis_CopyArray( FieldData[PID][0][0], amr->patch[ amr->PotSg[lv] ][lv][PID]->pot[0][0], FieldSizeOnePatch );
                }
                else
 #              endif
@@ -994,7 +1007,7 @@ void Output_DumpData_Total_HDF5( const char *FileName )
 //             d. fluid variables
                {
                   for (int PID=0; PID<amr->NPatchComma[lv][1]; PID++)
-                     memcpy( FieldData[PID], amr->patch[ amr->FluSg[lv] ][lv][PID]->fluid[v], FieldSizeOnePatch );
+                     Mis_CopyArray( FieldData[PID][0][0], amr->patch[ amr->FluSg[lv] ][lv][PID]->fluid[v][0][0], FieldSizeOnePatch );
                }
 
 
@@ -1057,7 +1070,7 @@ void Output_DumpData_Total_HDF5( const char *FileName )
 
 //             5-3-2-3. collect the target B component from all patches at the current target level
                for (int PID=0; PID<amr->NPatchComma[lv][1]; PID++)
-                  memcpy( FCMagData[PID], amr->patch[ amr->MagSg[lv] ][lv][PID]->magnetic[v], FCMagSizeOnePatch );
+                  Mis_CopyArray( FCMagData[PID], amr->patch[ amr->MagSg[lv] ][lv][PID]->magnetic[v], FCMagSizeOnePatch );
 
 
 //             5-3-2-4. write data to disk
@@ -1400,7 +1413,7 @@ void FillIn_KeyInfo( KeyInfo_t &KeyInfo )
 
    const time_t CalTime = time( NULL );   // calendar time
 
-   KeyInfo.FormatVersion        = 2429;
+   KeyInfo.FormatVersion        = 2442;
    KeyInfo.Model                = MODEL;
    KeyInfo.NLevel               = NLEVEL;
    KeyInfo.NCompFluid           = NCOMP_FLUID;
@@ -1536,6 +1549,12 @@ void FillIn_Makefile( Makefile_t &Makefile )
    Makefile.Float8                 = 0;
 #  endif
 
+#  ifdef MIXED_PRECISION
+   Makefile.MixedPrecision         = 1;
+#  else
+   Makefile.MixedPrecision         = 0;
+#  endif
+
 #  ifdef SERIAL
    Makefile.Serial                 = 1;
 #  else
@@ -1905,6 +1924,7 @@ void FillIn_SymConst( SymConst_t &SymConst )
    SymConst.Src_NAuxDlep         = SRC_NAUX_DLEP;
    SymConst.Src_DlepProfNVar     = SRC_DLEP_PROF_NVAR;
    SymConst.Src_DlepProfNBinMax  = SRC_DLEP_PROF_NBINMAX;
+   SymConst.Src_NAuxCool         = SRC_NAUX_COOL;
    SymConst.Src_NAuxUser         = SRC_NAUX_USER;
 
 } // FUNCTION : FillIn_SymConst
@@ -2006,6 +2026,7 @@ void FillIn_InputPara( InputPara_t &InputPara )
    InputPara.AutoReduceDt            = AUTO_REDUCE_DT;
    InputPara.AutoReduceDtFactor      = AUTO_REDUCE_DT_FACTOR;
    InputPara.AutoReduceDtFactorMin   = AUTO_REDUCE_DT_FACTOR_MIN;
+   InputPara.AutoReduceDtLocal       = AUTO_REDUCE_DT_LOCAL;
 
 // domain refinement
    InputPara.RegridCount             = REGRID_COUNT;
@@ -2048,6 +2069,7 @@ void FillIn_InputPara( InputPara_t &InputPara )
 #  endif
    InputPara.Opt__ReuseMemory        = OPT__REUSE_MEMORY;
    InputPara.Opt__MemoryPool         = OPT__MEMORY_POOL;
+   InputPara.Opt__SingleSandglass    = OPT__SINGLE_SANDGLASS;
 
 // load balance
 #  ifdef LOAD_BALANCE
@@ -2056,6 +2078,10 @@ void FillIn_InputPara( InputPara_t &InputPara )
    InputPara.LB_Par_Weight           = amr->LB->Par_Weight;
 #  endif
    InputPara.Opt__RecordLoadBalance  = OPT__RECORD_LOAD_BALANCE;
+   InputPara.Opt__LB_AllLevel        = OPT__LB_ALL_LEVEL;
+   InputPara.Opt__LB_Incremental     = OPT__LB_INCREMENTAL;
+   InputPara.Opt__LB_IncMaxShift     = OPT__LB_INC_MAX_SHIFT;
+   InputPara.Opt__LB_SparseComm      = OPT__LB_SPARSE_COMM;
 #  endif
    InputPara.Opt__MinimizeMPIBarrier = OPT__MINIMIZE_MPI_BARRIER;
 
@@ -2064,10 +2090,23 @@ void FillIn_InputPara( InputPara_t &InputPara )
    InputPara.Gamma                   = GAMMA;
    InputPara.MolecularWeight         = MOLECULAR_WEIGHT;
    InputPara.IsoTemp                 = ISO_TEMP;
+   InputPara.EoSTab_Name             = EOS_TAB_NAME;
+   InputPara.EoSTab_NDens            = EOS_TAB_NDENS;
+   InputPara.EoSTab_NSEint           = EOS_TAB_NSEINT;
+   InputPara.EoSTab_NYe              = EOS_TAB_NYE;
+   InputPara.EoSTab_NPres            = EOS_TAB_NPRES;
+   InputPara.EoSTab_LogDens_Min      = EOS_TAB_LOGDENS_MIN;
+   InputPara.EoSTab_LogDens_Max      = EOS_TAB_LOGDENS_MAX;
+   InputPara.EoSTab_LogSEint_Min     = EOS_TAB_LOGSEINT_MIN;
+   InputPara.EoSTab_LogSEint_Max     = EOS_TAB_LOGSEINT_MAX;
+   InputPara.EoSTab_Ye_Min           = EOS_TAB_YE_MIN;
+   InputPara.EoSTab_Ye_Max           = EOS_TAB_YE_MAX;
    InputPara.MinMod_Coeff            = MINMOD_COEFF;
    InputPara.Opt__LR_Limiter         = OPT__LR_LIMITER;
    InputPara.Opt__1stFluxCorr        = OPT__1ST_FLUX_CORR;
    InputPara.Opt__1stFluxCorrScheme  = OPT__1ST_FLUX_CORR_SCHEME;
+   InputPara.Opt__FluSuperBlock      = OPT__FLU_SUPER_BLOCK;
+   InputPara.Opt__FluSlab            = OPT__FLU_SLAB;
 #  endif
 
 // ELBDM solvers
@@ -2152,7 +2191,14 @@ void FillIn_InputPara( InputPara_t &InputPara )
 
 // source terms
    InputPara.Src_Deleptonization     = SrcTerms.Deleptonization;
+#  if ( MODEL == HYDRO )
+   InputPara.Src_Cooling             = SrcTerms.Cooling;
+   InputPara.Src_Cooling_Table       = SRC_COOLING_TABLE;
+   InputPara.Src_Cooling_Redshift    = SRC_COOLING_REDSHIFT;
+   InputPara.Src_Cooling_Metal       = SRC_COOLING_METAL;
+#  endif
    InputPara.Src_User                = SrcTerms.User;
+   InputPara.Src_FuseFluid           = SRC_FUSE_FLUID;
    InputPara.Src_GPU_NPGroup         = SRC_GPU_NPGROUP;
 
 // Grackle
@@ -2254,6 +2300,10 @@ void FillIn_InputPara( InputPara_t &InputPara )
    InputPara.Opt__TimingBarrier      = OPT__TIMING_BARRIER;
    InputPara.Opt__TimingBalance      = OPT__TIMING_BALANCE;
    InputPara.Opt__TimingMPI          = OPT__TIMING_MPI;
+   InputPara.Opt__TimingTrace        = OPT__TIMING_TRACE;
+   InputPara.Opt__TimingTrace_NEvent = OPT__TIMING_TRACE_NEVENT;
+   InputPara.Opt__TimingPerf         = OPT__TIMING_PERF;
+   InputPara.Opt__TimingPerf_Raw     = OPT__TIMING_PERF_RAW;
    InputPara.Opt__RecordNote         = OPT__RECORD_NOTE;
    InputPara.Opt__RecordUnphy        = OPT__RECORD_UNPHY;
    InputPara.Opt__RecordMemory       = OPT__RECORD_MEMORY;
@@ -2438,6 +2488,7 @@ void GetCompound_Makefile( hid_t &H5_TypeID )
    H5Tinsert( H5_TypeID, "Timing",                 HOFFSET(Makefile_t,Timing                 ), H5T_NATIVE_INT );
    H5Tinsert( H5_TypeID, "TimingSolver",           HOFFSET(Makefile_t,TimingSolver           ), H5T_NATIVE_INT );
    H5Tinsert( H5_TypeID, "Float8",                 HOFFSET(Makefile_t,Float8                 ), H5T_NATIVE_INT );
+   H5Tinsert( H5_TypeID, "MixedPrecision",         HOFFSET(Makefile_t,MixedPrecision         ), H5T_NATIVE_INT );
    H5Tinsert( H5_TypeID, "Serial",                 HOFFSET(Makefile_t,Serial                 ), H5T_NATIVE_INT );
    H5Tinsert( H5_TypeID, "LoadBalance",            HOFFSET(Makefile_t,LoadBalance            ), H5T_NATIVE_INT );
    H5Tinsert( H5_TypeID, "OverlapMPI",             HOFFSET(Makefile_t,OverlapMPI             ), H5T_NATIVE_INT );
@@ -2617,6 +2668,7 @@ void GetCompound_SymConst( hid_t &H5_TypeID )
    H5Tinsert( H5_TypeID, "Src_NAuxDlep",         HOFFSET(SymConst_t,Src_NAuxDlep        ), H5T_NATIVE_INT    );
    H5Tinsert( H5_TypeID, "Src_DlepProfNVar",     HOFFSET(SymConst_t,Src_DlepProfNVar    ), H5T_NATIVE_INT    );
    H5Tinsert( H5_TypeID, "Src_DlepProfNBinMax",  HOFFSET(SymConst_t,Src_DlepProfNBinMax ), H5T_NATIVE_INT    );
+   H5Tinsert( H5_TypeID, "Src_NAuxCool",         HOFFSET(SymConst_t,Src_NAuxCool        ), H5T_NATIVE_INT    );
    H5Tinsert( H5_TypeID, "Src_NAuxUser",         HOFFSET(SymConst_t,Src_NAuxUser        ), H5T_NATIVE_INT    );
 
 } // FUNCTION : GetCompound_SymConst
@@ -2769,6 +2821,7 @@ void GetCompound_InputPara( hid_t &H5_TypeID )
    H5Tinsert( H5_TypeID, "AutoReduceDt",            HOFFSET(InputPara_t,AutoReduceDt           ), H5T_NATIVE_INT     );
    H5Tinsert( H5_TypeID, "AutoReduceDtFactor",      HOFFSET(InputPara_t,AutoReduceDtFactor     ), H5T_NATIVE_DOUBLE  );
    H5Tinsert( H5_TypeID, "AutoReduceDtFactorMin",   HOFFSET(InputPara_t,AutoReduceDtFactorMin  ), H5T_NATIVE_DOUBLE  );
+   H5Tinsert( H5_TypeID, "AutoReduceDtLocal",       HOFFSET(InputPara_t,AutoReduceDtLocal      ), H5T_NATIVE_INT     );
 
 
 // domain refinement
@@ -2812,6 +2865,7 @@ void GetCompound_InputPara( hid_t &H5_TypeID )
 #  endif
    H5Tinsert( H5_TypeID, "Opt__ReuseMemory",        HOFFSET(InputPara_t,Opt__ReuseMemory       ), H5T_NATIVE_INT     );
    H5Tinsert( H5_TypeID, "Opt__MemoryPool",         HOFFSET(InputPara_t,Opt__MemoryPool        ), H5T_NATIVE_INT     );
+   H5Tinsert( H5_TypeID, "Opt__SingleSandglass",    HOFFSET(InputPara_t,Opt__SingleSandglass   ), H5T_NATIVE_INT     );
 
 // load balance
 #  ifdef LOAD_BALANCE
@@ -2820,6 +2874,10 @@ void GetCompound_InputPara( hid_t &H5_TypeID )
    H5Tinsert( H5_TypeID, "LB_Par_Weight",           HOFFSET(InputPara_t,LB_Par_Weight          ), H5T_NATIVE_DOUBLE  );
 #  endif
    H5Tinsert( H5_TypeID, "Opt__RecordLoadBalance",  HOFFSET(InputPara_t,Opt__RecordLoadBalance ), H5T_NATIVE_INT     );
+   H5Tinsert( H5_TypeID, "Opt__LB_AllLevel",        HOFFSET(InputPara_t,Opt__LB_AllLevel       ), H5T_NATIVE_INT     );
+   H5Tinsert( H5_TypeID, "Opt__LB_Incremental",     HOFFSET(InputPara_t,Opt__LB_Incremental    ), H5T_NATIVE_INT     );
+   H5Tinsert( H5_TypeID, "Opt__LB_IncMaxShift",     HOFFSET(InputPara_t,Opt__LB_IncMaxShift    ), H5T_NATIVE_DOUBLE  );
+   H5Tinsert( H5_TypeID, "Opt__LB_SparseComm",      HOFFSET(InputPara_t,Opt__LB_SparseComm     ), H5T_NATIVE_INT     );
 #  endif
    H5Tinsert( H5_TypeID, "Opt__MinimizeMPIBarrier", HOFFSET(InputPara_t,Opt__MinimizeMPIBarrier), H5T_NATIVE_INT     );
 
@@ -2828,10 +2886,23 @@ void GetCompound_InputPara( hid_t &H5_TypeID )
    H5Tinsert( H5_TypeID, "Gamma",                   HOFFSET(InputPara_t,Gamma                  ), H5T_NATIVE_DOUBLE  );
    H5Tinsert( H5_TypeID, "MolecularWeight",         HOFFSET(InputPara_t,MolecularWeight        ), H5T_NATIVE_DOUBLE  );
    H5Tinsert( H5_TypeID, "IsoTemp",                 HOFFSET(InputPara_t,IsoTemp                ), H5T_NATIVE_DOUBLE  );
+   H5Tinsert( H5_TypeID, "EoSTab_Name",             HOFFSET(InputPara_t,EoSTab_Name            ), H5_TypeID_VarStr   );
+   H5Tinsert( H5_TypeID, "EoSTab_NDens",            HOFFSET(InputPara_t,EoSTab_NDens           ), H5T_NATIVE_INT     );
+   H5Tinsert( H5_TypeID, "EoSTab_NSEint",           HOFFSET(InputPara_t,EoSTab_NSEint          ), H5T_NATIVE_INT     );
+   H5Tinsert( H5_TypeID, "EoSTab_NYe",              HOFFSET(InputPara_t,EoSTab_NYe             ), H5T_NATIVE_INT     );
+   H5Tinsert( H5_TypeID, "EoSTab_NPres",            HOFFSET(InputPara_t,EoSTab_NPres           ), H5T_NATIVE_INT     );
+   H5Tinsert( H5_TypeID, "EoSTab_LogDens_Min",      HOFFSET(InputPara_t,EoSTab_LogDens_Min     ), H5T_NATIVE_DOUBLE  );
+   H5Tinsert( H5_TypeID, "EoSTab_LogDens_Max",      HOFFSET(InputPara_t,EoSTab_LogDens_Max     ), H5T_NATIVE_DOUBLE  );
+   H5Tinsert( H5_TypeID, "EoSTab_LogSEint_Min",     HOFFSET(InputPara_t,EoSTab_LogSEint_Min    ), H5T_NATIVE_DOUBLE  );
+   H5Tinsert( H5_TypeID, "EoSTab_LogSEint_Max",     HOFFSET(InputPara_t,EoSTab_LogSEint_Max    ), H5T_NATIVE_DOUBLE  );
+   H5Tinsert( H5_TypeID, "EoSTab_Ye_Min",           HOFFSET(InputPara_t,EoSTab_Ye_Min          ), H5T_NATIVE_DOUBLE  );
+   H5Tinsert( H5_TypeID, "EoSTab_Ye_Max",           HOFFSET(InputPara_t,EoSTab_Ye_Max          ), H5T_NATIVE_DOUBLE  );
    H5Tinsert( H5_TypeID, "MinMod_Coeff",            HOFFSET(InputPara_t,MinMod_Coeff           ), H5T_NATIVE_DOUBLE  );
    H5Tinsert( H5_TypeID, "Opt__LR_Limiter",         HOFFSET(InputPara_t,Opt__LR_Limiter        ), H5T_NATIVE_INT     );
    H5Tinsert( H5_TypeID, "Opt__1stFluxCorr",        HOFFSET(InputPara_t,Opt__1stFluxCorr       ), H5T_NATIVE_INT     );
    H5Tinsert( H5_TypeID, "Opt__1stFluxCorrScheme",  HOFFSET(InputPara_t,Opt__1stFluxCorrScheme ), H5T_NATIVE_INT     );
+   H5Tinsert( H5_TypeID, "Opt__FluSuperBlock",      HOFFSET(InputPara_t,Opt__FluSuperBlock     ), H5T_NATIVE_INT     );
+   H5Tinsert( H5_TypeID, "Opt__FluSlab",            HOFFSET(InputPara_t,Opt__FluSlab           ), H5T_NATIVE_INT     );
 #  endif
 
 // ELBDM solvers
@@ -2926,7 +2997,14 @@ void GetCompound_InputPara( hid_t &H5_TypeID )
 
 // source terms
    H5Tinsert( H5_TypeID, "Src_Deleptonization",     HOFFSET(InputPara_t,Src_Deleptonization    ), H5T_NATIVE_INT              );
+#  if ( MODEL == HYDRO )
+   H5Tinsert( H5_TypeID, "Src_Cooling",             HOFFSET(InputPara_t,Src_Cooling            ), H5T_NATIVE_INT              );
+   H5Tinsert( H5_TypeID, "Src_Cooling_Table",       HOFFSET(InputPara_t,Src_Cooling_Table      ), H5_TypeID_VarStr            );
+   H5Tinsert( H5_TypeID, "Src_Cooling_Redshift",    HOFFSET(InputPara_t,Src_Cooling_Redshift   ), H5T_NATIVE_DOUBLE           );
+   H5Tinsert( H5_TypeID, "Src_Cooling_Metal",       HOFFSET(InputPara_t,Src_Cooling_Metal      ), H5T_NATIVE_DOUBLE           );
+#  endif
    H5Tinsert( H5_TypeID, "Src_User",                HOFFSET(InputPara_t,Src_User               ), H5T_NATIVE_INT              );
+   H5Tinsert( H5_TypeID, "Src_FuseFluid",           HOFFSET(InputPara_t,Src_FuseFluid          ), H5T_NATIVE_INT              );
    H5Tinsert( H5_TypeID, "Src_GPU_NPGroup",         HOFFSET(InputPara_t,Src_GPU_NPGroup        ), H5T_NATIVE_INT              );
 
 // Grackle
@@ -3028,6 +3106,10 @@ void GetCompound_InputPara( hid_t &H5_TypeID )
    H5Tinsert( H5_TypeID, "Opt__TimingBarrier",      HOFFSET(InputPara_t,Opt__TimingBarrier     ), H5T_NATIVE_INT              );
    H5Tinsert( H5_TypeID, "Opt__TimingBalance",      HOFFSET(InputPara_t,Opt__TimingBalance     ), H5T_NATIVE_INT              );
    H5Tinsert( H5_TypeID, "Opt__TimingMPI",          HOFFSET(InputPara_t,Opt__TimingMPI         ), H5T_NATIVE_INT              );
+   H5Tinsert( H5_TypeID, "Opt__TimingTrace",        HOFFSET(InputPara_t,Opt__TimingTrace       ), H5T_NATIVE_INT              );
+   H5Tinsert( H5_TypeID, "Opt__TimingTrace_NEvent", HOFFSET(InputPara_t,Opt__TimingTrace_NEvent), H5T_NATIVE_INT              );
+   H5Tinsert( H5_TypeID, "Opt__TimingPerf",         HOFFSET(InputPara_t,Opt__TimingPerf        ), H5T_NATIVE_INT              );
+   H5Tinsert( H5_TypeID, "Opt__TimingPerf_Raw",     HOFFSET(InputPara_t,Opt__TimingPerf_Raw    ), H5T_NATIVE_LONG             );
    H5Tinsert( H5_TypeID, "Opt__RecordNote",         HOFFSET(InputPara_t,Opt__RecordNote        ), H5T_NATIVE_INT              );
    H5Tinsert( H5_TypeID, "Opt__RecordUnphy",        HOFFSET(InputPara_t,Opt__RecordUnphy       ), H5T_NATIVE_INT              );
    H5Tinsert( H5_TypeID, "Opt__RecordMemory",       HOFFSET(InputPara_t,Opt__RecordMemory      ), H5T_NATIVE_INT              );
@@ -50,13 +50,13 @@ void Output_Patch( const int lv, const int PID, const int FluSg, const int MagSg
    }
 
 
-   patch_t *Relation                  = amr->patch[    0][lv][PID];
-   real    (*fluid)[PS1][PS1][PS1]    = amr->patch[FluSg][lv][PID]->fluid;
+   patch_t    *Relation                = amr->patch[    0][lv][PID];
+   real_store (*fluid)[PS1][PS1][PS1]    = amr->patch[FluSg][lv][PID]->fluid;
 #  ifdef MHD
-   real    (*magnetic)[PS1P1*PS1*PS1] = amr->patch[MagSg][lv][PID]->magnetic;
+   real_store (*magnetic)[PS1P1*PS1*PS1] = amr->patch[MagSg][lv][PID]->magnetic;
 #  endif
 #  ifdef GRAVITY
-   real    (*pot)[PS1][PS1]           = amr->patch[PotSg][lv][PID]->pot;
+   real_store (*pot)[PS1][PS1]           = amr->patch[PotSg][lv][PID]->pot;
 #  endif
 
    char FileName[100];
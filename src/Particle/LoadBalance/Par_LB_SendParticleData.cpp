@@ -57,6 +57,8 @@ void Par_LB_SendParticleData( const int NParAtt, int *SendBuf_NPatchEachRank, in
                               const bool Exchange_ParDataEachRank, Timer_t *Timer, const char *Timer_Comment )
 {
 
+   TRACE_SCOPE( "Par_LB_SendParticleData", -1 );
+
 // check
 #  ifdef DEBUG_PARTICLE
    if ( NParAtt < 0 )                        Aux_Error( ERROR_INFO, "NParAtt = %d < 0 !!\n", NParAtt );
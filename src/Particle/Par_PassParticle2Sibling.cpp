@@ -33,6 +33,8 @@ extern Timer_t *Timer_Par_MPI[NLEVEL][6];
 void Par_PassParticle2Sibling( const int lv, const bool TimingSendPar )
 {
 
+   TRACE_SCOPE( "Par_PassParticle2Sibling", lv );
+
    const int    FaLv             = lv - 1;
    const bool   RemoveAllPar_No  = false;
    const int    MirSib[26]       = { 1,0,3,2,5,4,9,8,7,6,13,12,11,10,17,16,15,14,25,24,23,22,21,20,19,18 };
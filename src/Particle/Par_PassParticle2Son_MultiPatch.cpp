@@ -60,6 +60,8 @@ void Par_PassParticle2Son_MultiPatch( const int FaLv, const ParPass2Son_t Mode,
                                       const int NFaPatch, const int *FaPIDList )
 {
 
+   TRACE_SCOPE( "Par_PassParticle2Son_MultiPatch", FaLv );
+
    const int SonLv = FaLv + 1;
 
 
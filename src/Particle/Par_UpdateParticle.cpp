@@ -241,7 +241,7 @@ void Par_UpdateParticle( const int lv, const double TimeNew, const double TimeOl
                }
 
                else
-                  memcpy( Pot3D[P], amr->patch[PotSg][lv][PID]->pot_ext, CUBE(PotSize)*sizeof(real) );
+                  Mis_CopyArray( Pot3D[P][0][0], amr->patch[PotSg][lv][PID]->pot_ext[0][0], CUBE(PotSize) );
             }
          } // if ( amr->Par->ImproveAcc )
 
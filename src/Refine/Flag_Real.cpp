@@ -130,6 +130,8 @@ void Flag_Real( const int lv, const UseLBFunc_t UseLBFunc )
       real (*Lohner_Var)                 = NULL;   // array storing the variables for Lohner
       real (*Lohner_Ave)                 = NULL;   // array storing the averages of Lohner_Var for Lohner
       real (*Lohner_Slope)               = NULL;   // array storing the slopes of Lohner_Var for Lohner
+      real (*Fluid_Buf)[PS1][PS1][PS1]   = NULL;   // arrays storing the patch data converted to real for MIXED_PRECISION
+      real (*Pot_Buf  )[PS1][PS1]        = NULL;
 
       int  i_start, i_end, j_start, j_end, k_start, k_end, SibID, SibPID, PID;
       bool ProperNesting, NextPatch;
@@ -160,6 +162,13 @@ void Flag_Real( const int lv, const UseLBFunc_t UseLBFunc )
          Lohner_Slope = new real [ 3*Lohner_NVar*Lohner_NSlope*Lohner_NSlope*Lohner_NSlope ]; // 3: X/Y/Z of 1 patch
       }
 
+#     ifdef MIXED_PRECISION
+      Fluid_Buf = new real [NCOMP_TOTAL][PS1][PS1][PS1];
+#     ifdef GRAVITY
+      Pot_Buf   = new real             [PS1][PS1][PS1];
+#     endif
+#     endif
+
 
 //    loop over all REAL patches (the buffer patches will be flagged only due to the FlagBuf
 //    extension or the grandson check)
@@ -214,10 +223,20 @@ void Flag_Real( const int lv, const UseLBFunc_t UseLBFunc )
             if ( ProperNesting )
             {
                NextPatch = false;
+#              ifdef MIXED_PRECISION
+//             convert the patch data to real since Flag_Check() works in the computing precision
+               Mis_CopyArray( Fluid_Buf[0][0][0], amr->patch[ amr->FluSg[lv] ][lv][PID]->fluid[0][0][0], NCOMP_TOTAL*CUBE(PS1) );
+               Fluid     = Fluid_Buf;
+#              ifdef GRAVITY
+               Mis_CopyArray( Pot_Buf[0][0], amr->patch[ amr->PotSg[lv] ][lv][PID]->pot[0][0], CUBE(PS1) );
+               Pot       = Pot_Buf;
+#              endif
+#              else
                Fluid     = amr->patch[ amr->FluSg[lv] ][lv][PID]->fluid;
 #              ifdef GRAVITY
                Pot       = amr->patch[ amr->PotSg[lv] ][lv][PID]->pot;
 #              endif
+#              endif // #ifdef MIXED_PRECISION ... else ...
 
 
 #              if ( MODEL == HYDRO )
@@ -503,6 +522,8 @@ void Flag_Real( const int lv, const UseLBFunc_t UseLBFunc )
       delete [] Lohner_Var;
       delete [] Lohner_Ave;
       delete [] Lohner_Slope;
+      delete [] Fluid_Buf;
+      delete [] Pot_Buf;
 
    } // OpenMP parallel region
 
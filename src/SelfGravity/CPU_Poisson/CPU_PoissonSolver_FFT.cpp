@@ -420,7 +420,7 @@ void Slab2Patch( const real *RhoK, real *SendBuf, real *RecvBuf, const int SaveS
          PID = List_PID[r][t];
          k   = List_k  [r][t];
 
-         memcpy( amr->patch[SaveSg][0][PID]->pot[k], RecvPtr, PSSize*sizeof(real) );
+         Mis_CopyArray( amr->patch[SaveSg][0][PID]->pot[k][0], RecvPtr, PSSize );
 
          RecvPtr += PSSize;
       }
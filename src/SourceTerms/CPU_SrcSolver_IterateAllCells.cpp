@@ -112,9 +112,14 @@ void CPU_SrcSolver_IterateAllCells(
          if ( SrcTerms.Deleptonization )
             SrcTerms.Dlep_FuncPtr( fluid, B, &SrcTerms, dt, dh, x, y, z, TimeNew, TimeOld, MinDens, MinPres, MinEint, &EoS,
                                    SrcTerms.Dlep_AuxArrayDevPtr_Flt, SrcTerms.Dlep_AuxArrayDevPtr_Int );
+
+//       (2) cooling
+         if ( SrcTerms.Cooling )
+            SrcTerms.Cool_FuncPtr( fluid, B, &SrcTerms, dt, dh, x, y, z, TimeNew, TimeOld, MinDens, MinPres, MinEint, &EoS,
+                                   SrcTerms.Cool_AuxArrayDevPtr_Flt, SrcTerms.Cool_AuxArrayDevPtr_Int );
 #        endif
 
-//       (2) user-defined
+//       (3) user-defined
          if ( SrcTerms.User )
             SrcTerms.User_FuncPtr( fluid, B, &SrcTerms, dt, dh, x, y, z, TimeNew, TimeOld, MinDens, MinPres, MinEint, &EoS,
                                    SrcTerms.User_AuxArrayDevPtr_Flt, SrcTerms.User_AuxArrayDevPtr_Int );
@@ -0,0 +1,755 @@
+#include "CUFLU.h"
+
+#if ( MODEL == HYDRO )
+
+
+
+// external functions and GPU-related set-up
+#ifdef __CUDACC__
+
+#include "CUAPI.h"
+#include "CUFLU_Shared_FluUtility.cu"
+#ifdef DUAL_ENERGY
+#include "CUFLU_Shared_DualEnergy.cu"
+#endif
+#include "CUDA_ConstMemory.h"
+
+#endif // #ifdef __CUDACC__
+
+
+// local function prototypes
+#ifndef __CUDACC__
+
+void Src_SetAuxArray_Cooling( double [], int [] );
+void Src_SetFunc_Cooling( SrcFunc_t & );
+void Src_SetConstMemory_Cooling( const double AuxArray_Flt[], const int AuxArray_Int[],
+                                 double *&DevPtr_Flt, int *&DevPtr_Int );
+void Src_PassData2GPU_Cooling( const real *h_Table, real *&d_Table, const long TableSize );
+void Src_FreeGPUTable_Cooling( real *&d_Table );
+void Src_LoadTable_Cooling();
+
+#endif
+
+
+// variables stored in each node of the cooling table
+#define SRC_COOL_TEMP         0     // temperature in K
+#define SRC_COOL_TEMP2LAMBDA  1     // temperature / cooling function
+#define SRC_COOL_1MALPHA      2     // 1 - power-law index of the cooling function in [node, node+1]
+#define SRC_COOL_Y            3     // temporal evolution function of Townsend (2009)
+#define SRC_COOL_NVAR         4
+
+// hydrogen mass fraction for converting mass density to hydrogen number density
+#define SRC_COOL_XH           0.76
+
+// normalization of the cooling function in erg*cm^3/s to avoid overflow in single precision
+#define SRC_COOL_LAMBDA_UNIT  1.0e-23
+
+
+
+/********************************************************
+1. Tabulated radiative cooling source term
+   --> Enabled by the runtime option "SRC_COOLING"
+   --> An alternative to Grackle for simulations in collisional/photo-ionization equilibrium, for which
+       the chemistry network is not required
+
+2. This file is shared by both CPU and GPU
+
+   CUSRC_Src_Cooling.cu -> CPU_Src_Cooling.cpp
+
+3. Four steps are required to implement a source term
+
+   I.   Set auxiliary arrays
+   II.  Implement the source-term function
+   III. [Optional] Add the work to be done every time
+        before calling the major source-term function
+   IV.  Set initialization functions
+
+4. The source-term function must be thread-safe and
+   not use any global variable
+
+5. Input table "SRC_COOLING_TABLE"
+
+   --> ASCII file with four columns: redshift, metal mass fraction, log10(T [K]), and
+       log10(Lambda/n_H^2 [erg*cm^3/s])
+   --> Rows must be sorted with redshift varying the slowest and temperature varying the fastest
+   --> log10(T) must be uniformly sampled and be the same for all (redshift, metallicity) pairs
+   --> Metal mass fraction must be uniformly sampled and be the same for all redshifts
+
+6. Adopt the exact integration scheme of Townsend (2009, ApJS, 181, 391)
+
+   --> The cooling function is approximated as a piecewise power law between table nodes, for which
+       the isochoric cooling equation can be integrated analytically
+       --> No sub-cycling and no cooling time-step constraint are required
+   --> The table is first interpolated to SRC_COOLING_REDSHIFT by Src_Init_Cooling()
+   --> For metallicities between two table nodes, the cooling equation is integrated on both nodes
+       and the final temperatures are linearly interpolated
+   --> No cooling below the minimum table temperature, and the cooling function above the maximum
+       table temperature is extrapolated with the power law of the last table interval
+********************************************************/
+
+
+
+// =======================
+// I. Set auxiliary arrays
+// =======================
+
+#ifndef __CUDACC__
+
+// table properties set by Src_LoadTable_Cooling()
+static int    Src_Cool_NTemp;
+static int    Src_Cool_NMetal;
+static double Src_Cool_LnTempMin;
+static double Src_Cool_dLnTemp;
+static double Src_Cool_MetalMin;
+static double Src_Cool_dMetal;
+
+// host and device tables
+static real  *h_Src_Cool_Table = NULL;
+#ifdef GPU
+static real  *d_Src_Cool_Table = NULL;
+#endif
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  Src_SetAuxArray_Cooling
+// Description :  Set the auxiliary arrays AuxArray_Flt/Int[]
+//
+//                   AuxArray_Flt[0] = conversion factor from the specific internal energy in code units
+//                                     to the temperature in K
+//                   AuxArray_Flt[1] = conversion factor from dens*dt in code units to the increment of
+//                                     the temporal evolution function Y
+//                   AuxArray_Flt[2] = ln(T) of the first table node
+//                   AuxArray_Flt[3] = 1/d[ln(T)]
+//                   AuxArray_Flt[4] = metal mass fraction of the first table node
+//                   AuxArray_Flt[5] = 1/d[metal mass fraction]
+//                   AuxArray_Flt[6] = SRC_COOLING_METAL
+//
+//                   AuxArray_Int[0] = number of temperature nodes
+//                   AuxArray_Int[1] = number of metallicity nodes
+//                   AuxArray_Int[2] = passive scalar index of the metal density (i.e., field index - NCOMP_FLUID)
+//                                     --> -1 if the field "Metal" does not exist, for which SRC_COOLING_METAL is used
+//
+// Note        :  1. Invoked by Src_Init_Cooling() after the table has been loaded
+//                2. AuxArray_Flt/Int[] have the size of SRC_NAUX_COOL defined in Macro.h (default = 10)
+//                3. Add "#ifndef __CUDACC__" since this routine is only useful on CPU
+//
+// Parameter   :  AuxArray_Flt/Int : Floating-point/Integer arrays to be filled up
+//
+// Return      :  AuxArray_Flt/Int[]
+//-------------------------------------------------------------------------------------------------------
+void Src_SetAuxArray_Cooling( double AuxArray_Flt[], int AuxArray_Int[] )
+{
+
+// dT/dt = -(gamma-1)*mu*m_H/k_B * (X_H/m_H)^2 * dens * Lambda(T)
+   const double Eint2Temp = ( GAMMA - 1.0 )*MOLECULAR_WEIGHT*Const_mH/Const_kB;
+
+   AuxArray_Flt[0] = Eint2Temp*SQR( UNIT_V );
+   AuxArray_Flt[1] = Eint2Temp*SQR( SRC_COOL_XH/Const_mH )*SRC_COOL_LAMBDA_UNIT*UNIT_D*UNIT_T;
+   AuxArray_Flt[2] = Src_Cool_LnTempMin;
+   AuxArray_Flt[3] = 1.0/Src_Cool_dLnTemp;
+   AuxArray_Flt[4] = Src_Cool_MetalMin;
+   AuxArray_Flt[5] = ( Src_Cool_NMetal > 1 ) ? 1.0/Src_Cool_dMetal : 0.0;
+   AuxArray_Flt[6] = SRC_COOLING_METAL;
+
+   AuxArray_Int[0] = Src_Cool_NTemp;
+   AuxArray_Int[1] = Src_Cool_NMetal;
+
+   char MetalLabel[] = "Metal";
+   const int MetalIdx = GetFieldIndex( MetalLabel, CHECK_OFF );
+
+   if ( Src_Cool_NMetal > 1  &&  MetalIdx != Idx_Undefined )
+   {
+      AuxArray_Int[2] = MetalIdx - NCOMP_FLUID;
+
+      if ( AuxArray_Int[2] < 0 )
+         Aux_Error( ERROR_INFO, "field \"%s\" must be a passive scalar !!\n", MetalLabel );
+   }
+   else
+      AuxArray_Int[2] = -1;
+
+} // FUNCTION : Src_SetAuxArray_Cooling
+
+#endif // #ifndef __CUDACC__
+
+
+
+// ======================================
+// II. Implement the source-term function
+// ======================================
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  Src_Cooling_Integrate
+// Description :  Integrate the isochoric cooling equation exactly for a single metallicity node
+//
+// Note        :  1. Invoked by Src_Cooling()
+//                2. Y(T) = \int_T^{T_N} dT'/Lambda(T'), where T_N is the temperature of the last table node
+//                   --> Cooling over dt is equivalent to Y(T_new) = Y(T_old) + dY
+//                3. For a power-law segment Lambda(T) = Lambda_k*(T/T_k)^alpha_k,
+//                      Y(T) = Y_k + (T_k/Lambda_k)/(1-alpha_k)*[ 1 - (T/T_k)^(1-alpha_k) ]
+//
+// Parameter   :  Temp      : Temperature in K before update
+//                dY        : Increment of the temporal evolution function
+//                Table     : Cooling table of the target metallicity
+//                NTemp     : Number of temperature nodes
+//                LnTempMin : ln(T) of the first table node
+//                _dLnTemp  : 1/d[ln(T)]
+//
+// Return      :  Temperature in K after update
+//-------------------------------------------------------------------------------------------------------
+GPU_DEVICE
+static real Src_Cooling_Integrate( const real Temp, const real dY, const real *Table, const int NTemp,
+                                   const real LnTempMin, const real _dLnTemp )
+{
+
+// no cooling below the table (which also returns NaN as is)
+   if (  ! ( Temp > Table[SRC_COOL_TEMP] )  )   return Temp;
+
+
+// locate the segment in O(1) and evaluate Y(T)
+   int k = (int)(  ( LOG(Temp) - LnTempMin )*_dLnTemp  );
+   k = MIN( k, NTemp-2 );
+   k = MAX( k, 0       );
+
+   const real *Node = Table + k*SRC_COOL_NVAR;
+   real Y, OneMAlpha, Ratio;
+
+   OneMAlpha = Node[SRC_COOL_1MALPHA];
+   Ratio     = Temp / Node[SRC_COOL_TEMP];
+
+   if ( FABS(OneMAlpha) < (real)1.0e-4 )
+      Y = Node[SRC_COOL_Y] - Node[SRC_COOL_TEMP2LAMBDA]*LOG( Ratio );
+   else
+      Y = Node[SRC_COOL_Y] + Node[SRC_COOL_TEMP2LAMBDA]/OneMAlpha*( (real)1.0 - POW(Ratio, OneMAlpha) );
+
+   Y += dY;
+
+
+// Y decreases with T --> walk down the table until Y(T_k) >= Y
+   while ( Y > Node[SRC_COOL_Y] )
+   {
+      if ( k == 0 )  return Table[SRC_COOL_TEMP];
+
+      k    --;
+      Node -= SRC_COOL_NVAR;
+   }
+
+
+// invert Y(T) within the segment
+   OneMAlpha = Node[SRC_COOL_1MALPHA];
+
+   if ( FABS(OneMAlpha) < (real)1.0e-4 )
+      Ratio = EXP( ( Node[SRC_COOL_Y] - Y )/Node[SRC_COOL_TEMP2LAMBDA] );
+   else
+      Ratio = POW(  (real)1.0 - OneMAlpha*( Y - Node[SRC_COOL_Y] )/Node[SRC_COOL_TEMP2LAMBDA], (real)1.0/OneMAlpha  );
+
+   return Node[SRC_COOL_TEMP]*Ratio;
+
+} // FUNCTION : Src_Cooling_Integrate
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  Src_Cooling
+// Description :  Major source-term function
+//
+// Note        :  1. Invoked by CPU/GPU_SrcSolver_IterateAllCells()
+//                2. See Src_SetAuxArray_Cooling() for the values stored in AuxArray_Flt/Int[]
+//                3. Shared by both CPU and GPU
+//                4. Only support EOS_GAMMA so that temperature is proportional to the specific internal energy
+//
+// Parameter   :  fluid             : Fluid array storing both the input and updated values
+//                                    --> Including both active and passive variables
+//                B                 : Cell-centered magnetic field
+//                SrcTerms          : Structure storing all source-term variables
+//                dt                : Time interval to advance solution
+//                dh                : Grid size
+//                x/y/z             : Target physical coordinates
+//                TimeNew           : Target physical time to reach
+//                TimeOld           : Physical time before update
+//                                    --> This function updates physical time from TimeOld to TimeNew
+//                MinDens/Pres/Eint : Density, pressure, and internal energy floors
+//                EoS               : EoS object
+//                AuxArray_*        : Auxiliary arrays (see the Note above)
+//
+// Return      :  fluid[]
+//-----------------------------------------------------------------------------------------
+GPU_DEVICE_NOINLINE
+static void Src_Cooling( real fluid[], const real B[],
+                         const SrcTerms_t *SrcTerms, const real dt, const real dh,
+                         const double x, const double y, const double z,
+                         const double TimeNew, const double TimeOld,
+                         const real MinDens, const real MinPres, const real MinEint,
+                         const EoS_t *EoS, const double AuxArray_Flt[], const int AuxArray_Int[] )
+{
+
+// check
+#  ifdef GAMER_DEBUG
+   if ( AuxArray_Flt == NULL )   printf( "ERROR : AuxArray_Flt == NULL in %s !!\n", __FUNCTION__ );
+   if ( AuxArray_Int == NULL )   printf( "ERROR : AuxArray_Int == NULL in %s !!\n", __FUNCTION__ );
+   if ( SrcTerms->Cool_TableDevPtr == NULL )
+      printf( "ERROR : SrcTerms->Cool_TableDevPtr == NULL in %s !!\n", __FUNCTION__ );
+#  endif
+
+   const real  Eint2Temp = (real)AuxArray_Flt[0];
+   const real  DensDt2dY = (real)AuxArray_Flt[1];
+   const real  LnTempMin = (real)AuxArray_Flt[2];
+   const real  _dLnTemp  = (real)AuxArray_Flt[3];
+   const int   NTemp     = AuxArray_Int[0];
+   const int   NMetal    = AuxArray_Int[1];
+   const int   MetalIdx  = AuxArray_Int[2];
+   const real *Table     = SrcTerms->Cool_TableDevPtr;
+
+#  ifdef MHD
+   const real Emag = (real)0.5*( SQR(B[MAGX]) + SQR(B[MAGY]) + SQR(B[MAGZ]) );
+#  else
+   const real Emag = NULL_REAL;
+#  endif
+   const bool CheckMinEint_No = false;
+
+   const real Dens    = fluid[DENS];
+   const real Eint    = Hydro_Con2Eint( Dens, fluid[MOMX], fluid[MOMY], fluid[MOMZ], fluid[ENGY],
+                                        CheckMinEint_No, NULL_REAL, Emag );
+   const real TempOld = Eint2Temp*Eint/Dens;
+   const real dY      = DensDt2dY*Dens*dt;
+   real TempNew;
+
+
+// integrate the cooling equation
+   if ( NMetal > 1 )
+   {
+      const real Metal = ( MetalIdx >= 0 ) ? fluid[ NCOMP_FLUID + MetalIdx ]/Dens : (real)AuxArray_Flt[6];
+      real NormZ = ( Metal - (real)AuxArray_Flt[4] )*(real)AuxArray_Flt[5];
+
+      NormZ = FMIN(  FMAX( NormZ, (real)0.0 ), (real)(NMetal-1)  );
+
+      const int  IdxZ  = MIN( (int)NormZ, NMetal-2 );
+      const real FracZ = NormZ - (real)IdxZ;
+      const real *TableZ = Table + (long)IdxZ*NTemp*SRC_COOL_NVAR;
+
+      TempNew = Src_Cooling_Integrate( TempOld, dY, TableZ, NTemp, LnTempMin, _dLnTemp );
+
+      if ( FracZ > (real)0.0 )
+      {
+         const real TempNewR = Src_Cooling_Integrate( TempOld, dY, TableZ+NTemp*SRC_COOL_NVAR, NTemp,
+                                                      LnTempMin, _dLnTemp );
+
+         TempNew = ( (real)1.0 - FracZ )*TempNew + FracZ*TempNewR;
+      }
+   }
+
+   else
+      TempNew = Src_Cooling_Integrate( TempOld, dY, Table, NTemp, LnTempMin, _dLnTemp );
+
+
+// update the internal and total energies
+// --> skip cells without cooling to preserve their energies bitwise
+   if ( TempNew == TempOld )  return;
+
+   real EintNew = Eint*( TempNew/TempOld );
+   EintNew = Hydro_CheckMinEint( EintNew, MinEint );
+
+   fluid[ENGY] = Hydro_ConEint2Etot( Dens, fluid[MOMX], fluid[MOMY], fluid[MOMZ], EintNew, Emag );
+
+// update the dual-energy variable to be consistent with the updated pressure
+#  ifdef DUAL_ENERGY
+#  if   ( DUAL_ENERGY == DE_ENPY )
+   const real PresNew = EoS->DensEint2Pres_FuncPtr( Dens, EintNew, fluid+NCOMP_FLUID, EoS->AuxArrayDevPtr_Flt,
+                                                    EoS->AuxArrayDevPtr_Int, EoS->Table, NULL );
+   fluid[ENPY] = Hydro_DensPres2Entropy( Dens, PresNew, EoS->AuxArrayDevPtr_Flt[1] );
+#  elif ( DUAL_ENERGY == DE_EINT )
+#  error : DE_EINT is NOT supported yet !!
+#  endif
+#  endif // #ifdef DUAL_ENERGY
+
+} // FUNCTION : Src_Cooling
+
+
+
+// ==================================================
+// III. [Optional] Add the work to be done every time
+//      before calling the major source-term function
+// ==================================================
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  Src_WorkBeforeMajorFunc_Cooling
+// Description :  Specify work to be done every time before calling the major source-term function
+//
+// Note        :  1. Invoked by Src_WorkBeforeMajorFunc()
+//                2. Add "#ifndef __CUDACC__" since this routine is only useful on CPU
+//                3. Nothing to do here since the table is interpolated to SRC_COOLING_REDSHIFT only
+//                   once by Src_Init_Cooling()
+//
+// Parameter   :  lv               : Target refinement level
+//                TimeNew          : Target physical time to reach
+//                TimeOld          : Physical time before update
+//                                   --> The major source-term function will update the system from TimeOld to TimeNew
+//                dt               : Time interval to advance solution
+//                                   --> Physical coordinates : TimeNew - TimeOld == dt
+//                                       Comoving coordinates : TimeNew - TimeOld == delta(scale factor) != dt
+//                AuxArray_Flt/Int : Auxiliary arrays
+//                                   --> Can be used and/or modified here
+//                                   --> Must call Src_SetConstMemory_Cooling() after modification
+//
+// Return      :  AuxArray_Flt/Int[]
+//-------------------------------------------------------------------------------------------------------
+#ifndef __CUDACC__
+void Src_WorkBeforeMajorFunc_Cooling( const int lv, const double TimeNew, const double TimeOld, const double dt,
+                                      double AuxArray_Flt[], int AuxArray_Int[] )
+{
+
+// nothing to do
+
+} // FUNCTION : Src_WorkBeforeMajorFunc_Cooling
+#endif
+
+
+
+#ifdef __CUDACC__
+//-------------------------------------------------------------------------------------------------------
+// Function    :  Src_PassData2GPU_Cooling / Src_FreeGPUTable_Cooling
+// Description :  Allocate/free the GPU cooling table and transfer the CPU table to GPU
+//
+// Note        :  1. Invoked by Src_Init_Cooling() and Src_End_Cooling(), respectively
+//                2. Use synchronous transfer
+//
+// Parameter   :  h_Table   : CPU table
+//                d_Table   : GPU table to be allocated/freed
+//                TableSize : Number of elements in the table
+//
+// Return      :  d_Table
+//-------------------------------------------------------------------------------------------------------
+void Src_PassData2GPU_Cooling( const real *h_Table, real *&d_Table, const long TableSize )
+{
+
+   CUDA_CHECK_ERROR(  cudaMalloc( (void**)&d_Table, TableSize*sizeof(real) )  );
+   CUDA_CHECK_ERROR(  cudaMemcpy( d_Table, h_Table, TableSize*sizeof(real), cudaMemcpyHostToDevice )  );
+
+} // FUNCTION : Src_PassData2GPU_Cooling
+
+void Src_FreeGPUTable_Cooling( real *&d_Table )
+{
+
+   if ( d_Table != NULL )  CUDA_CHECK_ERROR(  cudaFree( d_Table )  );
+   d_Table = NULL;
+
+} // FUNCTION : Src_FreeGPUTable_Cooling
+#endif // #ifdef __CUDACC__
+
+
+
+// ================================
+// IV. Set initialization functions
+// ================================
+
+#ifdef __CUDACC__
+#  define FUNC_SPACE __device__ static
+#else
+#  define FUNC_SPACE            static
+#endif
+
+FUNC_SPACE SrcFunc_t SrcFunc_Ptr = Src_Cooling;
+
+//-----------------------------------------------------------------------------------------
+// Function    :  Src_SetFunc_Cooling
+// Description :  Return the function pointer of the CPU/GPU source-term function
+//
+// Note        :  1. Invoked by Src_Init_Cooling()
+//                2. Call-by-reference
+//                3. Use either CPU or GPU but not both of them
+//
+// Parameter   :  SrcFunc_CPU/GPUPtr : CPU/GPU function pointer to be set
+//
+// Return      :  SrcFunc_CPU/GPUPtr
+//-----------------------------------------------------------------------------------------
+#ifdef __CUDACC__
+__host__
+void Src_SetFunc_Cooling( SrcFunc_t &SrcFunc_GPUPtr )
+{
+   CUDA_CHECK_ERROR(  cudaMemcpyFromSymbol( &SrcFunc_GPUPtr, SrcFunc_Ptr, sizeof(SrcFunc_t) )  );
+}
+
+#elif ( !defined GPU )
+
+void Src_SetFunc_Cooling( SrcFunc_t &SrcFunc_CPUPtr )
+{
+   SrcFunc_CPUPtr = SrcFunc_Ptr;
+}
+
+#endif // #ifdef __CUDACC__ ... elif ...
+
+
+
+#ifdef __CUDACC__
+//-------------------------------------------------------------------------------------------------------
+// Function    :  Src_SetConstMemory_Cooling
+// Description :  Set the constant memory variables on GPU
+//
+// Note        :  1. Adopt the suggested approach for CUDA version >= 5.0
+//                2. Invoked by Src_Init_Cooling()
+//                3. SRC_NAUX_COOL is defined in Macro.h
+//
+// Parameter   :  AuxArray_Flt/Int : Auxiliary arrays to be copied to the constant memory
+//                DevPtr_Flt/Int   : Pointers to store the addresses of constant memory arrays
+//
+// Return      :  c_Src_Cool_AuxArray_Flt[], c_Src_Cool_AuxArray_Int[], DevPtr_Flt, DevPtr_Int
+//---------------------------------------------------------------------------------------------------
+void Src_SetConstMemory_Cooling( const double AuxArray_Flt[], const int AuxArray_Int[],
+                                 double *&DevPtr_Flt, int *&DevPtr_Int )
+{
+
+// copy data to constant memory
+   CUDA_CHECK_ERROR(  cudaMemcpyToSymbol( c_Src_Cool_AuxArray_Flt, AuxArray_Flt, SRC_NAUX_COOL*sizeof(double) )  );
+   CUDA_CHECK_ERROR(  cudaMemcpyToSymbol( c_Src_Cool_AuxArray_Int, AuxArray_Int, SRC_NAUX_COOL*sizeof(int   ) )  );
+
+// obtain the constant-memory pointers
+   CUDA_CHECK_ERROR(  cudaGetSymbolAddress( (void **)&DevPtr_Flt, c_Src_Cool_AuxArray_Flt )  );
+   CUDA_CHECK_ERROR(  cudaGetSymbolAddress( (void **)&DevPtr_Int, c_Src_Cool_AuxArray_Int )  );
+
+} // FUNCTION : Src_SetConstMemory_Cooling
+#endif // #ifdef __CUDACC__
+
+
+
+#ifndef __CUDACC__
+
+//-----------------------------------------------------------------------------------------
+// Function    :  Src_Init_Cooling
+// Description :  Initialize the cooling source term
+//
+// Note        :  1. Load the cooling table by invoking Src_LoadTable_Cooling()
+//                2. Set auxiliary arrays by invoking Src_SetAuxArray_*()
+//                   --> Copy to the GPU constant memory and store the associated addresses
+//                3. Set the source-term function by invoking Src_SetFunc_*()
+//                   --> Unlike other modules (e.g., EoS), here we use either CPU or GPU but not
+//                       both of them
+//                4. Invoked by Src_Init()
+//                5. Add "#ifndef __CUDACC__" since this routine is only useful on CPU
+//
+// Parameter   :  None
+//
+// Return      :  None
+//-----------------------------------------------------------------------------------------
+void Src_Init_Cooling()
+{
+
+// load the cooling table
+   Src_LoadTable_Cooling();
+
+// set the auxiliary arrays
+   Src_SetAuxArray_Cooling( Src_Cool_AuxArray_Flt, Src_Cool_AuxArray_Int );
+
+// copy the auxiliary arrays and table to GPU and store the associated addresses
+#  ifdef GPU
+   Src_SetConstMemory_Cooling( Src_Cool_AuxArray_Flt, Src_Cool_AuxArray_Int,
+                               SrcTerms.Cool_AuxArrayDevPtr_Flt, SrcTerms.Cool_AuxArrayDevPtr_Int );
+   Src_PassData2GPU_Cooling( h_Src_Cool_Table, d_Src_Cool_Table, (long)Src_Cool_NMetal*Src_Cool_NTemp*SRC_COOL_NVAR );
+   SrcTerms.Cool_TableDevPtr        = d_Src_Cool_Table;
+#  else
+   SrcTerms.Cool_AuxArrayDevPtr_Flt = Src_Cool_AuxArray_Flt;
+   SrcTerms.Cool_AuxArrayDevPtr_Int = Src_Cool_AuxArray_Int;
+   SrcTerms.Cool_TableDevPtr        = h_Src_Cool_Table;
+#  endif
+
+// set the major source-term function
+   Src_SetFunc_Cooling( SrcTerms.Cool_FuncPtr );
+
+} // FUNCTION : Src_Init_Cooling
+
+
+
+//-----------------------------------------------------------------------------------------
+// Function    :  Src_End_Cooling
+// Description :  Release the resources used by the cooling source term
+//
+// Note        :  1. Invoked by Src_End()
+//                2. Add "#ifndef __CUDACC__" since this routine is only useful on CPU
+//
+// Parameter   :  None
+//
+// Return      :  None
+//-----------------------------------------------------------------------------------------
+void Src_End_Cooling()
+{
+
+   delete [] h_Src_Cool_Table;
+   h_Src_Cool_Table = NULL;
+
+#  ifdef GPU
+   Src_FreeGPUTable_Cooling( d_Src_Cool_Table );
+#  endif
+
+   SrcTerms.Cool_TableDevPtr = NULL;
+
+} // FUNCTION : Src_End_Cooling
+
+
+
+//-----------------------------------------------------------------------------------------
+// Function    :  Src_LoadTable_Cooling
+// Description :  Load the cooling table and construct the table for the exact integration scheme
+//
+// Note        :  1. Invoked by Src_Init_Cooling()
+//                2. See the top of this file for the format of the input table
+//                3. Interpolate the input table linearly in redshift and log10(Lambda) to SRC_COOLING_REDSHIFT
+//                   --> Values beyond the table redshift range are clamped
+//                4. All MPI ranks load the table
+//
+// Parameter   :  None
+//
+// Return      :  h_Src_Cool_Table[], Src_Cool_NTemp, Src_Cool_NMetal, Src_Cool_LnTempMin, Src_Cool_dLnTemp,
+//                Src_Cool_MetalMin, Src_Cool_dMetal
+//-----------------------------------------------------------------------------------------
+void Src_LoadTable_Cooling()
+{
+
+   if ( MPI_Rank == 0 )    Aux_Message( stdout, "   Loading the cooling table \"%s\" ...\n", SRC_COOLING_TABLE );
+
+
+// load the input table
+   if ( ! Aux_CheckFileExist(SRC_COOLING_TABLE) )
+      Aux_Error( ERROR_INFO, "cooling table \"%s\" does not exist !!\n", SRC_COOLING_TABLE );
+
+   const int  NCol         = 4;
+   const int  TCol[NCol]   = { 0, 1, 2, 3 };
+   const bool RowMajor_Yes = true;
+   const bool AllocMem_Yes = true;
+   double    *Input        = NULL;
+
+   const int NRow = Aux_LoadTable( Input, SRC_COOLING_TABLE, NCol, TCol, RowMajor_Yes, AllocMem_Yes );
+
+   double (*Row)[NCol] = ( double (*)[NCol] )Input;
+
+
+// infer the grid sizes
+   int NTemp, NMetal, NRedshift;
+
+   for (NTemp=1; NTemp<NRow; NTemp++)
+      if ( Row[NTemp][0] != Row[0][0]  ||  Row[NTemp][1] != Row[0][1] )    break;
+
+   for (NMetal=1; NMetal*NTemp<NRow; NMetal++)
+      if ( Row[NMetal*NTemp][0] != Row[0][0] )  break;
+
+   NRedshift = NRow / ( NMetal*NTemp );
+
+   if ( NTemp < 2 )  Aux_Error( ERROR_INFO, "number of temperature nodes (%d) < 2 !!\n", NTemp );
+   if ( NRow != NRedshift*NMetal*NTemp )
+      Aux_Error( ERROR_INFO, "number of rows (%d) != %d redshifts * %d metallicities * %d temperatures !!\n",
+                 NRow, NRedshift, NMetal, NTemp );
+
+
+// check the grids
+   const double LogTempMin = Row[0][2];
+   const double dLogTemp   = ( Row[NTemp-1][2] - Row[0][2] ) / ( NTemp - 1 );
+   const double MetalMin   = Row[0][1];
+   const double dMetal     = ( NMetal > 1 ) ? ( Row[(NMetal-1)*NTemp][1] - Row[0][1] ) / ( NMetal - 1 ) : 0.0;
+
+   if ( dLogTemp <= 0.0 )  Aux_Error( ERROR_INFO, "temperature must increase monotonically !!\n" );
+   if ( NMetal > 1  &&  dMetal <= 0.0 )   Aux_Error( ERROR_INFO, "metallicity must increase monotonically !!\n" );
+
+   for (int r=0; r<NRedshift; r++)
+   for (int m=0; m<NMetal;    m++)
+   for (int t=0; t<NTemp;     t++)
+   {
+      const double *ThisRow = Row[ ((long)r*NMetal + m)*NTemp + t ];
+
+      if ( ThisRow[0] != Row[(long)r*NMetal*NTemp][0] )
+         Aux_Error( ERROR_INFO, "inconsistent redshift in row %ld !!\n", ((long)r*NMetal + m)*NTemp + t );
+
+      if (  r > 0  &&  t == 0  &&  m == 0  &&  ThisRow[0] <= Row[(long)(r-1)*NMetal*NTemp][0]  )
+         Aux_Error( ERROR_INFO, "redshift must increase monotonically (row %ld) !!\n", (long)r*NMetal*NTemp );
+
+      if (  NMetal > 1  &&  fabs( ThisRow[1] - (MetalMin + m*dMetal) ) > 1.0e-6*dMetal  )
+         Aux_Error( ERROR_INFO, "metallicity in row %ld is not uniformly sampled !!\n", ((long)r*NMetal + m)*NTemp + t );
+
+      if (  fabs( ThisRow[2] - (LogTempMin + t*dLogTemp) ) > 1.0e-6*dLogTemp  )
+         Aux_Error( ERROR_INFO, "temperature in row %ld is not uniformly sampled in log space !!\n",
+                    ((long)r*NMetal + m)*NTemp + t );
+
+      if ( !Aux_IsFinite(ThisRow[3]) )
+         Aux_Error( ERROR_INFO, "invalid cooling function in row %ld !!\n", ((long)r*NMetal + m)*NTemp + t );
+   }
+
+
+// interpolate to the target redshift
+   int    IdxR  = 0;
+   double FracR = 0.0;
+
+   if ( NRedshift > 1 )
+   {
+      while ( IdxR < NRedshift-2  &&  Row[(long)(IdxR+1)*NMetal*NTemp][0] <= SRC_COOLING_REDSHIFT )   IdxR ++;
+
+      const double RedshiftL = Row[(long)(IdxR  )*NMetal*NTemp][0];
+      const double RedshiftR = Row[(long)(IdxR+1)*NMetal*NTemp][0];
+
+      FracR = ( SRC_COOLING_REDSHIFT - RedshiftL ) / ( RedshiftR - RedshiftL );
+      FracR = MIN( MAX( FracR, 0.0 ), 1.0 );
+   }
+
+
+// construct the table for the exact integration scheme
+   const double Ln10    = log( 10.0 );
+   const double TempMax = pow( 10.0, LogTempMin + (NTemp-1)*dLogTemp );
+   double *LogLambda    = new double [NTemp];
+
+   h_Src_Cool_Table = new real [ (long)NMetal*NTemp*SRC_COOL_NVAR ];
+
+   for (int m=0; m<NMetal; m++)
+   {
+      const double (*RowL)[NCol] = Row + ( (long)(IdxR  )*NMetal + m )*NTemp;
+      const double (*RowR)[NCol] = ( NRedshift > 1 ) ? Row + ( (long)(IdxR+1)*NMetal + m )*NTemp : RowL;
+      real         *Table        = h_Src_Cool_Table + (long)m*NTemp*SRC_COOL_NVAR;
+
+      for (int t=0; t<NTemp; t++)
+         LogLambda[t] = ( 1.0 - FracR )*RowL[t][3] + FracR*RowR[t][3] - log10( SRC_COOL_LAMBDA_UNIT );
+
+//    Y of the last node is zero by definition
+      double Y = 0.0;
+
+      for (int t=NTemp-1; t>=0; t--)
+      {
+         const double Temp        = pow( 10.0, LogTempMin + t*dLogTemp );
+         const double Temp2Lambda = Temp / pow( 10.0, LogLambda[t] );
+         const double Alpha       = ( t < NTemp-1 ) ? ( LogLambda[t+1] - LogLambda[t] )/dLogTemp
+                                                    : ( LogLambda[t  ] - LogLambda[t-1] )/dLogTemp;
+         const double OneMAlpha   = 1.0 - Alpha;
+
+         if ( t < NTemp-1 )
+         {
+            if ( fabs(OneMAlpha) < 1.0e-4 )  Y += Temp2Lambda*dLogTemp*Ln10;
+            else                             Y += Temp2Lambda/OneMAlpha*( pow(10.0, OneMAlpha*dLogTemp) - 1.0 );
+         }
+
+         Table[ t*SRC_COOL_NVAR + SRC_COOL_TEMP        ] = (real)Temp;
+         Table[ t*SRC_COOL_NVAR + SRC_COOL_TEMP2LAMBDA ] = (real)Temp2Lambda;
+         Table[ t*SRC_COOL_NVAR + SRC_COOL_1MALPHA     ] = (real)OneMAlpha;
+         Table[ t*SRC_COOL_NVAR + SRC_COOL_Y           ] = (real)Y;
+      }
+   } // for (int m=0; m<NMetal; m++)
+
+
+// store the table properties
+   Src_Cool_NTemp     = NTemp;
+   Src_Cool_NMetal    = NMetal;
+   Src_Cool_LnTempMin = LogTempMin*Ln10;
+   Src_Cool_dLnTemp   = dLogTemp*Ln10;
+   Src_Cool_MetalMin  = MetalMin;
+   Src_Cool_dMetal    = dMetal;
+
+
+   delete [] LogLambda;
+   delete [] Input;
+
+
+   if ( MPI_Rank == 0 )
+   {
+      Aux_Message( stdout, "      Number of redshifts/metallicities/temperatures = %d/%d/%d\n", NRedshift, NMetal, NTemp );
+      Aux_Message( stdout, "      Temperature range = [%13.7e, %13.7e] K\n", pow(10.0, LogTempMin), TempMax );
+      Aux_Message( stdout, "   Loading the cooling table \"%s\" ... done\n", SRC_COOLING_TABLE );
+   }
+
+} // FUNCTION : Src_LoadTable_Cooling
+
+#endif // #ifndef __CUDACC__
+
+
+
+#endif // #if ( MODEL == HYDRO )
@@ -0,0 +1 @@
+CPU_Src_Cooling.cpp
\ No newline at end of file
@@ -11,6 +11,8 @@
 //                2. Invoked by EvolveLevel()
 //                3. Grackle library is treated separately
 //                4. Invoke Src_WorkBeforeMajorFunc()
+//                5. Not invoked when SRC_FUSE_FLUID is on
+//                   --> Source terms are added by the fluid solver instead (see Src_FuseFluid())
 //
 // Parameter   :  lv           : Target refinement level
 //                TimeNew      : Target physical time to reach
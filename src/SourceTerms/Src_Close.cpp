@@ -34,8 +34,8 @@ void Src_Close( const int lv, const int SaveSg_Flu, const real h_Flu_Array_S_Out
          const int N   = 8*TID + LocalID;
 
 //       update all fluid variables for now
-         memcpy( amr->patch[SaveSg_Flu][lv][PID]->fluid[0][0][0], h_Flu_Array_S_Out[N][0],
-                 FLU_NOUT_S*CUBE(PS1)*sizeof(real) );
+         Mis_CopyArray( amr->patch[SaveSg_Flu][lv][PID]->fluid[0][0][0], h_Flu_Array_S_Out[N][0],
+                        FLU_NOUT_S*CUBE(PS1) );
       }
    } // for (int TID=0; TID<NPG; TID++)
 
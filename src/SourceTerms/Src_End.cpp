@@ -5,6 +5,7 @@
 // prototypes of built-in source terms
 #if ( MODEL == HYDRO )
 void Src_End_Deleptonization();
+void Src_End_Cooling();
 #endif
 
 // this function pointer can be set by a test problem initializer for a non-built-in source term
@@ -34,6 +35,9 @@ void Src_End()
 #  if ( MODEL == HYDRO )
    if ( SrcTerms.Deleptonization )
       Src_End_Deleptonization();
+
+   if ( SrcTerms.Cooling )
+      Src_End_Cooling();
 #  endif
 
 // users may not define Src_End_User_Ptr
@@ -0,0 +1,56 @@
+#include "GAMER.h"
+
+#if ( MODEL == HYDRO )
+
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  Src_FuseFluid
+// Description :  Add all local source terms to a single cell updated by the fluid solver
+//
+// Note        :  1. Invoked by Hydro_FullStepUpdate() and Flu_Close()->CorrectUnphysical() when SRC_FUSE_FLUID is on
+//                   --> Replace Src_AdvanceDt() so that the source terms are applied while the fluid solver
+//                       output is still in cache, which avoids a separate Src_Prepare()/Src_Close() pass
+//                2. Source terms are added in the same order as CPU_SrcSolver_IterateAllCells()
+//                   --> Operator splitting is unchanged except that the source terms are now applied before
+//                       the gravity correction of the same sub-step (if any)
+//                3. Work for the CPU solvers only since it accesses the host variables "SrcTerms" and "EoS"
+//
+// Parameter   :  fluid             : Fluid array storing both the input and updated values
+//                B                 : Cell-centered magnetic field (for MHD only)
+//                dt                : Time interval to advance solution
+//                dh                : Grid size
+//                x/y/z             : Target physical coordinates
+//                TimeNew           : Target physical time to reach
+//                TimeOld           : Physical time before update
+//                                    --> This function updates physical time from TimeOld to TimeNew
+//                MinDens/Pres/Eint : Density, pressure, and internal energy floors
+//
+// Return      :  fluid[]
+//-------------------------------------------------------------------------------------------------------
+void Src_FuseFluid( real fluid[], const real B[], const real dt, const real dh,
+                    const double x, const double y, const double z, const double TimeNew, const double TimeOld,
+                    const real MinDens, const real MinPres, const real MinEint )
+{
+
+// (1) deleptonization
+   if ( SrcTerms.Deleptonization )
+      SrcTerms.Dlep_FuncPtr( fluid, B, &SrcTerms, dt, dh, x, y, z, TimeNew, TimeOld, MinDens, MinPres, MinEint, &EoS,
+                             SrcTerms.Dlep_AuxArrayDevPtr_Flt, SrcTerms.Dlep_AuxArrayDevPtr_Int );
+
+// (2) cooling
+   if ( SrcTerms.Cooling )
+      SrcTerms.Cool_FuncPtr( fluid, B, &SrcTerms, dt, dh, x, y, z, TimeNew, TimeOld, MinDens, MinPres, MinEint, &EoS,
+                             SrcTerms.Cool_AuxArrayDevPtr_Flt, SrcTerms.Cool_AuxArrayDevPtr_Int );
+
+// (3) user-defined
+   if ( SrcTerms.User )
+      SrcTerms.User_FuncPtr( fluid, B, &SrcTerms, dt, dh, x, y, z, TimeNew, TimeOld, MinDens, MinPres, MinEint, &EoS,
+                             SrcTerms.User_AuxArrayDevPtr_Flt, SrcTerms.User_AuxArrayDevPtr_Int );
+
+} // FUNCTION : Src_FuseFluid
+
+
+
+#endif // #if ( MODEL == HYDRO )
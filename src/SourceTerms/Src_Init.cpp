@@ -5,6 +5,7 @@
 // prototypes of built-in source terms
 #if ( MODEL == HYDRO )
 void Src_Init_Deleptonization();
+void Src_Init_Cooling();
 #endif
 
 // this function pointer can be set by a test problem initializer for a user-specified source term
@@ -35,6 +36,7 @@ void Src_Init()
    if (
 #       if ( MODEL == HYDRO )
         SrcTerms.Deleptonization  ||
+        SrcTerms.Cooling          ||
 #       endif
         SrcTerms.User
       )
@@ -65,6 +67,10 @@ void Src_Init()
    SrcTerms.Dlep_AuxArrayDevPtr_Int   = NULL;
    SrcTerms.Dlep_Profile_DataDevPtr   = NULL;
    SrcTerms.Dlep_Profile_RadiusDevPtr = NULL;
+   SrcTerms.Cool_FuncPtr              = NULL;
+   SrcTerms.Cool_AuxArrayDevPtr_Flt   = NULL;
+   SrcTerms.Cool_AuxArrayDevPtr_Int   = NULL;
+   SrcTerms.Cool_TableDevPtr          = NULL;
 #  endif
    SrcTerms.User_FuncPtr              = NULL;
    SrcTerms.User_AuxArrayDevPtr_Flt   = NULL;
@@ -81,9 +87,18 @@ void Src_Init()
 //    check if the source-term function is set properly
       if ( SrcTerms.Dlep_FuncPtr == NULL )   Aux_Error( ERROR_INFO, "SrcTerms.Dlep_FuncPtr == NULL !!\n" );
    }
+
+// (2) cooling
+   if ( SrcTerms.Cooling )
+   {
+      Src_Init_Cooling();
+
+//    check if the source-term function is set properly
+      if ( SrcTerms.Cool_FuncPtr == NULL )   Aux_Error( ERROR_INFO, "SrcTerms.Cool_FuncPtr == NULL !!\n" );
+   }
 #  endif
 
-// (2) user-specified source term
+// (3) user-specified source term
    if ( SrcTerms.User )
    {
       if ( Src_Init_User_Ptr == NULL )       Aux_Error( ERROR_INFO, "Src_Init_User_Ptr == NULL !!\n" );
@@ -65,13 +65,13 @@ void Src_Prepare( const int lv, const double PrepTime,
 //       1. fast version for zero ghost zone
 #        if ( SRC_GHOST_SIZE == 0 )
 //       fluid variables (include all fields for now)
-         memcpy( h_Flu_Array_S_In[N][0], amr->patch[ amr->FluSg[lv] ][lv][PID]->fluid[0][0][0],
-                 FLU_NIN_S*CUBE(SRC_NXT)*sizeof(real) );
+         Mis_CopyArray( h_Flu_Array_S_In[N][0], amr->patch[ amr->FluSg[lv] ][lv][PID]->fluid[0][0][0],
+                        FLU_NIN_S*CUBE(SRC_NXT) );
 
 //       B field
 #        ifdef MHD
-         memcpy( h_Mag_Array_S_In[N][0], amr->patch[ amr->MagSg[lv] ][lv][PID]->magnetic[0],
-                 NCOMP_MAG*SRC_NXT_P1*SQR(SRC_NXT)*sizeof(real) );
+         Mis_CopyArray( h_Mag_Array_S_In[N][0], amr->patch[ amr->MagSg[lv] ][lv][PID]->magnetic[0],
+                        NCOMP_MAG*SRC_NXT_P1*SQR(SRC_NXT) );
 #        endif
 #        endif // #if ( SRC_GHOST_SIZE == 0 )
 
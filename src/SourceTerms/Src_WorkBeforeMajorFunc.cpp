@@ -6,6 +6,8 @@
 #if ( MODEL == HYDRO )
 void Src_WorkBeforeMajorFunc_Deleptonization( const int lv, const double TimeNew, const double TimeOld, const double dt,
                                               double AuxArray_Flt[], int AuxArray_Int[] );
+void Src_WorkBeforeMajorFunc_Cooling        ( const int lv, const double TimeNew, const double TimeOld, const double dt,
+                                              double AuxArray_Flt[], int AuxArray_Int[] );
 #endif
 
 // this function pointer can be set by a test problem initializer for a user-specified source term
@@ -20,6 +22,7 @@ void (*Src_WorkBeforeMajorFunc_User_Ptr)    ( const int lv, const double TimeNew
 // Description :  Work prior to the major source-term function
 //
 // Note        :  1. Invoked by Src_AdvanceDt()
+//                   --> Or by Flu_AdvanceDt() when SRC_FUSE_FLUID is on
 //                2. Each source term can define its own Src_WorkBeforeMajorFunc_* function
 //
 // Parameter   :  lv      : Target refinement level
@@ -42,9 +45,14 @@ void Src_WorkBeforeMajorFunc( const int lv, const double TimeNew, const double T
    if ( SrcTerms.Deleptonization )
       Src_WorkBeforeMajorFunc_Deleptonization( lv, TimeNew, TimeOld, dt,
                                                Src_Dlep_AuxArray_Flt, Src_Dlep_AuxArray_Int );
+
+// (2) cooling
+   if ( SrcTerms.Cooling )
+      Src_WorkBeforeMajorFunc_Cooling        ( lv, TimeNew, TimeOld, dt,
+                                               Src_Cool_AuxArray_Flt, Src_Cool_AuxArray_Int );
 #  endif
 
-// (2) user-specified source term
+// (3) user-specified source term
 // --> users may not define Src_WorkBeforeMajorFunc_User_Ptr 
    if ( SrcTerms.User  &&  Src_WorkBeforeMajorFunc_User_Ptr != NULL )
       Src_WorkBeforeMajorFunc_User_Ptr       ( lv, TimeNew, TimeOld, dt,
@@ -89,9 +89,9 @@ void SF_CreateStar_AGORA( const int lv, const real TimeNew, const real dt, Rando
 
    double x0, y0, z0, x, y, z;
    real   GasDens, _GasDens, GasMass, _Time_FreeFall, StarMFrac, StarMass, GasMFracLeft;
-   real   (*fluid)[PS1][PS1][PS1]      = NULL;
+   real_store (*fluid)[PS1][PS1][PS1]      = NULL;
 #  ifdef STORE_POT_GHOST
-   real   (*pot_ext)[GRA_NXT][GRA_NXT] = NULL;
+   real_store (*pot_ext)[GRA_NXT][GRA_NXT] = NULL;
 #  endif
 
    const int MaxNewParPerPatch = CUBE(PS1);
@@ -70,7 +70,8 @@ void YT_AddAllGrid( yt_grid *Grid, const int *GID_Offset, const int NField, char
 //       3. set other field parameters
          Grid[GID].num_fields   = NField;
          Grid[GID].field_labels = (const char **)FieldLabel;
-#        ifdef FLOAT8
+//       --> patch data are stored in single precision when MIXED_PRECISION is on
+#        if ( defined FLOAT8  &&  !defined MIXED_PRECISION )
          Grid[GID].field_ftype  = YT_DOUBLE;
 #        else
          Grid[GID].field_ftype  = YT_FLOAT;
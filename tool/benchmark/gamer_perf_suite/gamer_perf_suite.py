@@ -0,0 +1,402 @@
+from __future__ import print_function
+import argparse
+import datetime
+import glob
+import json
+import math
+import os
+import platform
+import re
+import shlex
+import shutil
+import subprocess
+import sys
+
+
+# load the command-line parameters
+ScriptDir = os.path.dirname( os.path.abspath(__file__) )
+
+parser = argparse.ArgumentParser( description='Run the GAMER performance regression suite and compare with the stored baselines' )
+
+parser.add_argument( '-c', action='store', required=False, type=str, dest='config',
+                     help='suite configuration file [%(default)s]', default=os.path.join(ScriptDir, 'perf_suite.json') )
+parser.add_argument( '-r', action='store', required=False, type=str, dest='root',
+                     help='GAMER root directory [%(default)s]', default=os.path.normpath(os.path.join(ScriptDir, '../../..')) )
+parser.add_argument( '-e', action='store', required=False, type=str, dest='exe_dir',
+                     help='directory of the executables "gamer_<problem><exe_suffix>" [<root>/bin]', default=None )
+parser.add_argument( '-w', action='store', required=False, type=str, dest='work_dir',
+                     help='working directory of all runs [%(default)s]', default='perf_run' )
+parser.add_argument( '-b', action='store', required=False, type=str, dest='baseline',
+                     help='baseline file [%(default)s]', default='perf_baseline.json' )
+parser.add_argument( '-u', '--update', action='store_true', dest='update',
+                     help='store the results as the new baselines instead of comparing with them [False]' )
+parser.add_argument( '-p', action='store', required=False, type=str, dest='problems', nargs='+',
+                     help='target problems [all]', default=None )
+parser.add_argument( '-m', action='store', required=False, type=str, dest='modes', nargs='+',
+                     help='target modes [all]', default=None )
+parser.add_argument( '-n', action='store', required=False, type=int, dest='repeat',
+                     help='number of runs per case [set by the configuration file]', default=None )
+parser.add_argument( '-t', action='store', required=False, type=float, dest='tolerance',
+                     help='minimum relative change to be considered a regression [%(default)g]', default=0.05 )
+parser.add_argument( '-k', action='store', required=False, type=float, dest='nsigma',
+                     help='regression threshold in units of the estimated noise [%(default)g]', default=3.0 )
+parser.add_argument( '-f', action='store', required=False, type=float, dest='min_frac',
+                     help='ignore phases taking less than this fraction of the total time [%(default)g]', default=0.02 )
+parser.add_argument( '-o', action='store', required=False, type=str, dest='report',
+                     help='output report file in JSON [%(default)s]', default='perf_report.json' )
+parser.add_argument( '--mpirun', action='store', required=False, type=str, dest='mpirun',
+                     help='MPI launcher with {nrank} replaced by the number of ranks [%(default)s]',
+                     default='mpirun -np {nrank}' )
+
+args=parser.parse_args()
+
+# check
+assert args.tolerance >= 0.0, '-t (%g) < 0' % (args.tolerance)
+assert args.nsigma    >= 0.0, '-k (%g) < 0' % (args.nsigma)
+assert args.repeat is None or args.repeat >= 1, '-n (%d) < 1' % (args.repeat)
+
+if args.exe_dir is None:   args.exe_dir = os.path.join( args.root, 'bin' )
+
+
+# take note
+print( '\nCommand-line arguments:' )
+print( '-------------------------------------------------------------------' )
+for t in range( len(sys.argv) ):
+   print( str(sys.argv[t]), end=' ' )
+print( '' )
+print( '-------------------------------------------------------------------\n' )
+
+
+# metric names
+# --> higher is better for METRIC_RATE and lower is better for all "Time:*" metrics
+METRIC_RATE  = 'CellUpdate/s'
+METRIC_TOTAL = 'Time:Sum'
+
+
+
+#-------------------------------------------------------------------------------------------------------
+# Function    :  SetParameter
+# Description :  Overwrite the values of the target runtime parameters in an input file
+#
+# Note        :  1. Comments after the values are preserved
+#                2. Parameters not found in the file are appended
+#-------------------------------------------------------------------------------------------------------
+def SetParameter( filename, param ):
+
+   with open( filename, 'r' ) as f:
+      lines = f.readlines()
+
+   for key, value in param.items():
+      pattern = re.compile( r'^(%s)(\s+)(\S+)(.*)$' % re.escape(key) )
+      found   = False
+
+      for i, line in enumerate( lines ):
+         match = pattern.match( line )
+         if match:
+            new_value = str( value )
+            width     = max( len(match.group(3)), len(new_value) )
+            lines[i]  = '%s%s%-*s%s\n' % ( match.group(1), match.group(2), width, new_value, match.group(4) )
+            found     = True
+
+      if not found:
+         lines.append( '%-30s%s\n' % (key, str(value)) )
+
+   with open( filename, 'w' ) as f:
+      f.writelines( lines )
+
+
+
+#-------------------------------------------------------------------------------------------------------
+# Function    :  ParsePerformance
+# Description :  Return the number of cell updates per second from "Record__Performance"
+#
+# Note        :  1. Steps <= warmup are excluded
+#                2. Return sum(NUpdate_Cell)/sum(ElapsedTime) instead of the average of Perf_Overall so that
+#                   steps are weighted by their elapsed time
+#-------------------------------------------------------------------------------------------------------
+def ParsePerformance( filename, warmup ):
+
+   NUpdate = 0.0
+   Time    = 0.0
+
+   with open( filename, 'r' ) as f:
+      for line in f:
+         if line.startswith( '#' )  or  len( line.split() ) < 6:  continue
+
+         col = line.split()
+         if int( col[1] ) <= warmup:   continue
+
+         NUpdate += float( col[4] )
+         Time    += float( col[5] )
+
+   if Time <= 0.0:
+      raise RuntimeError( 'no valid step after %d warm-up steps in %s' % (warmup, filename) )
+
+   return NUpdate/Time
+
+
+
+#-------------------------------------------------------------------------------------------------------
+# Function    :  ParseTiming
+# Description :  Return the elapsed time of each phase summed over all steps from the "Summary" tables
+#                in "Record__Timing"
+#
+# Note        :  1. The first warmup tables (i.e., steps) are excluded
+#                2. Return a dictionary { "Time:<phase>": time }, where "Time:Sum" is the total time
+#-------------------------------------------------------------------------------------------------------
+def ParseTiming( filename, warmup ):
+
+   with open( filename, 'r' ) as f:
+      lines = f.readlines()
+
+   PhaseTime = {}
+   NTable    = 0
+
+   for i, line in enumerate( lines ):
+      if line.strip() != 'Summary':    continue
+
+      NTable += 1
+      if NTable <= warmup:    continue
+
+#     line i+1 is a separator
+      names  = lines[i+2].split()
+      values = lines[i+3].split()
+
+      if values[0] != 'Time'  or  len(values) != len(names)+1:
+         raise RuntimeError( 'unexpected format of the summary table at line %d in %s' % (i+1, filename) )
+
+      for name, value in zip( names, values[1:] ):
+         key = 'Time:' + name
+         PhaseTime[key] = PhaseTime.get( key, 0.0 ) + float( value )
+
+   if len( PhaseTime ) == 0:
+      raise RuntimeError( 'no valid step after %d warm-up steps in %s' % (warmup, filename) )
+
+   return PhaseTime
+
+
+
+#-------------------------------------------------------------------------------------------------------
+# Function    :  RunCase
+# Description :  Run a single problem in a single mode repeatedly and collect the metrics of each run
+#
+# Return      :  Dictionary { metric: [value of each run] }, or None if the case is skipped
+#-------------------------------------------------------------------------------------------------------
+def RunCase( problem, prob_cfg, mode, mode_cfg, common_param, repeat, warmup ):
+
+   exe = os.path.join( args.exe_dir, 'gamer_%s%s' % (problem, mode_cfg.get('exe_suffix', '')) )
+   src = os.path.join( args.root, prob_cfg['dir'] )
+   run = os.path.join( args.work_dir, '%s_%s' % (problem, mode) )
+
+   if not os.path.isfile( exe ):
+      print( '   skip : executable "%s" does not exist' % exe )
+      return None
+
+   for name in prob_cfg.get( 'required', [] ):
+      if not os.path.isfile( os.path.join(src, name) ):
+         print( '   skip : required file "%s" does not exist in %s' % (name, src) )
+         return None
+
+# prepare a clean working directory with all input files
+   if os.path.isdir( run ):   shutil.rmtree( run )
+   os.makedirs( run )
+
+   for name in os.listdir( src ):
+      if os.path.isfile( os.path.join(src, name) ):
+         shutil.copy( os.path.join(src, name), run )
+
+   shutil.copy( exe, os.path.join(run, 'gamer') )
+
+   param = dict( common_param )
+   param.update( prob_cfg.get('param', {}) )
+   param['OMP_NTHREAD'] = mode_cfg['nthread']
+   SetParameter( os.path.join(run, 'Input__Parameter'), param )
+
+   cmd = [ './gamer' ]
+   if mode_cfg['nrank'] > 1:
+      cmd = shlex.split( args.mpirun.format(nrank=mode_cfg['nrank']) ) + cmd
+
+   env = dict( os.environ )
+   env['OMP_NUM_THREADS'] = str( mode_cfg['nthread'] )
+
+   samples = {}
+
+   for r in range( repeat ):
+      for name in glob.glob( os.path.join(run, 'Record__*') ):   os.remove( name )
+
+      with open( os.path.join(run, 'log_%d' % r), 'w' ) as log:
+         status = subprocess.call( cmd, cwd=run, env=env, stdout=log, stderr=subprocess.STDOUT )
+
+      if status != 0:
+         raise RuntimeError( '"%s" failed with exit status %d in %s (see log_%d)' % (' '.join(cmd), status, run, r) )
+
+      metric = ParseTiming( os.path.join(run, 'Record__Timing'), warmup )
+      metric[METRIC_RATE] = ParsePerformance( os.path.join(run, 'Record__Performance'), warmup )
+
+      for key, value in metric.items():
+         samples.setdefault( key, [] ).append( value )
+
+      print( '   run %d/%d : %.4e cell updates/s, %.4e s' % (r+1, repeat, metric[METRIC_RATE], metric[METRIC_TOTAL]) )
+
+   return samples
+
+
+
+#-------------------------------------------------------------------------------------------------------
+# Function    :  Median / MAD
+# Description :  Median and median absolute deviation
+#-------------------------------------------------------------------------------------------------------
+def Median( data ):
+
+   s = sorted( data )
+   n = len( s )
+
+   return 0.5*( s[(n-1)//2] + s[n//2] )
+
+
+def MAD( data ):
+
+   m = Median( data )
+
+   return Median( [ abs(x-m) for x in data ] )
+
+
+
+#-------------------------------------------------------------------------------------------------------
+# Function    :  Compare
+# Description :  Compare the current samples of a single case with the baseline
+#
+# Note        :  1. Compare the medians, which are insensitive to occasional outliers (e.g., OS noise)
+#                2. Relative noise is estimated by the larger median absolute deviation of the baseline and
+#                   current samples (normalized by their own medians and scaled by 1.4826 to match the
+#                   standard deviation of a normal distribution)
+#                   --> Standard error of the median is ~1.253*sigma/sqrt(N)
+#                3. Threshold = max( tolerance, nsigma*noise_of_the_difference )
+#                   --> Tolerance prevents reporting tiny but significant changes when the noise is very low
+#                4. Phases taking less than min_frac of the total baseline time are never reported as
+#                   regressions since their timing is dominated by noise
+#
+# Return      :  List of [ metric, base, current, change, threshold, status ]
+#-------------------------------------------------------------------------------------------------------
+def Compare( base, curr ):
+
+   result    = []
+   TotalTime = Median( base[METRIC_TOTAL] )
+
+   for key in sorted( base.keys(), key=lambda k: (k != METRIC_RATE, k != METRIC_TOTAL, k) ):
+      if key not in curr:  continue
+
+      b  = base[key]
+      c  = curr[key]
+      mb = Median( b )
+      mc = Median( c )
+
+      if mb <= 0.0:
+         result.append( [ key, mb, mc, None, None, '-' ] )
+         continue
+
+      noise     = 1.4826*max( MAD(b)/mb, MAD(c)/max(mc, 1.0e-300) )
+      noise    *= 1.253*math.sqrt( 1.0/len(b) + 1.0/len(c) )
+      threshold = max( args.tolerance, args.nsigma*noise )
+      change    = ( mc - mb )/mb
+
+      if key == METRIC_RATE:
+         worse  = -change
+      else:
+         worse  = +change
+
+      if key != METRIC_RATE  and  mb < args.min_frac*TotalTime:
+         status = '-'
+      elif worse > threshold:
+         status = 'REGRESSED'
+      elif worse < -threshold:
+         status = 'improved'
+      else:
+         status = 'ok'
+
+      result.append( [ key, mb, mc, change, threshold, status ] )
+
+   return result
+
+
+
+# load the configuration and baselines
+with open( args.config, 'r' ) as f:
+   config = json.load( f )
+
+repeat   = args.repeat if args.repeat is not None else config.get( 'repeat', 3 )
+warmup   = config.get( 'warmup_steps', 0 )
+problems = args.problems if args.problems is not None else list( config['problems'].keys() )
+modes    = args.modes    if args.modes    is not None else list( config['modes'].keys() )
+
+for p in problems:   assert p in config['problems'], 'unknown problem "%s"' % p
+for m in modes:      assert m in config['modes'],    'unknown mode "%s"' % m
+
+if os.path.isfile( args.baseline ):
+   with open( args.baseline, 'r' ) as f:
+      baseline = json.load( f )
+else:
+   baseline = { 'cases': {} }
+   if not args.update:
+      print( 'WARNING : baseline file "%s" does not exist --> run with -u to create it\n' % args.baseline )
+
+if not os.path.isdir( args.work_dir ):    os.makedirs( args.work_dir )
+
+
+# run all cases
+results   = {}
+NRegress  = 0
+
+for problem in problems:
+   for mode in modes:
+      case = '%s/%s' % ( problem, mode )
+      print( '%s (repeat %d, warm-up steps %d) ...' % (case, repeat, warmup) )
+
+      samples = RunCase( problem, config['problems'][problem], mode, config['modes'][mode],
+                         config.get('common_param', {}), repeat, warmup )
+      if samples is None:  continue
+
+      results[case] = { 'samples': samples }
+
+      if args.update:
+         baseline['cases'][case] = samples
+         continue
+
+      if case not in baseline['cases']:
+         print( '   no baseline for this case' )
+         continue
+
+      table = Compare( baseline['cases'][case], samples )
+      results[case]['compare'] = table
+
+      print( '   %-20s %13s %13s %9s %9s  %s' % ('Metric', 'Baseline', 'Current', 'Change', 'Threshold', 'Status') )
+      for key, mb, mc, change, threshold, status in table:
+         if status == '-'  and  key != METRIC_TOTAL:   continue
+         print( '   %-20s %13.6e %13.6e %8.2f%% %8.2f%%  %s' % (key, mb, mc, 100.0*change, 100.0*threshold, status) )
+
+      regressed = [ row[0] for row in table if row[5] == 'REGRESSED' ]
+      NRegress += len( regressed )
+      if len( regressed ) > 0:
+         print( '   --> regressed: %s' % ', '.join(regressed) )
+      print( '' )
+
+
+# store the baselines or report
+if args.update:
+   baseline['machine'] = platform.node()
+   baseline['date']    = datetime.datetime.now().isoformat()
+
+   with open( args.baseline, 'w' ) as f:
+      json.dump( baseline, f, indent=1, sort_keys=True )
+
+   print( 'Baselines of %d cases are stored in "%s"' % (len(results), args.baseline) )
+
+else:
+   with open( args.report, 'w' ) as f:
+      json.dump( { 'machine': platform.node(), 'date': datetime.datetime.now().isoformat(),
+                   'tolerance': args.tolerance, 'nsigma': args.nsigma, 'min_frac': args.min_frac,
+                   'nregress': NRegress, 'cases': results }, f, indent=1, sort_keys=True )
+
+   print( 'Number of regressions = %d (report: "%s")' % (NRegress, args.report) )
+
+sys.exit( 1 if NRegress > 0 else 0 )